@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Enable debug log for test coverage
+#define DEBUG_ENABLED 1
+
+#include "dali-scene-loader/public-api/buffer-provider.h"
+#include <dali-test-suite-utils.h>
+#include <fstream>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::SceneLoader;
+
+namespace
+{
+
+const std::string TEST_FILE = TEST_RESOURCE_DIR "/exercise/idle-animation.ani";
+
+std::vector<uint8_t> ReadFile(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}
+
+int UtcDaliBufferProviderGetSharesBuffers(void)
+{
+  BufferProvider buffers;
+  auto buffer = buffers.Get(TEST_FILE);
+  DALI_TEST_CHECK(buffer);
+  DALI_TEST_CHECK(buffer->IsValid());
+
+  const auto contents = ReadFile(TEST_FILE);
+  DALI_TEST_EQUAL(buffer->GetSize(), contents.size());
+  DALI_TEST_EQUAL(0, memcmp(buffer->GetData(), contents.data(), contents.size()));
+
+  // The file is only mapped once.
+  DALI_TEST_EQUAL(buffers.Get(TEST_FILE), buffer);
+
+  DALI_TEST_CHECK(!buffers.Get(TEST_RESOURCE_DIR "/nonexistent.bin"));
+
+  END_TEST;
+}
+
+int UtcDaliBufferProviderRead(void)
+{
+  BufferProvider buffers;
+  auto buffer = buffers.Get(TEST_FILE);
+  DALI_TEST_CHECK(buffer);
+
+  const auto contents = ReadFile(TEST_FILE);
+
+  uint8_t target[16];
+  DALI_TEST_CHECK(buffer->Read(100, sizeof(target), target));
+  DALI_TEST_EQUAL(0, memcmp(target, contents.data() + 100, sizeof(target)));
+
+  // Interleaved elements are packed tightly.
+  DALI_TEST_CHECK(buffer->ReadStrided(21, 4, 21, 4, target));
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    DALI_TEST_EQUAL(0, memcmp(target + i * 4, contents.data() + 21 + i * 21, 4));
+  }
+
+  // Ranges outside of the buffer fail.
+  DALI_TEST_CHECK(!buffer->Read(contents.size() - 8, sizeof(target), target));
+  DALI_TEST_CHECK(!buffer->Read(contents.size() + 1, 0, target));
+  DALI_TEST_CHECK(!buffer->ReadStrided(contents.size() - 21, 2, 21, 4, target));
+  DALI_TEST_CHECK(buffer->ReadStrided(contents.size() - 4, 1, 21, 4, target));
+
+  END_TEST;
+}
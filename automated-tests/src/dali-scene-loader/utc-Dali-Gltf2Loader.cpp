@@ -19,6 +19,7 @@
 #define DEBUG_ENABLED 1
 
 #include "dali-scene-loader/public-api/resource-bundle.h"
+#include "dali-scene-loader/public-api/buffer-provider.h"
 #include "dali-scene-loader/public-api/scene-definition.h"
 #include "dali-scene-loader/public-api/load-result.h"
 #include "dali-scene-loader/public-api/gltf2-loader.h"
@@ -291,6 +292,85 @@ int UtcDaliGltfLoaderSuccess1(void)
   END_TEST;
 }
 
+int UtcDaliGltfLoaderSuccessGlb(void)
+{
+  TestApplication app;
+
+  Context gltf;
+  ShaderDefinitionFactory gltfSdf;
+  gltfSdf.SetResources(gltf.resources);
+  LoadGltfScene(TEST_RESOURCE_DIR "/AnimatedCube.gltf", gltfSdf, gltf.loadResult);
+
+  // Same asset, with the buffer and the images in the BIN chunk of a single file.
+  Context ctx;
+  ShaderDefinitionFactory sdf;
+  sdf.SetResources(ctx.resources);
+  LoadGltfScene(TEST_RESOURCE_DIR "/AnimatedCube.glb", sdf, ctx.loadResult);
+
+  DALI_TEST_EQUAL(gltf.scene.GetRoots().size(), ctx.scene.GetRoots().size());
+  DALI_TEST_EQUAL(gltf.scene.GetNodeCount(), ctx.scene.GetNodeCount());
+  DALI_TEST_EQUAL(gltf.cameras.size(), ctx.cameras.size());
+  DALI_TEST_EQUAL(gltf.animations.size(), ctx.animations.size());
+
+  constexpr uint32_t BIN_CHUNK_OFFSET = 3656;
+  constexpr uint32_t BIN_LENGTH = 1860;
+
+  auto& meshes = ctx.resources.mMeshes;
+  DALI_TEST_EQUAL(gltf.resources.mMeshes.size(), meshes.size());
+  for (uint32_t i = 0; i < meshes.size(); ++i)
+  {
+    auto& md = meshes[i].first;
+    auto& mdGltf = gltf.resources.mMeshes[i].first;
+    DALI_TEST_EQUAL(md.mUri, std::string("AnimatedCube.glb"));
+    DALI_TEST_EQUAL(md.mPositions.mBlob.mOffset, mdGltf.mPositions.mBlob.mOffset + BIN_CHUNK_OFFSET);
+    DALI_TEST_EQUAL(md.mIndices.mBlob.mOffset, mdGltf.mIndices.mBlob.mOffset + BIN_CHUNK_OFFSET);
+  }
+
+  auto& materials = ctx.resources.mMaterials;
+  DALI_TEST_EQUAL(gltf.resources.mMaterials.size(), materials.size());
+  for (auto& m : materials)
+  {
+    for (auto& ts : m.first.mTextureStages)
+    {
+      DALI_TEST_EQUAL(ts.mTexture.mImageUri, std::string("AnimatedCube.glb"));
+      DALI_TEST_CHECK(ts.mTexture.mImageOffset >= BIN_CHUNK_OFFSET + BIN_LENGTH);
+      DALI_TEST_EQUAL(ts.mTexture.mImageLength, 319u);
+    }
+  }
+
+  // Geometry and images are loaded from the .glb.
+  const std::string resourcePath = TEST_RESOURCE_DIR "/";
+  BufferProvider buffers;
+  for (auto& m : meshes)
+  {
+    auto raw = m.first.LoadRaw(resourcePath, buffers);
+    DALI_TEST_CHECK(!raw.mAttribs.empty());
+  }
+
+  auto raw = materials[0].first.LoadRaw(resourcePath, buffers);
+  DALI_TEST_EQUAL(raw.mTextures.size(), materials[0].first.mTextureStages.size());
+  for (auto& t : raw.mTextures)
+  {
+    DALI_TEST_CHECK(t.mPixels);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGltfLoaderGlbMissingBinChunk(void)
+{
+  Context ctx;
+
+  ShaderDefinitionFactory sdf;
+  sdf.SetResources(ctx.resources);
+
+  DALI_TEST_THROW(LoadGltfScene(TEST_RESOURCE_DIR "/AnimatedCube-nobin.glb", sdf, ctx.loadResult),
+    std::runtime_error,
+    ExceptionMessageStartsWith{"Missing or short .glb BIN chunk"});
+
+  END_TEST;
+}
+
 int UtcDaliGltfLoaderSuccessShort(void)
 {
   TestApplication app;
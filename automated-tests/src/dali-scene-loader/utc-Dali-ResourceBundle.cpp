@@ -66,3 +66,88 @@ int UtcDaliResourceRefCounts(void)
 
   END_TEST;
 }
+
+int UtcDaliResourceBundleLoadResourcesProgress(void)
+{
+  TestApplication app;
+
+  for (auto options : { ResourceBundle::Options::None, ResourceBundle::Options::SingleThreaded })
+  {
+    ResourceBundle resourceBundle;
+    resourceBundle.mEnvironmentMaps.push_back({});
+    resourceBundle.mMaterials.resize(20);  // untextured, for single value textures to be made.
+
+    auto counter = resourceBundle.CreateRefCounter();
+    std::fill(counter[ResourceType::Material].begin(), counter[ResourceType::Material].end(), 1u);
+
+    uint32_t numCalls = 0;
+    resourceBundle.LoadResources(counter, [](ResourceType::Value) { return std::string(); }, options,
+      [&numCalls](uint32_t numLoaded, uint32_t numTotal) {
+        ++numCalls;
+        DALI_TEST_EQUAL(numLoaded, numCalls);
+        DALI_TEST_EQUAL(numTotal, 20u);
+        return true;
+      });
+
+    DALI_TEST_EQUAL(numCalls, 20u);
+    for (auto& m : resourceBundle.mMaterials)
+    {
+      DALI_TEST_CHECK(m.second);
+      DALI_TEST_EQUAL(m.second.GetTextureCount(), 2u);
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliResourceBundleLoadResourcesCancel(void)
+{
+  TestApplication app;
+
+  ResourceBundle resourceBundle;
+  resourceBundle.mEnvironmentMaps.push_back({});
+  resourceBundle.mMaterials.resize(20);
+
+  auto counter = resourceBundle.CreateRefCounter();
+  std::fill(counter[ResourceType::Material].begin(), counter[ResourceType::Material].end(), 1u);
+
+  resourceBundle.LoadResources(counter, [](ResourceType::Value) { return std::string(); }, ResourceBundle::Options::None,
+    [](uint32_t numLoaded, uint32_t) {
+      return numLoaded < 5;
+    });
+
+  uint32_t i = 0;
+  for (auto& m : resourceBundle.mMaterials)
+  {
+    DALI_TEST_EQUAL(static_cast<bool>(m.second), i < 5);
+    ++i;
+  }
+
+  END_TEST;
+}
+
+int UtcDaliResourceBundleLoadResourcesFail(void)
+{
+  TestApplication app;
+
+  for (auto options : { ResourceBundle::Options::None, ResourceBundle::Options::SingleThreaded })
+  {
+    ResourceBundle resourceBundle;
+    resourceBundle.mShaders.resize(4);
+    for (auto& s : resourceBundle.mShaders)
+    {
+      s.first.mVertexShaderPath = "dli_pbr.vsh";
+      s.first.mFragmentShaderPath = "dli_pbr.fsh";
+    }
+    resourceBundle.mShaders[2].first.mVertexShaderPath = "nonexistent.vsh";
+
+    auto counter = resourceBundle.CreateRefCounter();
+    std::fill(counter[ResourceType::Shader].begin(), counter[ResourceType::Shader].end(), 1u);
+
+    // The error of the worker thread is raised on this one.
+    DALI_TEST_ASSERTION(resourceBundle.LoadResources(counter, [](ResourceType::Value) { return std::string(TEST_RESOURCE_DIR "/"); }, options),
+      "Failed to load shader source");
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/internal/controls/gaussian-blur-view/gaussian-blur-kernel.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+
+const unsigned int KERNEL_SIZES[] = { 1u, 3u, 4u, 5u, 7u, 9u, 13u, 15u, 25u };
+const float BELL_CURVE_WIDTHS[] = { 0.5f, 1.5f, 3.0f, 10.0f };
+
+/**
+ * Spreads the weights of the fetches over the texels as the bilinear filter of the texture hardware does.
+ */
+std::vector< float > GetTexelWeights( const std::vector< float >& offsets, const std::vector< float >& weights, unsigned int radius )
+{
+  std::vector< float > texelWeights( radius + 2u, 0.0f );
+
+  for( std::size_t i = 0u; i < offsets.size(); ++i )
+  {
+    const unsigned int texel = static_cast< unsigned int >( std::floor( offsets[i] ) );
+    const float fraction = offsets[i] - static_cast< float >( texel );
+
+    texelWeights[texel] += weights[i] * ( 1.0f - fraction );
+    texelWeights[texel + 1u] += weights[i] * fraction;
+  }
+
+  return texelWeights;
+}
+
+} // namespace
+
+int UtcDaliGaussianBlurKernelReference(void)
+{
+  tet_infoline( "Test the reference kernel is a normalised Gaussian, spanning two texels per sample" );
+
+  std::vector< float > weights;
+  CalculateGaussianKernel( 9u, 1.5f, weights );
+
+  // Four samples either side of the centre, i.e. eight texels, with the bell curve twice as wide in texels
+  DALI_TEST_EQUALS( weights.size(), 9u, TEST_LOCATION );
+
+  float total = weights[0];
+  for( std::size_t i = 1u; i < weights.size(); ++i )
+  {
+    DALI_TEST_CHECK( weights[i] < weights[i - 1u] );
+    DALI_TEST_EQUALS( weights[i] / weights[0], std::exp( -static_cast< float >( i * i ) / ( 2.0f * 3.0f * 3.0f ) ), 0.00001f, TEST_LOCATION );
+    total += 2.0f * weights[i];
+  }
+  DALI_TEST_EQUALS( total, 1.0f, 0.00001f, TEST_LOCATION );
+
+  // An even size is rounded up
+  CalculateGaussianKernel( 4u, 1.5f, weights );
+  DALI_TEST_EQUALS( weights.size(), 5u, TEST_LOCATION );
+
+  CalculateGaussianKernel( 1u, 1.5f, weights );
+  DALI_TEST_EQUALS( weights.size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( weights[0], 1.0f, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurKernelNumberOfLinearSamples(void)
+{
+  tet_infoline( "Test the linear sampling kernel fetches each pair of texels once, i.e. once per sample" );
+
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 1u ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 3u ), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 4u ), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 5u ), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 13u ), 13u, TEST_LOCATION );
+  DALI_TEST_EQUALS( GetNumberOfLinearSamples( 25u ), 25u, TEST_LOCATION );
+
+  for( auto size : KERNEL_SIZES )
+  {
+    std::vector< float > offsets;
+    std::vector< float > weights;
+    CalculateLinearSamplingKernel( size, 1.5f, offsets, weights );
+
+    DALI_TEST_EQUALS( offsets.size(), weights.size(), TEST_LOCATION );
+    DALI_TEST_EQUALS( 2u * offsets.size() - 1u, GetNumberOfLinearSamples( size ), TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurKernelMatchesReference(void)
+{
+  tet_infoline( "Test the linear sampling kernel weights the texels as the reference kernel does" );
+
+  for( auto size : KERNEL_SIZES )
+  {
+    for( auto bellCurveWidth : BELL_CURVE_WIDTHS )
+    {
+      std::vector< float > referenceWeights;
+      CalculateGaussianKernel( size, bellCurveWidth, referenceWeights );
+
+      std::vector< float > offsets;
+      std::vector< float > weights;
+      CalculateLinearSamplingKernel( size, bellCurveWidth, offsets, weights );
+
+      DALI_TEST_EQUALS( offsets[0], 0.0f, TEST_LOCATION );
+
+      const unsigned int radius = referenceWeights.size() - 1u;
+      std::vector< float > texelWeights = GetTexelWeights( offsets, weights, radius );
+
+      for( unsigned int texel = 0u; texel <= radius; ++texel )
+      {
+        DALI_TEST_EQUALS( texelWeights[texel], referenceWeights[texel], 0.00001f, TEST_LOCATION );
+      }
+
+      // Nothing is fetched beyond the kernel
+      DALI_TEST_EQUALS( texelWeights[radius + 1u], 0.0f, 0.00001f, TEST_LOCATION );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurKernelSpan(void)
+{
+  tet_infoline( "Test the linear sampling kernel spans the texels the samples have always covered" );
+
+  for( auto size : KERNEL_SIZES )
+  {
+    std::vector< float > offsets;
+    std::vector< float > weights;
+    CalculateLinearSamplingKernel( size, 1.5f, offsets, weights );
+
+    // The i-th sample either side of the centre has always been fetched between the texels 2i - 1 and 2i
+    for( std::size_t i = 1u; i < offsets.size(); ++i )
+    {
+      DALI_TEST_CHECK( offsets[i] >= static_cast< float >( 2u * i - 1u ) );
+      DALI_TEST_CHECK( offsets[i] <= static_cast< float >( 2u * i ) );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurKernelNarrowBellCurve(void)
+{
+  tet_infoline( "Test the linear sampling kernel is defined when the outer weights underflow" );
+
+  std::vector< float > offsets;
+  std::vector< float > weights;
+  CalculateLinearSamplingKernel( 9u, 0.001f, offsets, weights );
+
+  DALI_TEST_EQUALS( weights[0], 1.0f, TEST_LOCATION );
+  for( std::size_t i = 1u; i < offsets.size(); ++i )
+  {
+    DALI_TEST_CHECK( !std::isnan( offsets[i] ) );
+    DALI_TEST_EQUALS( weights[i], 0.0f, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <fstream>
+#include <sstream>
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/internal/builder/json-parser-impl.h>
+#include <dali-toolkit/internal/builder/json-sax-parser.h>
+#include <dali-toolkit/internal/builder/json-snapshot.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+
+const char* TEST_THEME_FILE_NAME = TEST_RESOURCE_DIR "/../../dali-toolkit/styles/1920x1080/dali-toolkit-default-theme.json";
+
+/**
+ * Records the values as a string, and optionally stops after a number of them.
+ */
+struct RecordingHandler : public JsonSaxHandler
+{
+  explicit RecordingHandler(int valuesToStopAfter = -1)
+  : mValuesToStopAfter(valuesToStopAfter)
+  {
+  }
+
+  bool StartObject(const char* name) override
+  {
+    return Record(name, "{");
+  }
+
+  bool EndObject() override
+  {
+    ++mNumberOfEnds;
+    return Record(nullptr, "}");
+  }
+
+  bool StartArray(const char* name) override
+  {
+    return Record(name, "[");
+  }
+
+  bool EndArray() override
+  {
+    ++mNumberOfEnds;
+    return Record(nullptr, "]");
+  }
+
+  bool String(const char* name, const char* value, bool substitution) override
+  {
+    return Record(name, std::string(substitution ? "$" : "") + "'" + value + "'");
+  }
+
+  bool Integer(const char* name, int value) override
+  {
+    return Record(name, std::to_string(value));
+  }
+
+  bool Float(const char* name, float value) override
+  {
+    std::ostringstream stream;
+    stream << value;
+    return Record(name, stream.str());
+  }
+
+  bool Boolean(const char* name, bool value) override
+  {
+    return Record(name, value ? "true" : "false");
+  }
+
+  bool Null(const char* name) override
+  {
+    return Record(name, "null");
+  }
+
+  bool Record(const char* name, const std::string& value)
+  {
+    if(!mRecord.empty())
+    {
+      mRecord += " ";
+    }
+    if(name)
+    {
+      mRecord += std::string(name) + ":";
+    }
+    mRecord += value;
+
+    ++mNumberOfValues;
+    return mValuesToStopAfter < 0 || mNumberOfValues < mValuesToStopAfter;
+  }
+
+  std::string mRecord;
+  int mValuesToStopAfter;
+  int mNumberOfValues = 0;
+  int mNumberOfEnds = 0;
+};
+
+std::vector<char> ToBuffer(const std::string& source)
+{
+  return std::vector<char>(source.begin(), source.end());
+}
+
+int CountNodes(const TreeNode& node)
+{
+  int count = 1;
+  for(TreeNode::ConstIterator iter = node.CBegin(); iter != node.CEnd(); ++iter)
+  {
+    count += CountNodes((*iter).second);
+  }
+  return count;
+}
+
+} // namespace
+
+int UtcDaliJsonSaxParserValues(void)
+{
+  tet_infoline("Test that the values are reported in document order, with their names");
+
+  std::vector<char> buffer = ToBuffer(
+    "// a comment\n"
+    "{ \"string\": \"value\", /* another\n comment */ \"integer\": -42, \"float\": 2.5,\n"
+    "  \"array\": [ true, false, null, {}, [] ],\n"
+    "  \"object\": { \"substitution\": \"{other}\", \"long\": \"a string of more than sixteen \\\"characters\\\"\\n\\u00e9\" } }");
+
+  JsonSaxParser parser;
+  RecordingHandler handler;
+  DALI_TEST_CHECK(parser.Parse(buffer, handler));
+  DALI_TEST_CHECK(nullptr == parser.GetErrorDescription());
+
+  DALI_TEST_EQUALS(handler.mRecord,
+                   "{ string:'value' integer:-42 float:2.5 array:[ true false null { } [ ] ] "
+                   "object:{ substitution:$'{other}' long:'a string of more than sixteen \"characters\"\n\xc3\xa9' } }",
+                   TEST_LOCATION);
+
+  // string data includes the names, values and their terminators
+  DALI_TEST_EQUALS(parser.GetParsedStringSize(), 112, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonSaxParserHandlerStops(void)
+{
+  tet_infoline("Test that the parse stops when the handler returns false");
+
+  std::vector<char> buffer = ToBuffer("[ 1, 2, 3, 4 ]");
+
+  JsonSaxParser parser;
+  RecordingHandler handler(3);
+  DALI_TEST_CHECK(!parser.Parse(buffer, handler));
+  DALI_TEST_EQUALS(handler.mRecord, "[ 1 2", TEST_LOCATION);
+  DALI_TEST_EQUALS(std::string(parser.GetErrorDescription()), "Parse stopped by handler", TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonSaxParserErrors(void)
+{
+  tet_infoline("Test the position of errors, counting the lines in whitespace and comments");
+
+  std::vector<char> buffer = ToBuffer(
+    "{\n"
+    "  // comment\n"
+    "  /* comment\n"
+    "  */ \"key\":\n"
+    "       \"value\" \"value\" }");
+
+  JsonSaxParser parser;
+  RecordingHandler handler;
+  DALI_TEST_CHECK(!parser.Parse(buffer, handler));
+
+  DALI_TEST_EQUALS(std::string(parser.GetErrorDescription()), "Expected a comma", TEST_LOCATION);
+  DALI_TEST_EQUALS(parser.GetErrorLineNumber(), 4, TEST_LOCATION);
+  DALI_TEST_EQUALS(parser.GetErrorColumn(), 16, TEST_LOCATION);
+  DALI_TEST_EQUALS(parser.GetErrorPosition(), 55, TEST_LOCATION);
+
+  std::vector<char> empty;
+  DALI_TEST_CHECK(!parser.Parse(empty, handler));
+  DALI_TEST_EQUALS(std::string(parser.GetErrorDescription()), "Empty source buffer to parse", TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonSaxParserDefaultTheme(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("Test that the shipped default theme reports a value for every node of the parsed tree");
+
+  std::ifstream file(TEST_THEME_FILE_NAME);
+  std::stringstream stream;
+  stream << file.rdbuf();
+  const std::string theme = stream.str();
+  DALI_TEST_CHECK(!theme.empty());
+
+  std::vector<char> buffer = ToBuffer(theme);
+  JsonSaxParser parser;
+  RecordingHandler handler;
+  DALI_TEST_CHECK(parser.Parse(buffer, handler));
+
+  Toolkit::JsonParser jsonParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(jsonParser.Parse(theme));
+
+  // every node starts with one value, and every object and array also ends with one
+  DALI_TEST_CHECK(handler.mNumberOfEnds > 0);
+  DALI_TEST_EQUALS(handler.mNumberOfValues - handler.mNumberOfEnds, CountNodes(*jsonParser.GetRoot()), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliJsonSnapshotReplay(void)
+{
+  tet_infoline("Test that a snapshot replays the values of the parsed json");
+
+  const std::string source(
+    "{ \"string\": \"value\", \"integer\": -42, \"float\": 2.5,\n"
+    "  \"array\": [ true, false, null, {}, [] ],\n"
+    "  \"object\": { \"substitution\": \"{other}\", \"escaped\": \"\\\"quoted\\\"\\n\\u00e9\" } }");
+
+  std::vector<char> buffer = ToBuffer(source);
+  JsonSaxParser parser;
+  RecordingHandler parsed;
+  DALI_TEST_CHECK(parser.Parse(buffer, parsed));
+
+  std::vector<char> snapshot;
+  DALI_TEST_CHECK(RecordJsonSnapshot(source, snapshot));
+
+  RecordingHandler replayed;
+  int stringSize = 0;
+  DALI_TEST_CHECK(ReplayJsonSnapshot(snapshot, replayed, stringSize));
+  DALI_TEST_EQUALS(replayed.mRecord, parsed.mRecord, TEST_LOCATION);
+  DALI_TEST_EQUALS(stringSize, parser.GetParsedStringSize(), TEST_LOCATION);
+
+  // invalid json is not recorded
+  DALI_TEST_CHECK(!RecordJsonSnapshot("{ \"key\": }", snapshot));
+
+  END_TEST;
+}
+
+int UtcDaliJsonSnapshotInvalid(void)
+{
+  tet_infoline("Test that truncated and unbalanced snapshots are rejected");
+
+  std::vector<char> snapshot;
+  DALI_TEST_CHECK(RecordJsonSnapshot("{ \"array\": [ 1, 2 ], \"string\": \"value\" }", snapshot));
+
+  RecordingHandler handler;
+  int stringSize = 0;
+  std::vector<char> empty;
+  DALI_TEST_CHECK(!ReplayJsonSnapshot(empty, handler, stringSize));
+
+  // truncated in the last string, then before the end of the root
+  std::vector<char> truncated(snapshot.begin(), snapshot.end() - 3);
+  DALI_TEST_CHECK(!ReplayJsonSnapshot(truncated, handler, stringSize));
+  truncated.assign(snapshot.begin(), snapshot.end() - 1);
+  DALI_TEST_CHECK(!ReplayJsonSnapshot(truncated, handler, stringSize));
+
+  // a second root
+  std::vector<char> twice(snapshot);
+  twice.insert(twice.end(), snapshot.begin(), snapshot.end());
+  DALI_TEST_CHECK(!ReplayJsonSnapshot(twice, handler, stringSize));
+
+  // an unknown value
+  std::vector<char> unknown(snapshot);
+  unknown[0] = 0x0f;
+  DALI_TEST_CHECK(!ReplayJsonSnapshot(unknown, handler, stringSize));
+
+  Toolkit::JsonParser jsonParser = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(!GetImplementation(jsonParser).ParseSnapshot(truncated));
+  DALI_TEST_CHECK(jsonParser.ParseError());
+
+  END_TEST;
+}
+
+int UtcDaliJsonSnapshotDefaultTheme(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("Test that the snapshot of the shipped default theme builds the same tree as the json, merged or not");
+
+  std::ifstream file(TEST_THEME_FILE_NAME);
+  std::stringstream stream;
+  stream << file.rdbuf();
+  const std::string theme = stream.str();
+  DALI_TEST_CHECK(!theme.empty());
+
+  std::vector<char> snapshot;
+  DALI_TEST_CHECK(RecordJsonSnapshot(theme, snapshot));
+
+  const std::string other("{ \"styles\": { \"TextLabel\": { \"pointSize\": 20 }, \"NewStyle\": {} } }");
+  std::vector<char> otherSnapshot;
+  DALI_TEST_CHECK(RecordJsonSnapshot(other, otherSnapshot));
+
+  Toolkit::JsonParser parsed = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(parsed.Parse(theme));
+  DALI_TEST_CHECK(parsed.Parse(other));
+
+  Toolkit::JsonParser replayed = Toolkit::JsonParser::New();
+  DALI_TEST_CHECK(GetImplementation(replayed).ParseSnapshot(snapshot));
+  DALI_TEST_CHECK(GetImplementation(replayed).ParseSnapshot(otherSnapshot));
+  DALI_TEST_CHECK(!replayed.ParseError());
+
+  std::ostringstream parsedTree;
+  std::ostringstream replayedTree;
+  parsed.Write(parsedTree, 2);
+  replayed.Write(replayedTree, 2);
+  DALI_TEST_EQUALS(replayedTree.str(), parsedTree.str(), TEST_LOCATION);
+
+  // the strings are moved into the packed buffer as for parsed json
+  replayed.Pack();
+  std::ostringstream packedTree;
+  replayed.Write(packedTree, 2);
+  DALI_TEST_EQUALS(packedTree.str(), parsedTree.str(), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <toolkit-timer.h>
+#include <dali-toolkit/devel-api/utility/render-target-pool.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+
+namespace
+{
+
+const uint64_t RENDER_TARGET_SIZE = 64u * 64u * 4u; ///< The size of a 64x64 RGBA8888 render target
+
+} // namespace
+
+int UtcDaliRenderTargetPoolReuse(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test a released render target is reused by a request of the same size and format" );
+
+  Internal::RenderTargetPoolPtr pool = Internal::RenderTargetPool::Get();
+
+  FrameBuffer frameBuffer = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( frameBuffer );
+  DALI_TEST_CHECK( frameBuffer.GetColorTexture() );
+  DALI_TEST_EQUALS( frameBuffer.GetColorTexture().GetWidth(), 64u, TEST_LOCATION );
+
+  FrameBuffer released = frameBuffer;
+  frameBuffer.Reset();
+  FrameBuffer reused = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( reused == released );
+
+  RenderTargetPool::Statistics statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.allocationCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.reuseCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledMemory, RENDER_TARGET_SIZE, TEST_LOCATION );
+
+  // A different size or format needs another render target
+  released.Reset();
+  reused.Reset();
+  FrameBuffer otherSize = pool->Acquire( 32u, 64u, Pixel::RGBA8888 );
+  FrameBuffer otherFormat = pool->Acquire( 64u, 64u, Pixel::RGB888 );
+  FrameBuffer otherAttachments = pool->Acquire( 64u, 64u, Pixel::RGBA8888, FrameBuffer::Attachment::DEPTH );
+
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.allocationCount, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.reuseCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledCount, 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRenderTargetPoolLease(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test a render target is not reused while a handle to it exists" );
+
+  Internal::RenderTargetPoolPtr pool = Internal::RenderTargetPool::Get();
+
+  FrameBuffer first = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  FrameBuffer second = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( first != second );
+
+  // A render task keeps the lease
+  RenderTask task = application.GetScene().GetRenderTaskList().CreateTask();
+  task.SetFrameBuffer( first );
+  FrameBuffer released = second;
+  first.Reset();
+  second.Reset();
+
+  RenderTargetPool::Statistics statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.leasedCount, 2u, TEST_LOCATION );
+
+  FrameBuffer third = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( third != task.GetFrameBuffer() );
+
+  released.Reset();
+  FrameBuffer fourth = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( fourth != task.GetFrameBuffer() );
+  DALI_TEST_CHECK( fourth != third );
+
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.allocationCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.reuseCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 3u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRenderTargetPoolLeaseColorTexture(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test a render target is not reused while its color texture is still rendered from" );
+
+  Internal::RenderTargetPoolPtr pool = Internal::RenderTargetPool::Get();
+
+  FrameBuffer first = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+
+  // A texture set keeps the lease after the render target is released
+  TextureSet textureSet = TextureSet::New();
+  textureSet.SetTexture( 0u, first.GetColorTexture() );
+  first.Reset();
+
+  RenderTargetPool::Statistics statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.leasedCount, 1u, TEST_LOCATION );
+
+  FrameBuffer second = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( second.GetColorTexture() != textureSet.GetTexture( 0u ) );
+
+  // Once the texture set is gone, the render target is reused
+  textureSet.Reset();
+  FrameBuffer third = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( third != second );
+
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.allocationCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.reuseCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRenderTargetPoolMemoryBudget(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test the pool evicts the least recently leased idle render targets to keep within the budget" );
+
+  Internal::RenderTargetPoolPtr pool = Internal::RenderTargetPool::Get();
+  RenderTargetPool::SetMemoryBudget( 2u * RENDER_TARGET_SIZE );
+
+  FrameBuffer first = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  FrameBuffer second = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+
+  // The leased render targets take the budget, so this one is not pooled
+  FrameBuffer third = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( third );
+
+  RenderTargetPool::Statistics statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.allocationCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledMemory, 2u * RENDER_TARGET_SIZE, TEST_LOCATION );
+
+  // Released render targets stay in the pool within the budget
+  first.Reset();
+  second.Reset();
+  third.Reset();
+
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 0u, TEST_LOCATION );
+
+  // A smaller budget evicts the least recently leased of the idle render targets
+  RenderTargetPool::SetMemoryBudget( RENDER_TARGET_SIZE );
+
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.evictionCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledMemory, RENDER_TARGET_SIZE, TEST_LOCATION );
+
+  // A render target of another size replaces the idle one
+  FrameBuffer otherSize = pool->Acquire( 32u, 128u, Pixel::RGBA8888 );
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.evictionCount, 2u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliRenderTargetPoolIdleTimeout(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test the pool destroys the render targets which have been idle for the timeout" );
+
+  Internal::RenderTargetPoolPtr pool = Internal::RenderTargetPool::Get();
+
+  FrameBuffer leased = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  FrameBuffer released = pool->Acquire( 64u, 64u, Pixel::RGBA8888 );
+  released.Reset();
+
+  // Not idle for long enough with the default timeout
+  Test::EmitGlobalTimerSignal();
+  RenderTargetPool::Statistics statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.evictionCount, 0u, TEST_LOCATION );
+
+  RenderTargetPool::SetIdleTimeout( 0u );
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.leasedCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.evictionCount, 1u, TEST_LOCATION );
+
+  // The timer checks the render targets released since
+  leased.Reset();
+  Test::EmitGlobalTimerSignal();
+  statistics = RenderTargetPool::GetStatistics();
+  DALI_TEST_EQUALS( statistics.pooledCount, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.evictionCount, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( statistics.pooledMemory, 0u, TEST_LOCATION );
+
+  // The timer stops while the pool is empty
+  DALI_TEST_CHECK( !Test::AreTimersRunning() );
+
+  END_TEST;
+}
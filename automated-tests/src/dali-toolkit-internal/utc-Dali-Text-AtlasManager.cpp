@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
+#include <dali-toolkit/internal/text/rendering/atlas/atlas-manager.h>
+
+using namespace Dali;
+using namespace Toolkit;
+
+namespace
+{
+const uint32_t ATLAS_WIDTH = 512u;
+const uint32_t ATLAS_HEIGHT = 512u;
+const uint32_t ATLAS_AREA = ( ATLAS_WIDTH - 1u ) * ( ATLAS_HEIGHT - 1u ); // Less the filled pixel row and column
+const std::string DEFAULT_FONT_DIR( "/resources/fonts" );
+
+Devel::PixelBuffer CreateGlyph( uint32_t width, uint32_t height )
+{
+  Devel::PixelBuffer glyph = Devel::PixelBuffer::New( width, height, Pixel::L8 );
+  memset( glyph.GetBuffer(), 0xFF, width * height );
+  return glyph;
+}
+
+AtlasManager CreateAtlasManager()
+{
+  AtlasManager atlasManager = AtlasManager::New();
+
+  AtlasManager::AtlasSize size;
+  size.mWidth = ATLAS_WIDTH;
+  size.mHeight = ATLAS_HEIGHT;
+  atlasManager.SetNewAtlasSize( size );
+
+  return atlasManager;
+}
+
+} // namespace
+
+int UtcDaliTextAtlasManagerMixedSizes(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerMixedSizes");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  // Small and large glyphs share an atlas, each taking only its own size plus the padding.
+  uint32_t areaUsed = 0u;
+  for( uint32_t i = 0u; i < 80u; ++i )
+  {
+    const bool large = ( 0u == i % 4u );
+    const uint32_t width = large ? 48u : 10u;
+    const uint32_t height = large ? 56u : 14u;
+
+    AtlasManager::AtlasSlot slot;
+    const bool created = atlasManager.Add( CreateGlyph( width, height ), slot );
+    DALI_TEST_EQUALS( created, 0u == i, TEST_LOCATION );
+    DALI_TEST_EQUALS( slot.mImageId, i + 1u, TEST_LOCATION );
+    DALI_TEST_EQUALS( slot.mAtlasId, 1u, TEST_LOCATION );
+
+    areaUsed += ( width + 2u ) * ( height + 2u );
+  }
+
+  DALI_TEST_EQUALS( atlasManager.GetAtlasCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlasManager.GetFreeArea( 1u ), ATLAS_AREA - areaUsed, TEST_LOCATION );
+
+  AtlasManager::Metrics metrics;
+  atlasManager.GetMetrics( metrics );
+  DALI_TEST_EQUALS( metrics.mAtlasCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0].mImageCount, 80u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0].mAreaUsed, areaUsed, TEST_LOCATION );
+  DALI_TEST_EQUALS( metrics.mAtlasMetrics[0].mTotalArea, ATLAS_AREA, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerRemove(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerRemove");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  AtlasManager::AtlasSlot first;
+  AtlasManager::AtlasSlot second;
+  atlasManager.Add( CreateGlyph( 20u, 20u ), first );
+  atlasManager.Add( CreateGlyph( 30u, 30u ), second );
+  DALI_TEST_EQUALS( first.mImageId, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( second.mImageId, 2u, TEST_LOCATION );
+
+  // The id of a removed image is given to the next image added.
+  DALI_TEST_CHECK( atlasManager.Remove( first.mImageId ) );
+  DALI_TEST_CHECK( !atlasManager.Remove( first.mImageId ) );
+
+  AtlasManager::AtlasSlot third;
+  atlasManager.Add( CreateGlyph( 40u, 40u ), third );
+  DALI_TEST_EQUALS( third.mImageId, 1u, TEST_LOCATION );
+
+  // Once every image is removed, the whole atlas is free again for an image as large as the atlas allows.
+  DALI_TEST_CHECK( atlasManager.Remove( second.mImageId ) );
+  DALI_TEST_CHECK( atlasManager.Remove( third.mImageId ) );
+  DALI_TEST_EQUALS( atlasManager.GetFreeArea( 1u ), ATLAS_AREA, TEST_LOCATION );
+
+  AtlasManager::AtlasSlot largest;
+  const bool created = atlasManager.Add( CreateGlyph( ATLAS_WIDTH - 3u, ATLAS_HEIGHT - 3u ), largest );
+  DALI_TEST_CHECK( !created );
+  DALI_TEST_EQUALS( largest.mAtlasId, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlasManager.GetFreeArea( 1u ), 0u, TEST_LOCATION );
+
+  // An image too large for a new atlas is not added.
+  AtlasManager::AtlasSlot tooLarge;
+  atlasManager.Add( CreateGlyph( ATLAS_WIDTH - 2u, 10u ), tooLarge );
+  DALI_TEST_EQUALS( tooLarge.mImageId, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( atlasManager.GetAtlasCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerGenerateMeshData(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerGenerateMeshData");
+  ToolkitTestApplication application;
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  AtlasManager::AtlasSlot slot;
+  atlasManager.Add( CreateGlyph( 10u, 14u ), slot );
+
+  AtlasManager::Mesh2D mesh;
+  atlasManager.GenerateMeshData( slot.mImageId, Vector2( 100.0f, 50.0f ), mesh );
+  DALI_TEST_EQUALS( mesh.mVertices.Count(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( mesh.mIndices.Count(), 6u, TEST_LOCATION );
+
+  // The image is after the filled pixel and its padding, and the quad extends half a pixel onto the padding on each side.
+  const float texelX = 1.0f / static_cast<float>( ATLAS_WIDTH );
+  const float texelY = 1.0f / static_cast<float>( ATLAS_HEIGHT );
+  DALI_TEST_EQUALS( mesh.mVertices[0].mPosition, Vector2( 99.5f, 49.5f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( mesh.mVertices[0].mTexCoords, Vector2( 1.5f * texelX, 1.5f * texelY ), TEST_LOCATION );
+  DALI_TEST_EQUALS( mesh.mVertices[3].mPosition, Vector2( 110.5f, 64.5f ), TEST_LOCATION );
+  DALI_TEST_EQUALS( mesh.mVertices[3].mTexCoords, Vector2( 12.5f * texelX, 16.5f * texelY ), TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerBatchedUpload(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerBatchedUpload");
+  ToolkitTestApplication application;
+
+  TraceCallStack& textureTrace = application.GetGlAbstraction().GetTextureTrace();
+  textureTrace.Enable( true );
+
+  AtlasManager atlasManager = CreateAtlasManager();
+
+  AtlasManager::AtlasSlot slot;
+  atlasManager.Add( CreateGlyph( 10u, 14u ), slot );
+
+  application.SendNotification();
+  application.Render();
+
+  // Nothing is uploaded until the end of the event processing.
+  textureTrace.Reset();
+  for( uint32_t i = 0u; i < 20u; ++i )
+  {
+    atlasManager.Add( CreateGlyph( 10u + i, 14u ), slot );
+  }
+  DALI_TEST_EQUALS( atlasManager.GetAtlasCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 0, TEST_LOCATION );
+
+  // The images added to the atlas are uploaded together.
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 1, TEST_LOCATION );
+
+  // Nothing more to upload.
+  textureTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliTextAtlasManagerUploadDuringRelayout(void)
+{
+  tet_infoline(" UtcDaliTextAtlasManagerUploadDuringRelayout");
+  ToolkitTestApplication application;
+
+  // Load some fonts.
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi( 96u, 96u );
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+
+  TraceCallStack& textureTrace = application.GetGlAbstraction().GetTextureTrace();
+  textureTrace.Enable( true );
+
+  TextLabel label = TextLabel::New();
+  label.SetProperty( DevelTextLabel::Property::RENDERING_BACKEND, DevelText::RENDERING_SHARED_ATLAS );
+  label.SetProperty( TextLabel::Property::FONT_FAMILY, "TizenSans" );
+  label.SetProperty( TextLabel::Property::TEXT, "Hello world" );
+  label.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 50.f ) );
+  application.GetScene().Add( label );
+
+  // The glyphs are added to the atlas during the relayout, after the processors have run,
+  // and are uploaded in the same frame.
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( textureTrace.CountMethod( "TexSubImage2D" ) > 0 );
+
+  // Nothing is left to upload in the next frame.
+  textureTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( textureTrace.CountMethod( "TexSubImage2D" ), 0, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <limits>
+#include <algorithm>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
@@ -1287,3 +1288,78 @@ int UtcDaliTextControllerDeleteSurroundings(void)
 
   END_TEST;
 }
+
+int UtcDaliTextControllerTextFitScaledGlyphs(void)
+{
+  tet_infoline(" UtcDaliTextControllerTextFitScaledGlyphs");
+  ToolkitTestApplication application;
+
+  const float minPointSize = 10.f;
+  const float maxPointSize = 40.f;
+  Size size( 300.f, 100.f );
+
+  // The glyphs of the first text are shaped once and scaled to the candidate point sizes.
+  // The second text has a run with its own font size, so it falls back to shaping at every candidate point size.
+  const std::string texts[] = { "Hello world, this is a multi-line text",
+                                "Hello <font size='12'>world</font>, this is a multi-line text" };
+
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    // Creates a text controller.
+    ControllerPtr controller = Controller::New();
+    ConfigureTextLabel( controller );
+    controller->SetMarkupProcessorEnabled( true );
+    controller->SetText( texts[i] );
+
+    controller->SetTextFitEnabled( true );
+    controller->SetTextFitMinSize( minPointSize, Controller::POINT_SIZE );
+    controller->SetTextFitMaxSize( maxPointSize, Controller::POINT_SIZE );
+    controller->SetTextFitStepSize( 1.f, Controller::POINT_SIZE );
+
+    controller->FitPointSizeforLayout( size );
+
+    const float fitPointSize = controller->GetTextFitPointSize();
+    Controller::Impl& mImpl = Controller::Impl::GetImplementation( *controller.Get() );
+    const uint32_t shapingCount = mImpl.mTextFitShapingCount;
+
+    if( 0u == i )
+    {
+      // Shaped at the biggest point size and at the found one, instead of at every candidate of the search.
+      DALI_TEST_CHECK( shapingCount >= 1u );
+      DALI_TEST_CHECK( shapingCount <= 3u );
+    }
+    else
+    {
+      DALI_TEST_CHECK( shapingCount > 3u );
+    }
+
+    // The point size is the biggest one at which the text shaped at that size fits.
+    float reshapedPointSize = minPointSize;
+    for( float pointSize = maxPointSize; pointSize > minPointSize; pointSize -= 1.f )
+    {
+      if( controller->CheckForTextFit( pointSize, size ) )
+      {
+        reshapedPointSize = pointSize;
+        break;
+      }
+    }
+
+    DALI_TEST_EQUALS( fitPointSize, reshapedPointSize, TEST_LOCATION );
+
+    // Estimates off by more than one step, above and below, find the same point size. The search
+    // checks the estimate and the next point size, then binary searches the 31 candidates.
+    const float estimates[] = { maxPointSize,
+                                std::min( reshapedPointSize + 5.f, maxPointSize ),
+                                std::max( reshapedPointSize - 5.f, minPointSize ),
+                                minPointSize };
+    for( unsigned int j = 0u; j < 4u; ++j )
+    {
+      DALI_TEST_EQUALS( controller->FindTextFitPointSize( estimates[j], size ), reshapedPointSize, TEST_LOCATION );
+      DALI_TEST_CHECK( mImpl.mTextFitShapingCount <= 7u );
+    }
+  }
+
+  tet_result(TET_PASS);
+
+  END_TEST;
+}
@@ -403,6 +403,62 @@ bool AlignTest( const AlignData& data )
   return true;
 }
 
+/**
+ * Lays out again the last paragraph of the text as the text controller does when text is appended.
+ */
+bool UpdateLastParagraphLayout( ModelPtr textModel, MetricsPtr metrics, const Size& textArea, LineIndex& startLineIndex )
+{
+  LogicalModelPtr logicalModel = textModel->mLogicalModel;
+  VisualModelPtr visualModel = textModel->mVisualModel;
+  Vector<LineRun>& lines = visualModel->mLines;
+
+  const ParagraphRun& lastParagraph = *( logicalModel->mParagraphInfo.End() - 1u );
+  const CharacterIndex startCharacterIndex = lastParagraph.characterRun.characterIndex;
+  const CharacterIndex lastCharacterIndex = logicalModel->mText.Count() - 1u;
+  const GlyphIndex startGlyphIndex = *( visualModel->mCharactersToGlyph.Begin() + startCharacterIndex );
+  const GlyphIndex lastGlyphIndex = visualModel->mGlyphs.Count() - 1u;
+
+  startLineIndex = lines.Count();
+  LineIndex endRemoveIndex = startLineIndex;
+  ClearGlyphRuns( startGlyphIndex,
+                  lastGlyphIndex,
+                  lines,
+                  startLineIndex,
+                  endRemoveIndex );
+  ClearCharacterRuns( startCharacterIndex,
+                      lastCharacterIndex,
+                      lines,
+                      startLineIndex,
+                      endRemoveIndex );
+  lines.Erase( lines.Begin() + startLineIndex,
+               lines.Begin() + endRemoveIndex );
+
+  Vector<Vector2>& glyphPositions = visualModel->mGlyphPositions;
+  glyphPositions.Erase( glyphPositions.Begin() + startGlyphIndex,
+                        glyphPositions.End() );
+
+  Layout::Engine engine;
+  engine.SetMetrics( metrics );
+  engine.SetLayout( Layout::Engine::MULTI_LINE_BOX );
+
+  Layout::Parameters layoutParameters( textArea,
+                                       textModel );
+  layoutParameters.startGlyphIndex = startGlyphIndex;
+  layoutParameters.numberOfGlyphs = lastGlyphIndex + 1u - startGlyphIndex;
+  layoutParameters.startLineIndex = startLineIndex;
+  layoutParameters.estimatedNumberOfLines = std::max( lines.Count(), logicalModel->mParagraphInfo.Count() );
+
+  Size layoutSize;
+  bool isAutoScroll = false;
+  const bool updated = engine.LayoutText( layoutParameters,
+                                          layoutSize,
+                                          false,
+                                          isAutoScroll );
+  visualModel->SetLayoutSize( layoutSize );
+
+  return updated;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////
@@ -424,6 +480,7 @@ bool AlignTest( const AlignData& data )
 // UtcDaliTextUpdateLayout01
 // UtcDaliTextUpdateLayout02
 // UtcDaliTextUpdateLayout03
+// UtcDaliTextUpdateLayoutAppend
 // UtcDaliTextLayoutEllipsis01
 // UtcDaliTextLayoutEllipsis02
 // UtcDaliTextLayoutEllipsis03
@@ -3222,6 +3279,109 @@ int UtcDaliTextUpdateLayout03(void)
   END_TEST;
 }
 
+int UtcDaliTextUpdateLayoutAppend(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextUpdateLayoutAppend");
+
+  // Layout a long text, then update the layout of its last paragraph as if text was appended.
+  // The lines before it are not laid-out again, nor traversed to update the layout size.
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi( 96u, 96u );
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+
+  std::string text;
+  for( unsigned int index = 0u; index < 100u; ++index )
+  {
+    text += "Hello world demo\n";
+  }
+  text += "Hello world demo hello world demo hello world demo";
+
+  const std::string fontFamily( "TizenSans" );
+
+  FontDescriptionRun fontDescriptionRun;
+  fontDescriptionRun.characterRun.characterIndex = 0u;
+  fontDescriptionRun.characterRun.numberOfCharacters = text.size();
+  fontDescriptionRun.familyLength = fontFamily.size();
+  fontDescriptionRun.familyName = new char[fontDescriptionRun.familyLength];
+  memcpy( fontDescriptionRun.familyName, fontFamily.c_str(), fontDescriptionRun.familyLength );
+  fontDescriptionRun.familyDefined = true;
+  fontDescriptionRun.weightDefined = false;
+  fontDescriptionRun.widthDefined = false;
+  fontDescriptionRun.slantDefined = false;
+  fontDescriptionRun.sizeDefined = false;
+
+  Vector<FontDescriptionRun> fontDescriptionRuns;
+  fontDescriptionRuns.PushBack( fontDescriptionRun );
+
+  const Size textArea( 100.f, 10000.f );
+
+  ModelPtr textModel;
+  MetricsPtr metrics;
+  Size layoutSize;
+
+  LayoutOptions options;
+  options.align = false;
+  CreateTextModel( text,
+                   textArea,
+                   fontDescriptionRuns,
+                   options,
+                   layoutSize,
+                   textModel,
+                   metrics,
+                   false );
+
+  VisualModelPtr visualModel = textModel->mVisualModel;
+
+  // Keep the layout from scratch to compare.
+  Vector<LineRun> expectedLines;
+  expectedLines.Insert( expectedLines.End(), visualModel->mLines.Begin(), visualModel->mLines.End() );
+  Vector<Vector2> expectedPositions;
+  expectedPositions.Insert( expectedPositions.End(), visualModel->mGlyphPositions.Begin(), visualModel->mGlyphPositions.End() );
+
+  // The last paragraph is laid-out in more than one line.
+  DALI_TEST_CHECK( expectedLines.Count() > 102u );
+
+  for( unsigned int update = 0u; update < 2u; ++update )
+  {
+    LineIndex startLineIndex = 0u;
+    DALI_TEST_CHECK( UpdateLastParagraphLayout( textModel, metrics, textArea, startLineIndex ) );
+    DALI_TEST_EQUALS( startLineIndex, 100u, TEST_LOCATION );
+
+    // Only the lines before the updated ones have their extent cached.
+    DALI_TEST_EQUALS( visualModel->mLinesExtents.Count(), startLineIndex, TEST_LOCATION );
+
+    DALI_TEST_EQUALS( visualModel->GetLayoutSize(), layoutSize, TEST_LOCATION );
+    DALI_TEST_EQUALS( visualModel->mLines.Count(), expectedLines.Count(), TEST_LOCATION );
+    for( unsigned int index = 0u; index < expectedLines.Count(); ++index )
+    {
+      const LineRun& line = visualModel->mLines[index];
+      const LineRun& expectedLine = expectedLines[index];
+
+      DALI_TEST_EQUALS( line.glyphRun.glyphIndex, expectedLine.glyphRun.glyphIndex, TEST_LOCATION );
+      DALI_TEST_EQUALS( line.glyphRun.numberOfGlyphs, expectedLine.glyphRun.numberOfGlyphs, TEST_LOCATION );
+      DALI_TEST_EQUALS( line.characterRun.characterIndex, expectedLine.characterRun.characterIndex, TEST_LOCATION );
+      DALI_TEST_EQUALS( line.characterRun.numberOfCharacters, expectedLine.characterRun.numberOfCharacters, TEST_LOCATION );
+      DALI_TEST_EQUALS( line.width, expectedLine.width, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+    }
+
+    DALI_TEST_EQUALS( visualModel->mGlyphPositions.Count(), expectedPositions.Count(), TEST_LOCATION );
+    for( unsigned int index = 0u; index < expectedPositions.Count(); ++index )
+    {
+      DALI_TEST_EQUALS( visualModel->mGlyphPositions[index], expectedPositions[index], Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+    }
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
 int UtcDaliTextLayoutEllipsis01(void)
 {
   ToolkitTestApplication application;
@@ -1873,3 +1873,70 @@ int UtcDaliTextMultiLanguageValidateFonts01(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextMultiLanguageValidateFonts02(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliTextMultiLanguageValidateFonts02");
+
+  // Validating the characters again, once they have been validated for their fonts, sets the same fonts.
+  MultilanguageSupport multilanguageSupport = MultilanguageSupport::Get();
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  const std::string text( "Hello world שלום עולם hello" );
+
+  Vector<Character> utf32;
+  utf32.Resize( text.size() );
+  const uint32_t numberOfCharacters = Utf8ToUtf32( reinterpret_cast<const uint8_t* const>( text.c_str() ),
+                                                   text.size(),
+                                                   &utf32[0u] );
+  utf32.Resize( numberOfCharacters );
+
+  Vector<ScriptRun> scripts;
+  multilanguageSupport.SetScripts( utf32,
+                                   0u,
+                                   numberOfCharacters,
+                                   scripts );
+
+  const FontId defaultFontId = fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+  TextAbstraction::FontDescription defaultFontDescription;
+  fontClient.GetDescription( defaultFontId, defaultFontDescription );
+  const TextAbstraction::PointSize26Dot6 defaultPointSize = fontClient.GetPointSize( defaultFontId );
+
+  const Vector<FontDescriptionRun> fontDescriptionRuns;
+
+  Vector<FontRun> fontRuns01;
+  multilanguageSupport.ValidateFonts( utf32,
+                                      scripts,
+                                      fontDescriptionRuns,
+                                      defaultFontDescription,
+                                      defaultPointSize,
+                                      0u,
+                                      numberOfCharacters,
+                                      fontRuns01 );
+
+  Vector<FontRun> fontRuns02;
+  multilanguageSupport.ValidateFonts( utf32,
+                                      scripts,
+                                      fontDescriptionRuns,
+                                      defaultFontDescription,
+                                      defaultPointSize,
+                                      0u,
+                                      numberOfCharacters,
+                                      fontRuns02 );
+
+  DALI_TEST_CHECK( 1u < fontRuns01.Count() );
+  DALI_TEST_EQUALS( fontRuns01.Count(), fontRuns02.Count(), TEST_LOCATION );
+  for( unsigned int index = 0u; index < fontRuns01.Count(); ++index )
+  {
+    DALI_TEST_EQUALS( fontRuns01[index].characterRun.characterIndex, fontRuns02[index].characterRun.characterIndex, TEST_LOCATION );
+    DALI_TEST_EQUALS( fontRuns01[index].characterRun.numberOfCharacters, fontRuns02[index].characterRun.numberOfCharacters, TEST_LOCATION );
+    DALI_TEST_EQUALS( fontRuns01[index].fontId, fontRuns02[index].fontId, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
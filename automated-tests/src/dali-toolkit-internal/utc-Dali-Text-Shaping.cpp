@@ -20,6 +20,7 @@
 #include <unistd.h>
 
 #include <dali-toolkit/internal/text/shaper.h>
+#include <dali-toolkit/internal/text/shaping-cache.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
@@ -957,3 +958,91 @@ int UtcDaliTextSoftwareStyling(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextShapingCache(void)
+{
+  tet_infoline(" UtcDaliTextShapingCache");
+  ToolkitTestApplication application;
+
+  ShapingCache* shapingCache = ShapingCache::Get();
+  DALI_TEST_CHECK( NULL != shapingCache );
+  shapingCache->Clear();
+
+  // Shapes the text when the model is created.
+  ModelPtr textModel;
+  MetricsPtr metrics;
+  Size layoutSize;
+
+  const Vector<FontDescriptionRun> fontDescriptions;
+  const LayoutOptions options;
+
+  CreateTextModel( "Hello world",
+                   Size( 100.f, 60.f ),
+                   fontDescriptions,
+                   options,
+                   layoutSize,
+                   textModel,
+                   metrics,
+                   false );
+
+  DALI_TEST_EQUALS( shapingCache->GetHitCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( shapingCache->GetMissCount(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( 0u != shapingCache->GetNumberOfGlyphs() );
+
+  LogicalModelPtr logicalModel = textModel->mLogicalModel;
+
+  Vector<GlyphInfo> cachedGlyphs;
+  Vector<CharacterIndex> cachedGlyphToCharacter;
+  Vector<Length> cachedCharactersPerGlyph;
+  Vector<GlyphIndex> newParagraphGlyphs;
+
+  // The same text is not shaped again.
+  ShapeText( logicalModel->mText,
+             logicalModel->mLineBreakInfo,
+             logicalModel->mScriptRuns,
+             logicalModel->mFontRuns,
+             0u,
+             0u,
+             logicalModel->mText.Count(),
+             cachedGlyphs,
+             cachedGlyphToCharacter,
+             cachedCharactersPerGlyph,
+             newParagraphGlyphs );
+
+  DALI_TEST_EQUALS( shapingCache->GetHitCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( shapingCache->GetMissCount(), 1u, TEST_LOCATION );
+
+  // The glyphs are the same as the shaped ones.
+  shapingCache->Clear();
+
+  Vector<GlyphInfo> glyphs;
+  Vector<CharacterIndex> glyphToCharacter;
+  Vector<Length> charactersPerGlyph;
+
+  ShapeText( logicalModel->mText,
+             logicalModel->mLineBreakInfo,
+             logicalModel->mScriptRuns,
+             logicalModel->mFontRuns,
+             0u,
+             0u,
+             logicalModel->mText.Count(),
+             glyphs,
+             glyphToCharacter,
+             charactersPerGlyph,
+             newParagraphGlyphs );
+
+  DALI_TEST_EQUALS( shapingCache->GetHitCount(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( shapingCache->GetMissCount(), 1u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( cachedGlyphs.Count(), glyphs.Count(), TEST_LOCATION );
+  for( unsigned int index = 0u; index < glyphs.Count(); ++index )
+  {
+    DALI_TEST_EQUALS( cachedGlyphs[index].fontId, glyphs[index].fontId, TEST_LOCATION );
+    DALI_TEST_EQUALS( cachedGlyphs[index].index, glyphs[index].index, TEST_LOCATION );
+    DALI_TEST_EQUALS( cachedGlyphs[index].advance, glyphs[index].advance, TEST_LOCATION );
+    DALI_TEST_EQUALS( cachedGlyphToCharacter[index], glyphToCharacter[index], TEST_LOCATION );
+    DALI_TEST_EQUALS( cachedCharactersPerGlyph[index], charactersPerGlyph[index], TEST_LOCATION );
+  }
+
+  END_TEST;
+}
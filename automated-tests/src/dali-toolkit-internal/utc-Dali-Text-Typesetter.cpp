@@ -19,12 +19,14 @@
 
 #include <stdlib.h>
 #include <limits>
+#include <vector>
 #include <unistd.h>
 
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
 #include <toolkit-text-utils.h>
 #include <dali-toolkit/internal/text/rendering/text-typesetter.h>
+#include <dali-toolkit/internal/text/rendering/text-typesetter-kernels.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali-toolkit/internal/text/text-controller.h>
 #include <dali-toolkit/devel-api/text/text-enumerations-devel.h>
@@ -248,3 +250,177 @@ int UtcDaliTextTypesetterBitmapFont(void)
   tet_result(TET_PASS);
   END_TEST;
 }
+
+int UtcDaliTextTypesetterRenderAllStyles(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterRenderAllStyles");
+  ToolkitTestApplication application;
+
+  // Load some fonts.
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char* pathNamePtr = get_current_dir_name();
+  const std::string pathName( pathNamePtr );
+  free( pathNamePtr );
+
+  fontClient.GetFontId( pathName + DEFAULT_FONT_DIR + "/tizen/TizenSansRegular.ttf" );
+
+  // Creates a text controller.
+  ControllerPtr controller = Controller::New();
+
+  // Configures the text controller similarly to the text-label.
+  ConfigureTextLabel( controller );
+
+  // Enables every style, so that all the layers are blended together.
+  controller->SetMarkupProcessorEnabled( true );
+  controller->SetText( "<font family='TizenSansRegular'>Hello world</font>" );
+  controller->SetShadowOffset( Vector2( 2.f, 2.f ) );
+  controller->SetShadowColor( Color::BLACK );
+  controller->SetShadowBlurRadius( 2.f );
+  controller->SetOutlineWidth( 1u );
+  controller->SetUnderlineEnabled( true );
+  controller->SetBackgroundColor( Color::BLUE );
+  controller->SetBackgroundEnabled( true );
+
+  const Size relayoutSize( 120.f, 60.f );
+  controller->Relayout( relayoutSize );
+
+  TypesetterPtr renderingController = Typesetter::New( controller->GetTextModel() );
+
+  PixelData bitmap = renderingController->Render( relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( 120u, bitmap.GetWidth(), TEST_LOCATION );
+  DALI_TEST_EQUALS( 60u, bitmap.GetHeight(), TEST_LOCATION );
+  DALI_TEST_EQUALS( Pixel::RGBA8888, bitmap.GetPixelFormat(), TEST_LOCATION );
+
+  // Renders the styles only.
+  bitmap = renderingController->Render( relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, Typesetter::RENDER_NO_TEXT );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( Pixel::RGBA8888, bitmap.GetPixelFormat(), TEST_LOCATION );
+
+  // Renders the text only, as an alpha image.
+  bitmap = renderingController->Render( relayoutSize, Toolkit::DevelText::TextDirection::LEFT_TO_RIGHT, Typesetter::RENDER_NO_STYLES, false, Pixel::L8 );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( Pixel::L8, bitmap.GetPixelFormat(), TEST_LOCATION );
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextTypesetterBlendUnder(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterBlendUnder");
+
+  // Odd pixel counts exercise both the vectorised loop and the remaining pixels.
+  const uint32_t numberOfPixels = 37u;
+  std::vector<uint8_t> source( 4u * numberOfPixels );
+  std::vector<uint8_t> destination( 4u * numberOfPixels );
+
+  for( uint32_t index = 0u; index < numberOfPixels; ++index )
+  {
+    // Premultiplied colors, including fully transparent and fully opaque ones.
+    const uint8_t sourceAlpha = static_cast<uint8_t>( ( index * 37u ) % 256u );
+    const uint8_t destinationAlpha = static_cast<uint8_t>( 255u - ( index * 11u ) % 256u );
+    for( uint32_t channel = 0u; channel < 3u; ++channel )
+    {
+      source[4u * index + channel] = static_cast<uint8_t>( sourceAlpha * ( channel + 1u ) / 4u );
+      destination[4u * index + channel] = static_cast<uint8_t>( destinationAlpha * ( 3u - channel ) / 4u );
+    }
+    source[4u * index + 3u] = ( index % 5u == 0u ) ? 0u : sourceAlpha;
+    destination[4u * index + 3u] = destinationAlpha;
+    if( index % 5u == 0u )
+    {
+      source[4u * index] = source[4u * index + 1u] = source[4u * index + 2u] = 0u;
+    }
+  }
+
+  // The destination is combined over the source as the pairwise blend of the layers does.
+  std::vector<uint8_t> expected( destination );
+  for( uint32_t index = 0u; index < 4u * numberOfPixels; ++index )
+  {
+    const uint32_t inverseAlpha = 255u - destination[4u * ( index / 4u ) + 3u];
+    expected[index] = static_cast<uint8_t>( destination[index] + source[index] * inverseAlpha / 255u );
+  }
+
+  BlendUnder( destination.data(), source.data(), numberOfPixels );
+
+  for( uint32_t index = 0u; index < 4u * numberOfPixels; ++index )
+  {
+    DALI_TEST_EQUALS( static_cast<uint32_t>( destination[index] ), static_cast<uint32_t>( expected[index] ), TEST_LOCATION );
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
+
+int UtcDaliTextTypesetterGlyphRowKernels(void)
+{
+  tet_infoline(" UtcDaliTextTypesetterGlyphRowKernels");
+
+  // Odd pixel counts exercise both the vectorised loop and the remaining pixels.
+  const uint32_t numberOfPixels = 37u;
+  const Vector4 color( 0.9f, 0.5f, 0.25f, 0.8f );
+
+  std::vector<uint8_t> glyph( 4u * numberOfPixels );
+  std::vector<uint8_t> destination( 4u * numberOfPixels );
+  for( uint32_t index = 0u; index < 4u * numberOfPixels; ++index )
+  {
+    // Include fully transparent glyph pixels.
+    glyph[index] = ( index % 7u == 0u ) ? 0u : static_cast<uint8_t>( ( index * 53u ) % 256u );
+    destination[index] = static_cast<uint8_t>( ( index * 29u ) % 256u );
+  }
+
+  // L8 glyph tinted into an RGBA8888 row.
+  {
+    std::vector<uint8_t> expected( destination );
+    for( uint32_t index = 0u; index < numberOfPixels; ++index )
+    {
+      if( glyph[index] > 0u )
+      {
+        const uint8_t currentAlpha = std::max( expected[4u * index + 3u], glyph[index] );
+        expected[4u * index] = static_cast<uint8_t>( color.r * currentAlpha );
+        expected[4u * index + 1u] = static_cast<uint8_t>( color.g * currentAlpha );
+        expected[4u * index + 2u] = static_cast<uint8_t>( color.b * currentAlpha );
+        expected[4u * index + 3u] = static_cast<uint8_t>( color.a * currentAlpha );
+      }
+    }
+
+    std::vector<uint8_t> result( destination );
+    TintGlyphRow( result.data(), glyph.data(), 1u, color, numberOfPixels );
+    DALI_TEST_CHECK( expected == result );
+  }
+
+  // BGRA8888 color glyph premultiplied into an RGBA8888 row.
+  {
+    std::vector<uint8_t> expected( 4u * numberOfPixels );
+    for( uint32_t index = 0u; index < numberOfPixels; ++index )
+    {
+      const uint8_t* pixel = glyph.data() + 4u * index;
+      const uint8_t colorAlpha = static_cast<uint8_t>( color.a * static_cast<float>( pixel[3] ) );
+      expected[4u * index] = static_cast<uint8_t>( pixel[2] * colorAlpha / 255u );
+      expected[4u * index + 1u] = static_cast<uint8_t>( pixel[1] * colorAlpha / 255u );
+      expected[4u * index + 2u] = static_cast<uint8_t>( pixel[0] * colorAlpha / 255u );
+      expected[4u * index + 3u] = colorAlpha;
+    }
+
+    std::vector<uint8_t> result( destination );
+    CompositeColorGlyphRow( result.data(), glyph.data(), color, false, true, false, numberOfPixels );
+    DALI_TEST_CHECK( expected == result );
+  }
+
+  // L8 glyph merged into an L8 row.
+  {
+    std::vector<uint8_t> expected( destination.begin(), destination.begin() + numberOfPixels );
+    for( uint32_t index = 0u; index < numberOfPixels; ++index )
+    {
+      expected[index] = std::max( expected[index], glyph[index] );
+    }
+
+    std::vector<uint8_t> result( destination.begin(), destination.begin() + numberOfPixels );
+    MaxBlendGlyphRow( result.data(), glyph.data(), 1u, numberOfPixels );
+    DALI_TEST_CHECK( expected == result );
+  }
+
+  tet_result(TET_PASS);
+  END_TEST;
+}
@@ -51,6 +51,7 @@ namespace
 {
 
 const char* TEST_IMAGE_FILE_NAME =  TEST_RESOURCE_DIR "/gallery-small-1.jpg";
+const char* TEST_IMAGE_FILE_NAME_2 =  TEST_RESOURCE_DIR "/icon-edit.png";
 
 }
 
@@ -278,3 +279,303 @@ int UtcTextureManagerUseInvalidMask(void)
 
   END_TEST;
 }
+
+int UtcTextureManagerCacheLookupAfterRemove(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcTextureManagerCacheLookupAfterRemove - Ensure removing a texture keeps the remaining ones reachable by id and by hash" );
+
+  TextureManager textureManager; // Create new texture manager
+
+  // One load per local loader thread, each with a distinct size so they are cached separately.
+  const uint32_t numberOfTextures = 4u;
+  std::string filename( TEST_IMAGE_FILE_NAME );
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+  TestObserver observers[numberOfTextures];
+  TextureManager::TextureId textureIds[numberOfTextures];
+
+  for( uint32_t i = 0u; i < numberOfTextures; ++i )
+  {
+    textureIds[i] = textureManager.RequestLoad(
+      filename,
+      ImageDimensions( 10u + i, 10u + i ),
+      FittingMode::SCALE_TO_FILL,
+      SamplingMode::BOX_THEN_LINEAR,
+      TextureManager::NO_ATLAS,
+      &observers[i],
+      true,
+      TextureManager::ReloadPolicy::CACHED,
+      preMultiply);
+  }
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( numberOfTextures ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  for( uint32_t i = 0u; i < numberOfTextures; ++i )
+  {
+    DALI_TEST_EQUALS( observers[i].mLoaded, true, TEST_LOCATION );
+    DALI_TEST_CHECK( textureManager.GetTextureState( textureIds[i] ) == TextureManager::LoadState::UPLOADED );
+  }
+
+  // Remove the first texture; the others must still be found.
+  textureManager.Remove( textureIds[0], &observers[0] );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureIds[0] ) == TextureManager::LoadState::NOT_STARTED );
+  DALI_TEST_CHECK( !textureManager.GetTextureSet( textureIds[0] ) );
+
+  for( uint32_t i = 1u; i < numberOfTextures; ++i )
+  {
+    DALI_TEST_CHECK( textureManager.GetTextureState( textureIds[i] ) == TextureManager::LoadState::UPLOADED );
+    DALI_TEST_CHECK( textureManager.GetTextureSet( textureIds[i] ) );
+    DALI_TEST_EQUALS( textureManager.GetVisualUrl( textureIds[i] ).GetUrl(), filename, TEST_LOCATION );
+  }
+
+  // Requesting a cached texture again returns the same id.
+  TestObserver cachedObserver;
+  TextureManager::TextureId cachedId = textureManager.RequestLoad(
+    filename,
+    ImageDimensions( 11u, 11u ),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &cachedObserver,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+  DALI_TEST_EQUALS( cachedId, textureIds[1], TEST_LOCATION );
+  DALI_TEST_EQUALS( cachedObserver.mLoaded, true, TEST_LOCATION );
+
+  // Requesting the removed texture again creates a new entry with a new id.
+  TestObserver reloadObserver;
+  TextureManager::TextureId reloadedId = textureManager.RequestLoad(
+    filename,
+    ImageDimensions( 10u, 10u ),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &reloadObserver,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+  DALI_TEST_CHECK( reloadedId != textureIds[0] );
+  DALI_TEST_CHECK( textureManager.GetTextureState( reloadedId ) == TextureManager::LoadState::LOADING );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureIds[0] ) == TextureManager::LoadState::NOT_STARTED );
+
+  for( uint32_t i = 1u; i < numberOfTextures; ++i )
+  {
+    DALI_TEST_CHECK( textureManager.GetTextureState( textureIds[i] ) == TextureManager::LoadState::UPLOADED );
+  }
+
+  END_TEST;
+}
+
+int UtcTextureManagerRetainUntilEvicted(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcTextureManagerRetainUntilEvicted - Ensure unreferenced textures are kept within the cache budget" );
+
+  TextureManager textureManager; // Create new texture manager
+  textureManager.SetCacheBudget( 64u * 1024u * 1024u );
+
+  TestObserver observer;
+  std::string filename( TEST_IMAGE_FILE_NAME );
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+  TextureManager::TextureId textureId = textureManager.RequestLoad(
+    filename,
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( observer.mLoaded, true, TEST_LOCATION );
+  const size_t memoryUsage = textureManager.GetCacheStatistics().memoryUsage;
+  DALI_TEST_CHECK( memoryUsage > 0u );
+
+  // The texture is kept after its last client removes it
+  textureManager.Remove( textureId, &observer );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId ) == TextureManager::LoadState::UPLOADED );
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().memoryUsage, memoryUsage, TEST_LOCATION );
+
+  // Requesting it again does not reload it
+  TestObserver observer2;
+  TextureManager::TextureId textureId2 = textureManager.RequestLoad(
+    filename,
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer2,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  DALI_TEST_EQUALS( textureId2, textureId, TEST_LOCATION );
+  DALI_TEST_EQUALS( observer2.mLoaded, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().hitCount, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().missCount, 1u, TEST_LOCATION );
+
+  // Once released again, lowering the budget evicts it
+  textureManager.Remove( textureId2, &observer2 );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId ) == TextureManager::LoadState::UPLOADED );
+
+  textureManager.SetCacheBudget( 1u );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId ) == TextureManager::LoadState::NOT_STARTED );
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().memoryUsage, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureManager.GetCacheStatistics().peakMemoryUsage, memoryUsage, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcTextureManagerEvictOnLoad(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcTextureManagerEvictOnLoad - Ensure loading a texture evicts the oldest unreferenced ones beyond the cache budget" );
+
+  TextureManager textureManager; // Create new texture manager
+  textureManager.SetCacheBudget( 64u * 1024u * 1024u );
+
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+
+  // The oldest texture is the biggest, so evicting it is enough to fit the new one
+  TestObserver observer1;
+  TextureManager::TextureId textureId1 = textureManager.RequestLoad(
+    std::string( TEST_IMAGE_FILE_NAME ),
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer1,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  TestObserver observer2;
+  TextureManager::TextureId textureId2 = textureManager.RequestLoad(
+    std::string( TEST_IMAGE_FILE_NAME ),
+    ImageDimensions( 16u, 16u ),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer2,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( observer1.mLoaded, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( observer2.mLoaded, true, TEST_LOCATION );
+
+  // Both are retained, and fill the budget
+  textureManager.Remove( textureId1, &observer1 );
+  textureManager.Remove( textureId2, &observer2 );
+  const size_t memoryUsage = textureManager.GetCacheStatistics().memoryUsage;
+  textureManager.SetCacheBudget( memoryUsage );
+
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId1 ) == TextureManager::LoadState::UPLOADED );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId2 ) == TextureManager::LoadState::UPLOADED );
+
+  // Loading another texture goes beyond the budget, so the oldest retained one is evicted
+  TestObserver observer3;
+  TextureManager::TextureId textureId3 = textureManager.RequestLoad(
+    std::string( TEST_IMAGE_FILE_NAME_2 ),
+    ImageDimensions( 16u, 16u ),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer3,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( observer3.mLoaded, true, TEST_LOCATION );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId3 ) == TextureManager::LoadState::UPLOADED );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId1 ) == TextureManager::LoadState::NOT_STARTED );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId2 ) == TextureManager::LoadState::UPLOADED );
+  DALI_TEST_CHECK( textureManager.GetCacheStatistics().memoryUsage <= memoryUsage );
+
+  END_TEST;
+}
+
+int UtcTextureManagerLoadPriority(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcTextureManagerLoadPriority - Ensure the time to upload is only recorded for loads of high priority" );
+
+  TextureManager textureManager; // Create new texture manager
+
+  TestObserver observer1;
+  TestObserver observer2;
+  auto preMultiply = TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY;
+  TextureManager::TextureId textureId1 = textureManager.RequestLoad(
+    std::string( TEST_IMAGE_FILE_NAME ),
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer1,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+  TextureManager::TextureId textureId2 = textureManager.RequestLoad(
+    std::string( TEST_IMAGE_FILE_NAME_2 ),
+    ImageDimensions(),
+    FittingMode::SCALE_TO_FILL,
+    SamplingMode::BOX_THEN_LINEAR,
+    TextureManager::NO_ATLAS,
+    &observer2,
+    true,
+    TextureManager::ReloadPolicy::CACHED,
+    preMultiply);
+
+  // The second image is not needed first, e.g. it is not on the scene.
+  textureManager.SetLoadPriority( textureId2, DevelAsyncImageLoader::LoadPriority::LOW );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId1 ) == TextureManager::LoadState::LOADING );
+  DALI_TEST_CHECK( textureManager.GetTextureState( textureId2 ) == TextureManager::LoadState::LOADING );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 2 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( observer1.mLoaded, true, TEST_LOCATION );
+  DALI_TEST_EQUALS( observer2.mLoaded, true, TEST_LOCATION );
+
+  const Dali::Toolkit::TextureManager::CacheStatistics& statistics = textureManager.GetCacheStatistics();
+  DALI_TEST_EQUALS( statistics.visibleLoadCount, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( statistics.visibleLoadTime >= statistics.maxVisibleLoadTime );
+
+  END_TEST;
+}
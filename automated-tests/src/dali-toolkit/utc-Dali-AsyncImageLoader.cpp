@@ -21,6 +21,8 @@
 #include <dali-toolkit-test-suite-utils.h>
 #include <toolkit-event-thread-callback.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
+#include <dali-toolkit/devel-api/utility/worker-pool.h>
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -276,3 +278,76 @@ int UtcDaliAsyncImageLoaderCancelAll(void)
 
   END_TEST;
 }
+
+int UtcDaliAsyncImageLoaderSetLoadPriority(void)
+{
+  ToolkitTestApplication application;
+
+  AsyncImageLoader loader = AsyncImageLoader::New();
+  ImageLoadedSignalVerifier loadedSignalVerifier;
+
+  loader.ImageLoadedSignal().Connect( &loadedSignalVerifier, &ImageLoadedSignalVerifier::ImageLoaded );
+
+  uint32_t id01 = loader.Load( gImage_34_RGBA, ImageDimensions( 34, 34 ) );
+  uint32_t id02 = loader.Load( gImage_50_RGBA, ImageDimensions( 25, 25 ) );
+  uint32_t id03 = loader.Load( gImage_128_RGB, ImageDimensions( 100, 100 ), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true );
+
+  // The first task may already be loading, so it is not checked whether the priority has changed.
+  DevelAsyncImageLoader::SetLoadPriority( loader, id01, DevelAsyncImageLoader::LoadPriority::LOW );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 3 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  // Every task is still loaded.
+  DALI_TEST_CHECK( loadedSignalVerifier.LoadedImageCount() == 3 );
+  DALI_TEST_CHECK( loadedSignalVerifier.Verify( id01, 34, 34 ) );
+  DALI_TEST_CHECK( loadedSignalVerifier.Verify( id02, 25, 25 ) );
+  DALI_TEST_CHECK( loadedSignalVerifier.Verify( id03, 100, 100 ) );
+
+  // Cannot change the priority of a task which is already loaded.
+  DALI_TEST_CHECK( !DevelAsyncImageLoader::SetLoadPriority( loader, id01, DevelAsyncImageLoader::LoadPriority::HIGH ) );
+
+  END_TEST;
+}
+
+int UtcDaliAsyncImageLoaderWorkerPoolStatistics(void)
+{
+  ToolkitTestApplication application;
+
+  DALI_TEST_CHECK( WorkerPool::GetNumberOfThreads() > 0u );
+
+  WorkerPool::Statistics before = WorkerPool::GetStatistics( WorkerPool::Subsystem::IMAGE_LOADING );
+
+  AsyncImageLoader loader = AsyncImageLoader::New();
+  ImageLoadedSignalVerifier loadedSignalVerifier;
+
+  loader.ImageLoadedSignal().Connect( &loadedSignalVerifier, &ImageLoadedSignalVerifier::ImageLoaded );
+
+  loader.Load( gImage_34_RGBA );
+  loader.Load( gImage_50_RGBA, ImageDimensions( 25, 25 ) );
+  loader.Load( gImage_128_RGB, ImageDimensions( 100, 100 ) );
+
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 3 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( loadedSignalVerifier.LoadedImageCount() == 3 );
+
+  // Deleting the loader waits for the task being processed, so all of them are accounted for.
+  loader.Reset();
+
+  WorkerPool::Statistics after = WorkerPool::GetStatistics( WorkerPool::Subsystem::IMAGE_LOADING );
+  DALI_TEST_EQUALS( after.processedCount - before.processedCount, 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( after.queueDepth, 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( after.totalLatency >= before.totalLatency );
+  DALI_TEST_CHECK( after.maxLatency >= before.maxLatency );
+
+  // Nothing was rasterized.
+  WorkerPool::Statistics svg = WorkerPool::GetStatistics( WorkerPool::Subsystem::SVG_RASTERIZATION );
+  DALI_TEST_EQUALS( svg.queueDepth, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
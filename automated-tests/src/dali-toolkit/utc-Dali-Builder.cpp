@@ -1618,6 +1618,58 @@ int UtcDaliBuilderMappingCycleCheck(void)
   END_TEST;
 }
 
+int UtcDaliBuilderApplyStyleToManyControls(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "Test a style is found ignoring case and applied to each control it is recorded for" );
+
+  std::string json(
+    "{"
+      "\"styles\":"
+      "{"
+        "\"MyControl\":"
+        "{"
+          "\"opacity\":0.5,"
+          "\"visuals\":"
+          "{"
+            "\"background\":"
+            "{"
+              "\"visualType\":\"COLOR\","
+              "\"mixColor\":[1,0,0,1]"
+            "}"
+          "}"
+        "}"
+      "}"
+    "}"
+  );
+
+  Builder builder = Builder::New();
+  builder.LoadFromString( json );
+
+  for( int i = 0; i < 2; ++i )
+  {
+    Control control = Control::New();
+    DALI_TEST_CHECK( builder.ApplyStyle( "mycontrol", control ) );
+
+    DALI_TEST_EQUALS( control.GetProperty< float >( Actor::Property::OPACITY ), 0.5f, TEST_LOCATION );
+    Property::Map* background = control.GetProperty( Control::Property::BACKGROUND ).GetMap();
+    DALI_TEST_CHECK( background );
+    Property::Value* mixColor = background->Find( Visual::Property::MIX_COLOR );
+    DALI_TEST_CHECK( mixColor );
+    DALI_TEST_EQUALS( mixColor->Get< Vector4 >(), Color::RED, TEST_LOCATION );
+  }
+
+  Control control = Control::New();
+  DALI_TEST_CHECK( !builder.ApplyStyle( "OtherControl", control ) );
+
+  // The styles loaded later are found too
+  builder.LoadFromString( "{ \"styles\": { \"otherControl\": { \"opacity\":0.25 } } }" );
+  DALI_TEST_CHECK( builder.ApplyStyle( "OtherControl", control ) );
+  DALI_TEST_EQUALS( control.GetProperty< float >( Actor::Property::OPACITY ), 0.25f, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliBuilderTypeCasts(void)
 {
   ToolkitTestApplication application;
@@ -1076,6 +1076,12 @@ int UtcDaliControlResourcesReady02(void)
   application.SendNotification();
   application.Render();
 
+  // The svg background is loaded in the worker thread
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
   DALI_TEST_EQUALS( control.IsResourceReady(), true, TEST_LOCATION );
   DALI_TEST_EQUALS( gResourceReadySignalFired, true, TEST_LOCATION );
   gResourceReadySignalFired = false;
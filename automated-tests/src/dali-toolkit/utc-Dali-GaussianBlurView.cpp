@@ -224,7 +224,8 @@ int UtcDaliGaussianBlurActivateDeactivateRepeat(void)
   application.SendNotification();
   application.Render(20);
 
-  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 6 );
+  // The render targets released by the deactivation are reused
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 3 );
 
   END_TEST;
 }
@@ -321,7 +322,8 @@ int UtcDaliGaussianBlurActivateOnce2(void)
   application.SendNotification();
   application.Render(20);
 
-  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 6 );
+  // The render targets released by the deactivation are reused
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 3 );
 
   END_TEST;
 }
@@ -353,3 +355,48 @@ int UtcDaliGaussianBlurViewFinishedSignalN(void)
 
   END_TEST;
 }
+
+int UtcDaliGaussianBlurViewDualFilter(void)
+{
+  ToolkitTestApplication application;
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  tet_infoline("UtcDaliGaussianBlurViewDualFilter");
+
+  Toolkit::GaussianBlurView view = Toolkit::GaussianBlurView::New();
+  DALI_TEST_CHECK( view );
+  DALI_TEST_EQUALS( view.GetDualFilterLevels(), 0u, TEST_LOCATION );
+
+  view.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+  view.SetProperty( Actor::Property::SIZE, application.GetScene().GetSize());
+  view.Add(Actor::New());
+  application.GetScene().Add(view);
+  view.Activate();
+
+  application.SendNotification();
+  application.Render(20);
+
+  // The children, the horizontal and vertical blurs and the composite
+  RenderTaskList taskList = application.GetScene().GetRenderTaskList();
+  DALI_TEST_EQUALS( taskList.GetTaskCount(), 5u, TEST_LOCATION );
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 3 );
+
+  // Switching the filter reallocates the passes
+  view.SetDualFilterLevels( 3u );
+  DALI_TEST_EQUALS( view.GetDualFilterLevels(), 3u, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render(20);
+
+  // The first level replaces the horizontal and vertical blurs, the two further levels each downsample and upsample
+  // The render targets of the children and of the vertical blur are reused, the three levels are smaller
+  DALI_TEST_EQUALS( taskList.GetTaskCount(), 9u, TEST_LOCATION );
+  DALI_TEST_CHECK( gl.GetLastGenTextureId() == 6 );
+
+  view.SetDualFilterLevels( 0u );
+  DALI_TEST_EQUALS( taskList.GetTaskCount(), 5u, TEST_LOCATION );
+
+  view.Deactivate();
+  DALI_TEST_EQUALS( taskList.GetTaskCount(), 1u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -2553,12 +2553,19 @@ int UtcDaliImageViewAsyncSVGLoading(void)
     application.GetScene().Add( imageView );
     DALI_TEST_CHECK( imageView );
 
+    application.SendNotification();
+    application.Render(16);
+
+    // The svg is loaded in the worker thread
+    DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
     application.SendNotification();
     application.Render(16);
     Vector3 naturalSize = imageView.GetNaturalSize();
 
     DALI_TEST_EQUALS( naturalSize.width, 100.0f, TEST_LOCATION );
     DALI_TEST_EQUALS( naturalSize.height, 100.0f, TEST_LOCATION );
+    DALI_TEST_EQUALS( imageView.IsResourceReady(), true, TEST_LOCATION );
   }
   END_TEST;
 }
@@ -2592,6 +2599,12 @@ int UtcDaliImageViewSVGLoadingSyncSetInvalidValue(void)
     application.GetScene().Add( imageView );
     DALI_TEST_CHECK( imageView );
 
+    application.SendNotification();
+    application.Render(16);
+
+    // The svg is loaded in the worker thread
+    DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
     application.SendNotification();
     application.Render(16);
     Vector3 naturalSize = imageView.GetNaturalSize();
@@ -2761,7 +2774,7 @@ void OnResourceReadySignal( Control control )
   }
   else if(control.GetVisualResourceStatus(ImageView::Property::IMAGE) == Visual::ResourceStatus::FAILED)
   {
-    // Make the resource ready immediately
+    // Make the resource ready once the svg is loaded
     control[ImageView::Property::IMAGE] = TEST_RESOURCE_DIR "/svg1.svg";
   }
 }
@@ -2815,6 +2828,12 @@ int UtcDaliImageViewSetImageOnResourceReadySignal01(void)
   // Run idle callback
   application.RunIdles();
 
+  // The svg is loaded in the worker thread
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
   DALI_TEST_EQUALS( gResourceReadySignalCounter, 2, TEST_LOCATION );
 
   DALI_TEST_EQUALS( imageView.IsResourceReady(), true, TEST_LOCATION );
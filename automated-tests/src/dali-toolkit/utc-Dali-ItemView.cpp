@@ -23,6 +23,7 @@
 // test harness headers before dali headers.
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-factory-devel.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -146,6 +147,68 @@ public: // From ItemFactory
   }
 };
 
+// Implementation of ItemFactory which lets ItemView reuse the actors of two types of items
+class TestRecyclingItemFactory : public ItemFactory, public ItemFactory::Extension
+{
+public:
+
+  TestRecyclingItemFactory()
+  : mNumNewItems( 0 ),
+    mNumRecycledItems( 0 ),
+    mNumMismatchedTypes( 0 )
+  {
+  }
+
+public: // From ItemFactory
+
+  virtual unsigned int GetNumberOfItems()
+  {
+    return TOTAL_ITEM_NUMBER;
+  }
+
+  virtual Actor NewItem(unsigned int itemId)
+  {
+    ++mNumNewItems;
+    Actor actor = Actor::New();
+    actor.SetProperty( Actor::Property::NAME, GetTypeName( itemId ) );
+    return actor;
+  }
+
+  virtual Extension* GetExtension()
+  {
+    return this;
+  }
+
+public: // From ItemFactory::Extension
+
+  virtual unsigned int GetItemType( unsigned int itemId )
+  {
+    return itemId % 2;
+  }
+
+  virtual void RecycleItem( unsigned int itemId, Actor actor )
+  {
+    ++mNumRecycledItems;
+    if( actor.GetProperty< std::string >( Actor::Property::NAME ) != GetTypeName( itemId ) )
+    {
+      ++mNumMismatchedTypes;
+    }
+  }
+
+private:
+
+  std::string GetTypeName( unsigned int itemId )
+  {
+    return GetItemType( itemId ) ? "odd" : "even";
+  }
+
+public:
+
+  unsigned int mNumNewItems;
+  unsigned int mNumRecycledItems;
+  unsigned int mNumMismatchedTypes;
+};
+
 } // namespace
 
 
@@ -1367,3 +1430,94 @@ int UtcDaliItemViewWheelEvent(void)
 
   END_TEST;
 }
+
+int UtcDaliItemViewRecycleItems(void)
+{
+  ToolkitTestApplication application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestRecyclingItemFactory factory;
+  ItemView view = ItemView::New( factory );
+
+  // Create a grid layout and add it to ItemView
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New( DefaultItemLayout::GRID );
+  view.AddLayout( *gridLayout );
+  stage.Add( view );
+
+  // Activate the grid layout so that the items will be created and added to ItemView
+  Vector3 stageSize( stage.GetSize() );
+  view.ActivateLayout( 0, stageSize, 0.0f );
+
+  application.SendNotification();
+  application.Render(0);
+
+  const unsigned int numItems = view.GetChildCount();
+  DALI_TEST_CHECK( factory.mNumNewItems > 0u );
+  DALI_TEST_EQUALS( factory.mNumRecycledItems, 0u, TEST_LOCATION );
+
+  // All of the released actors are reused for the same items.
+  const unsigned int numNewItems = factory.mNumNewItems;
+  view.Refresh();
+
+  DALI_TEST_EQUALS( factory.mNumNewItems, numNewItems, TEST_LOCATION );
+  DALI_TEST_EQUALS( factory.mNumRecycledItems, numNewItems, TEST_LOCATION );
+  DALI_TEST_EQUALS( view.GetChildCount(), numItems, TEST_LOCATION );
+
+  // Items further away reuse the actors of the same type.
+  view.ScrollToItem( TOTAL_ITEM_NUMBER - 1, 0.0f );
+
+  application.SendNotification();
+  application.Render(0);
+
+  view.Refresh();
+
+  DALI_TEST_CHECK( view.GetItem( TOTAL_ITEM_NUMBER - 1 ) );
+  DALI_TEST_CHECK( factory.mNumRecycledItems > numNewItems );
+  DALI_TEST_EQUALS( factory.mNumMismatchedTypes, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliItemViewRecycleItemsAfterInsertAndRemove(void)
+{
+  ToolkitTestApplication application;
+  Dali::Integration::Scene stage = application.GetScene();
+
+  // Create the ItemView actor
+  TestRecyclingItemFactory factory;
+  ItemView view = ItemView::New( factory );
+
+  // Create a grid layout and add it to ItemView
+  ItemLayoutPtr gridLayout = DefaultItemLayout::New( DefaultItemLayout::GRID );
+  view.AddLayout( *gridLayout );
+  stage.Add( view );
+
+  // Activate the grid layout so that the items will be created and added to ItemView
+  Vector3 stageSize( stage.GetSize() );
+  view.ActivateLayout( 0, stageSize, 0.0f );
+
+  application.SendNotification();
+  application.Render(0);
+
+  // Shift the actors of the factory by inserting and removing actors it did not make.
+  for( unsigned int i = 0u; i < 10u; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty( Actor::Property::NAME, "inserted" );
+    view.InsertItem( Item( 1u, actor ), 0.0f );
+    view.RemoveItem( 2u, 0.0f );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  // Only the actors of the factory are reused, each for an item of its type.
+  view.Refresh();
+  view.Refresh();
+
+  DALI_TEST_CHECK( factory.mNumRecycledItems > 0u );
+  DALI_TEST_EQUALS( factory.mNumMismatchedTypes, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <dali-toolkit-test-suite-utils.h>
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/scroll-view-devel.h>
 #include <dali/integration-api/events/touch-event-integ.h>
 #include <dali/integration-api/events/wheel-event-integ.h>
 
@@ -3098,3 +3099,139 @@ int UtcDaliToolkitScrollViewWheelEvent(void)
 
   END_TEST;
 }
+
+int UtcDaliToolkitScrollViewCulling(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCulling");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  scrollView.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+  scrollView.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add( scrollView );
+
+  // A row of 10 pages, each the size of the view
+  std::vector< Actor > pages;
+  for( int i = 0; i < 10; ++i )
+  {
+    Actor page = Actor::New();
+    page.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    page.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+    page.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+    page.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+    page.SetProperty( Actor::Property::POSITION, Vector2( i * 100.0f, 0.0f ) );
+    scrollView.Add( page );
+    pages.push_back( page );
+  }
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< bool >( DevelScrollView::Property::CULLING_ENABLED ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 10, TEST_LOCATION );
+
+  // Pages within the margin are kept, those beyond twice the margin are culled
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 50.0f );
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_ENABLED, true );
+  Wait( application );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< float >( DevelScrollView::Property::CULLING_MARGIN ), 50.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 8, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[1].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[2].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // Pages 4 to 6 are within the margin
+  scrollView.ScrollTo( Vector2( 500.0f, 0.0f ), 0.0f );
+  Wait( application, RENDER_DELAY_SCROLL );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 3, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[0].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[4].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[6].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  // Page 4 is beyond the margin, but kept until beyond twice the margin
+  scrollView.ScrollTo( Vector2( 560.0f, 0.0f ), 0.0f );
+  Wait( application, RENDER_DELAY_SCROLL );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 4, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[4].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[7].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  scrollView.ScrollTo( Vector2( 610.0f, 0.0f ), 0.0f );
+  Wait( application, RENDER_DELAY_SCROLL );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 3, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[4].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // A page hidden by the application is not culled, nor shown again
+  pages[6].SetProperty( Actor::Property::VISIBLE, false );
+  scrollView.ScrollTo( Vector2( 0.0f, 0.0f ), 0.0f );
+  Wait( application, RENDER_DELAY_SCROLL );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 7, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[0].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[6].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // A culled page removed from the scroll view is shown again
+  scrollView.Remove( pages[9] );
+  DALI_TEST_EQUALS( pages[9].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 6, TEST_LOCATION );
+
+  // Disabling the culling shows all the culled pages again
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_ENABLED, false );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 8, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[2].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliToolkitScrollViewCullingVisibilityChanged(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitScrollViewCullingVisibilityChanged");
+
+  ScrollView scrollView = ScrollView::New();
+  scrollView.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+  scrollView.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+  scrollView.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+  scrollView.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+  application.GetScene().Add( scrollView );
+
+  std::vector< Actor > pages;
+  for( int i = 0; i < 4; ++i )
+  {
+    Actor page = Actor::New();
+    page.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+    page.SetProperty( Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT );
+    page.SetResizePolicy( ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS );
+    page.SetProperty( Actor::Property::SIZE, Vector2( 100.0f, 100.0f ) );
+    page.SetProperty( Actor::Property::POSITION, Vector2( i * 100.0f, 0.0f ) );
+    scrollView.Add( page );
+    pages.push_back( page );
+  }
+
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_MARGIN, 50.0f );
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_ENABLED, true );
+  Wait( application );
+
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[3].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  // A culled page shown by the application is no longer counted as culled
+  pages[3].SetProperty( Actor::Property::VISIBLE, true );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 1, TEST_LOCATION );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::VISIBLE_CHILD_COUNT ), 3, TEST_LOCATION );
+
+  // Hidden again by the application, it is not shown when the culling is disabled
+  pages[3].SetProperty( Actor::Property::VISIBLE, false );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 1, TEST_LOCATION );
+
+  scrollView.SetProperty( DevelScrollView::Property::CULLING_ENABLED, false );
+  DALI_TEST_EQUALS( scrollView.GetProperty< int >( DevelScrollView::Property::CULLED_CHILD_COUNT ), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[2].GetProperty< bool >( Actor::Property::VISIBLE ), true, TEST_LOCATION );
+  DALI_TEST_EQUALS( pages[3].GetProperty< bool >( Actor::Property::VISIBLE ), false, TEST_LOCATION );
+
+  END_TEST;
+}
@@ -405,3 +405,69 @@ int UtcDaliSuperBlurViewBlurSignal(void)
 
   END_TEST;
 }
+
+int UtcDaliSuperBlurViewPyramid(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliSuperBlurViewPyramid ");
+
+  SuperBlurView blurView = SuperBlurView::New( BLUR_LEVELS );
+  DALI_TEST_EQUALS( blurView.GetProperty<bool>( SuperBlurView::Property::PYRAMID ), false, TEST_LOCATION );
+
+  blurView.SetProperty( SuperBlurView::Property::PYRAMID, true );
+  DALI_TEST_EQUALS( blurView.GetProperty<bool>( SuperBlurView::Property::PYRAMID ), true, TEST_LOCATION );
+
+  blurView.SetProperty( Actor::Property::SIZE, Vector2(100.0f, 100.0f) );
+  Texture inputTexture = CreateSolidColorTexture( application, Color::GREEN, 100, 100 );
+  blurView.SetTexture( inputTexture );
+
+  // each level is a single render task
+  DALI_TEST_EQUALS( application.GetScene().GetRenderTaskList().GetTaskCount(), 1u+BLUR_LEVELS, TEST_LOCATION );
+
+  application.GetScene().Add( blurView );
+  Wait(application, 200);
+  DALI_TEST_EQUALS(blurView.GetRendererCount(), BLUR_LEVELS+1, TEST_LOCATION );
+
+  Texture texture2 = blurView.GetBlurredTexture( 2 );
+  DALI_TEST_EQUALS( texture2.GetWidth(), 25u, TEST_LOCATION );
+  DALI_TEST_EQUALS( texture2.GetHeight(), 25u, TEST_LOCATION );
+
+  // switching back blurs the texture again, with two render tasks per level
+  blurView.SetProperty( SuperBlurView::Property::PYRAMID, false );
+  DALI_TEST_EQUALS( application.GetScene().GetRenderTaskList().GetTaskCount(), 1u+BLUR_LEVELS*2, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliSuperBlurViewPyramidTextures(void)
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliSuperBlurViewPyramidTextures - test that the pyramid needs no intermediate render targets ");
+
+  TraceCallStack& textureTrace = application.GetGlAbstraction().GetTextureTrace();
+  textureTrace.Enable( true );
+
+  int textureCount[2];
+  for( int pyramid = 0; pyramid < 2; ++pyramid )
+  {
+    textureTrace.Reset();
+
+    SuperBlurView blurView = SuperBlurView::New( BLUR_LEVELS );
+    blurView.SetProperty( SuperBlurView::Property::PYRAMID, pyramid == 1 );
+    blurView.SetProperty( Actor::Property::SIZE, Vector2(100.0f, 100.0f) );
+    blurView.SetTexture( CreateSolidColorTexture( application, Color::GREEN, 100, 100 ) );
+
+    application.GetScene().Add( blurView );
+    Wait(application, 200);
+
+    textureCount[pyramid] = textureTrace.CountMethod( "GenTextures" );
+    application.GetScene().Remove( blurView );
+  }
+
+  DALI_TEST_CHECK( textureCount[1] > 0 );
+  DALI_TEST_CHECK( textureCount[1] < textureCount[0] );
+
+  END_TEST;
+}
@@ -1629,6 +1629,47 @@ int UtcDaliToolkitTextlabelTextFit(void)
   END_TEST;
 }
 
+int UtcDaliToolkitTextlabelTextFitMultiLine(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline(" UtcDaliToolkitTextlabelTextFitMultiLine");
+
+  const Vector2 size( 300.0f, 100.0f );
+
+  Property::Map textFitMapSet;
+  textFitMapSet["enable"] = true;
+  textFitMapSet["minSize"] = 10.f;
+  textFitMapSet["maxSize"] = 100.f;
+  textFitMapSet["stepSize"] = 1.f;
+  textFitMapSet["fontSizeType"] = "pointSize";
+
+  // The glyphs of the first label are shaped once and scaled to the candidate point sizes.
+  // The second label has a run with its own font size, so it's shaped at every candidate point size.
+  TextLabel scaledLabel = TextLabel::New();
+  scaledLabel.SetProperty( Actor::Property::SIZE, size );
+  scaledLabel.SetProperty( TextLabel::Property::MULTI_LINE, true );
+  scaledLabel.SetProperty( TextLabel::Property::TEXT, "Hello world, this is a multi-line text" );
+  scaledLabel.SetProperty( Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet );
+  application.GetScene().Add( scaledLabel );
+
+  TextLabel shapedLabel = TextLabel::New();
+  shapedLabel.SetProperty( Actor::Property::SIZE, size );
+  shapedLabel.SetProperty( TextLabel::Property::MULTI_LINE, true );
+  shapedLabel.SetProperty( TextLabel::Property::ENABLE_MARKUP, true );
+  shapedLabel.SetProperty( TextLabel::Property::TEXT, "Hello <font size='12'>world</font>, this is a multi-line text" );
+  shapedLabel.SetProperty( Toolkit::DevelTextLabel::Property::TEXT_FIT, textFitMapSet );
+  application.GetScene().Add( shapedLabel );
+
+  application.SendNotification();
+  application.Render();
+
+  // The text laid out at the found point size fits in the label.
+  DALI_TEST_CHECK( scaledLabel.GetHeightForWidth( size.width ) <= size.height );
+  DALI_TEST_CHECK( shapedLabel.GetHeightForWidth( size.width ) <= size.height );
+
+  END_TEST;
+}
+
 int UtcDaliToolkitTextlabelMaxTextureSet(void)
 {
   ToolkitTestApplication application;
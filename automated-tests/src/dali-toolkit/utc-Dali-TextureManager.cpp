@@ -151,3 +151,22 @@ int UtcDaliTextureManagerRemoveN(void)
 
   END_TEST;
 }
+
+int UtcDaliTextureManagerCacheBudget(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliTextureManagerCacheBudget" );
+
+  DALI_TEST_EQUALS( TextureManager::GetCacheBudget(), 0u, TEST_LOCATION );
+
+  TextureManager::SetCacheBudget( 1024u * 1024u );
+  DALI_TEST_EQUALS( TextureManager::GetCacheBudget(), 1024u * 1024u, TEST_LOCATION );
+
+  TextureManager::SetCacheBudget( 0u );
+  DALI_TEST_EQUALS( TextureManager::GetCacheBudget(), 0u, TEST_LOCATION );
+
+  TextureManager::CacheStatistics statistics = TextureManager::GetCacheStatistics();
+  DALI_TEST_CHECK( statistics.peakMemoryUsage >= statistics.memoryUsage );
+
+  END_TEST;
+}
@@ -336,8 +336,20 @@ int UtcDaliVisualSize(void)
   animatedGradientVisual.SetTransformAndSize(DefaultTransform(), controlSize );
   DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
 
-  // svg visual
+  // svg visual, whose natural size is known once the svg is loaded
   Visual::Base svgVisual = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  svgVisual.GetNaturalSize(naturalSize);
+  DALI_TEST_EQUALS( naturalSize, Vector2::ZERO, TEST_LOCATION );
+
+  DummyControl svgControl = DummyControl::New( true );
+  Impl::DummyControl& svgControlImpl = static_cast< Impl::DummyControl& >( svgControl.GetImplementation() );
+  svgControlImpl.RegisterVisual( DummyControl::Property::TEST_VISUAL, svgVisual );
+  application.GetScene().Add( svgControl );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
   svgVisual.GetNaturalSize(naturalSize);
   // TEST_SVG_FILE:
   //  <svg width="100" height="100">
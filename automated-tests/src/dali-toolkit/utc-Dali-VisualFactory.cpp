@@ -1330,6 +1330,76 @@ int UtcDaliVisualFactoryGetSvgVisualAtlas(void)
   END_TEST;
 }
 
+int UtcDaliVisualFactoryGetSvgVisualShared(void)
+{
+  ToolkitTestApplication application;
+  tet_infoline( "UtcDaliVisualFactoryGetSvgVisualShared: Request svg visuals with the same url and size" );
+
+  VisualFactory factory = VisualFactory::Get();
+  Visual::Base visual1 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  Visual::Base visual2 = factory.CreateVisual( TEST_SVG_FILE_NAME, ImageDimensions() );
+  DALI_TEST_CHECK( visual1 );
+  DALI_TEST_CHECK( visual2 );
+
+  // The second visual uses the document parsed for the first one
+  Vector2 naturalSize;
+  visual2.GetNaturalSize( naturalSize );
+  DALI_TEST_EQUALS( naturalSize, Vector2( 100.f, 100.f ), TEST_LOCATION );
+
+  TestGlAbstraction& gl = application.GetGlAbstraction();
+  TraceCallStack& textureTrace = gl.GetTextureTrace();
+  textureTrace.Enable(true);
+
+  DummyControl actor1 = DummyControl::New(true);
+  DummyControlImpl& dummyImpl1 = static_cast<DummyControlImpl&>(actor1.GetImplementation());
+  dummyImpl1.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual1 );
+  actor1.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( actor1 );
+  visual1.SetTransformAndSize(DefaultTransform(), Vector2(200.f, 200.f) );
+
+  DummyControl actor2 = DummyControl::New(true);
+  DummyControlImpl& dummyImpl2 = static_cast<DummyControlImpl&>(actor2.GetImplementation());
+  dummyImpl2.RegisterVisual( DummyControl::Property::TEST_VISUAL, visual2 );
+  actor2.SetProperty( Actor::Property::SIZE, Vector2( 200.f, 200.f ) );
+  application.GetScene().Add( actor2 );
+  visual2.SetTransformAndSize(DefaultTransform(), Vector2(200.f, 200.f) );
+
+  // A single rasterization completes both visuals.
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  DALI_TEST_CHECK( actor1.GetRendererCount() == 1u );
+  DALI_TEST_CHECK( actor2.GetRendererCount() == 1u );
+
+  Texture texture1 = actor1.GetRendererAt( 0 ).GetTextures().GetTexture( 0 );
+  Texture texture2 = actor2.GetRendererAt( 0 ).GetTextures().GetTexture( 0 );
+  DALI_TEST_CHECK( texture1 );
+  DALI_TEST_CHECK( texture1 == texture2 );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( textureTrace.CountMethod("GenTextures"), 1, TEST_LOCATION );
+
+  // A visual of another size needs its own rasterization
+  visual2.SetTransformAndSize(DefaultTransform(), Vector2(100.f, 100.f) );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( Test::WaitForEventThreadTrigger( 1 ), true, TEST_LOCATION );
+
+  application.SendNotification();
+  application.Render();
+
+  texture2 = actor2.GetRendererAt( 0 ).GetTextures().GetTexture( 0 );
+  DALI_TEST_CHECK( texture1 != texture2 );
+  DALI_TEST_EQUALS( texture2.GetWidth(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( textureTrace.CountMethod("GenTextures"), 2, TEST_LOCATION );
+
+  END_TEST;
+}
+
 //Creates a mesh visual from the given propertyMap and tries to load it on stage in the given application.
 //This is expected to succeed, which will then pass the test.
 void MeshVisualLoadsCorrectlyTest( Property::Map& propertyMap, ToolkitTestApplication& application )
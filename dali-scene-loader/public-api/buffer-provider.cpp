@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/buffer-provider.h"
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <fstream>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Dali
+{
+namespace SceneLoader
+{
+
+BinaryBuffer::BinaryBuffer(const std::string& path)
+{
+#if !defined(_WIN32)
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) == 0)
+  {
+    mSize = static_cast<size_t>(fileStat.st_size);
+    if (mSize == 0)
+    {
+      mValid = true;
+    }
+    else
+    {
+      void* mapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED)
+      {
+        mData = static_cast<const uint8_t*>(mapping);
+        mValid = mMapped = true;
+      }
+    }
+  }
+  close(fd);
+
+  if (mValid)
+  {
+    return;
+  }
+#endif
+
+  // Read the whole file in one go instead.
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    return;
+  }
+
+  mContents.resize(static_cast<size_t>(file.tellg()));
+  if (file.seekg(0, std::ios::beg) && file.read(reinterpret_cast<char*>(mContents.data()), mContents.size()))
+  {
+    mData = mContents.data();
+    mSize = mContents.size();
+    mValid = true;
+  }
+}
+
+BinaryBuffer::~BinaryBuffer()
+{
+#if !defined(_WIN32)
+  if (mMapped)
+  {
+    munmap(const_cast<uint8_t*>(mData), mSize);
+  }
+#endif
+}
+
+bool BinaryBuffer::Read(size_t offset, size_t length, uint8_t* target) const
+{
+  if (offset > mSize || length > mSize - offset)
+  {
+    return false;
+  }
+
+  memcpy(target, mData + offset, length);
+  return true;
+}
+
+bool BinaryBuffer::ReadStrided(size_t offset, uint32_t count, uint32_t stride, uint32_t elementSize, uint8_t* target) const
+{
+  if (count == 0)
+  {
+    return true;
+  }
+
+  const size_t lastElementOffset = offset + static_cast<size_t>(count - 1) * stride;
+  if (offset > mSize || lastElementOffset > mSize || elementSize > mSize - lastElementOffset)
+  {
+    return false;
+  }
+
+  const uint8_t* source = mData + offset;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    memcpy(target, source, elementSize);
+    source += stride;
+    target += elementSize;
+  }
+  return true;
+}
+
+BufferProvider::BufferPtr BufferProvider::Get(const std::string& path)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto& buffer = mBuffers[path];
+  if (!buffer)
+  {
+    auto newBuffer = std::make_shared<BinaryBuffer>(path);
+    if (!newBuffer->IsValid())
+    {
+      mBuffers.erase(path);
+      return nullptr;
+    }
+    buffer = std::move(newBuffer);
+  }
+  return buffer;
+}
+
+}
+}
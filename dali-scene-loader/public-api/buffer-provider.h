@@ -0,0 +1,129 @@
+#ifndef DALI_SCENE_LOADER_BUFFER_PROVIDER_H
+#define DALI_SCENE_LOADER_BUFFER_PROVIDER_H
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/api.h"
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+namespace SceneLoader
+{
+
+/**
+ * @brief The read-only contents of a binary file. The file is memory mapped where
+ *  the platform supports it, and read into memory otherwise.
+ */
+class DALI_SCENE_LOADER_API BinaryBuffer
+{
+public:
+  /**
+   * @brief Maps the file at @a path. Use IsValid() to tell whether this has succeeded.
+   */
+  explicit BinaryBuffer(const std::string& path);
+
+  ~BinaryBuffer();
+
+  BinaryBuffer(const BinaryBuffer&) = delete;
+  BinaryBuffer& operator=(const BinaryBuffer&) = delete;
+
+  /**
+   * @return Whether the file could be opened and mapped.
+   */
+  bool IsValid() const
+  {
+    return mValid;
+  }
+
+  /**
+   * @return The contents of the file.
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @return The size of the file in bytes.
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  /**
+   * @brief Copies @a length bytes from @a offset into @a target, which must have
+   *  at least @a length bytes.
+   * @return Whether the requested range was inside the buffer. Nothing is copied if it wasn't.
+   */
+  bool Read(size_t offset, size_t length, uint8_t* target) const;
+
+  /**
+   * @brief Copies @a count elements of @a elementSize bytes, which follow each other
+   *  @a stride bytes apart from @a offset, tightly packed into @a target.
+   * @return Whether all the elements were inside the buffer. Nothing is copied if they weren't.
+   */
+  bool ReadStrided(size_t offset, uint32_t count, uint32_t stride, uint32_t elementSize, uint8_t* target) const;
+
+private:
+  const uint8_t* mData = nullptr;
+  size_t mSize = 0;
+  bool mValid = false;
+  bool mMapped = false;
+  std::vector<uint8_t> mContents; // used if the file couldn't be mapped.
+};
+
+/**
+ * @brief Provides the contents of binary files, mapping each of them only once for
+ *  the lifetime of the provider, so that loading several meshes and animations from
+ *  the same file doesn't open it over and over again.
+ * @note Get() may be called from multiple threads.
+ */
+class DALI_SCENE_LOADER_API BufferProvider
+{
+public:
+  using BufferPtr = std::shared_ptr<const BinaryBuffer>;
+
+  BufferProvider() = default;
+
+  BufferProvider(const BufferProvider&) = delete;
+  BufferProvider& operator=(const BufferProvider&) = delete;
+
+  /**
+   * @return The buffer with the contents of the file at @a path, or nullptr if the
+   *  file couldn't be opened.
+   */
+  BufferPtr Get(const std::string& path);
+
+private:
+  std::mutex mMutex;
+  std::unordered_map<std::string, BufferPtr> mBuffers;
+};
+
+}
+}
+
+#endif //DALI_SCENE_LOADER_BUFFER_PROVIDER_H
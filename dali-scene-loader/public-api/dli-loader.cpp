@@ -23,6 +23,7 @@
 #include "dali/devel-api/common/map-wrapper.h"
 #include "dali-toolkit/devel-api/builder/json-parser.h"
 #include "dali/integration-api/debug.h"
+#include <cstring>
 #include <fstream>
 #include <limits>
 #include <algorithm>
@@ -30,6 +31,7 @@
 #include <cmath>
 
 // INTERNAL INCLUDES
+#include "dali-scene-loader/public-api/buffer-provider.h"
 #include "dali-scene-loader/public-api/parse-renderer-state.h"
 #include "dali-scene-loader/public-api/skinning-details.h"
 #include "dali-scene-loader/public-api/load-result.h"
@@ -1381,6 +1383,8 @@ void DliLoader::Impl::ParseAnimations(const TreeNode* tnAnimations, LoadParams&
   auto& definitions = params.output.mAnimationDefinitions;
   definitions.reserve(definitions.size() + tnAnimations->Size());
 
+  BufferProvider animationBuffers;  // the key frames of many properties are commonly in the same file.
+
   for (TreeNode::ConstIterator iAnim = tnAnimations->CBegin(), iAnimEnd = tnAnimations->CEnd();
     iAnim != iAnimEnd; ++iAnim)
   {
@@ -1490,13 +1494,13 @@ void DliLoader::Impl::ParseAnimations(const TreeNode* tnAnimations, LoadParams&
         {
           DALI_ASSERT_ALWAYS(!animProp.mPropertyName.empty() && "Animation must specify a property name");
 
-          std::ifstream binAniFile;
+          BufferProvider::BufferPtr binAniFile;
           std::string animationFilename;
           if (ReadString(tnKeyFramesBin->GetChild(URL), animationFilename))
           {
             std::string animationFullPath = params.input.mAnimationsPath + animationFilename;
-            binAniFile.open(animationFullPath, std::ios::binary);
-            if (binAniFile.fail())
+            binAniFile = animationBuffers.Get(animationFullPath);
+            if (!binAniFile)
             {
               ExceptionFlinger(ASSERT_LOCATION) << "Failed to open animation data '" <<
                 animationFullPath << "'";
@@ -1507,8 +1511,6 @@ void DliLoader::Impl::ParseAnimations(const TreeNode* tnAnimations, LoadParams&
           ReadInt(tnKeyFramesBin->GetChild("byteOffset"), byteOffset);
           DALI_ASSERT_ALWAYS(byteOffset >= 0);
 
-          binAniFile.seekg(byteOffset, std::ios::beg);
-
           int numKeys = 0;
           ReadInt(tnKeyFramesBin->GetChild("numKeys"), numKeys);
           DALI_ASSERT_ALWAYS(numKeys >= 0);
@@ -1520,45 +1522,50 @@ void DliLoader::Impl::ParseAnimations(const TreeNode* tnAnimations, LoadParams&
           // otherwise are blend shape weight keys.
           // TODO support for binary header with size information
           Property::Type propType = Property::FLOAT;  // assume blend shape weights
+          uint32_t numValueComponents = 1u;
           if (animProp.mPropertyName == "orientation")
           {
             propType = Property::VECTOR4;
+            numValueComponents = 4u;
           }
           else if ((animProp.mPropertyName == "position") || (animProp.mPropertyName == "scale"))
           {
             propType = Property::VECTOR3;
+            numValueComponents = 3u;
           }
 
-          //alphafunction is reserved for future implementation
+          // Each key is the progress, the value, and a byte that is reserved for the alpha function.
           // NOTE: right now we're just using AlphaFunction::LINEAR.
-          unsigned char dummyAlphaFunction;
+          const uint32_t keySize = sizeof(float) * (1u + numValueComponents) + sizeof(unsigned char);
+          std::vector<uint8_t> keysBuffer(keySize * numKeys);
+          if (numKeys > 0 && !(binAniFile && binAniFile->Read(byteOffset, keysBuffer.size(), keysBuffer.data())))
+          {
+            ExceptionFlinger(ASSERT_LOCATION) << "Failed to read key frames of animation '" << animDef.mName << "'";
+          }
 
           float progress;
+          float value[4];
           Property::Value propValue;
-          for (int key = 0; key < numKeys; key++)
+          const uint8_t* key = keysBuffer.data();
+          for (int i = 0; i < numKeys; ++i)
           {
-            binAniFile.read(reinterpret_cast<char*>(&progress), sizeof(float));
+            memcpy(&progress, key, sizeof(float));
+            memcpy(value, key + sizeof(float), sizeof(float) * numValueComponents);
+            key += keySize;
+
             if (propType == Property::VECTOR3)
             {
-              Vector3 value;
-              binAniFile.read(reinterpret_cast<char*>(value.AsFloat()), sizeof(float) * 3);
-              propValue = Property::Value(value);
+              propValue = Property::Value(Vector3(value));
             }
             else if (propType == Property::VECTOR4)
             {
-              Vector4 value;
-              binAniFile.read(reinterpret_cast<char*>(value.AsFloat()), sizeof(float) * 4);
-              propValue = Property::Value(Quaternion(value));
+              propValue = Property::Value(Quaternion(Vector4(value)));
             }
             else
             {
-              float value;
-              binAniFile.read(reinterpret_cast<char*>(&value), sizeof(float));
-              propValue = Property::Value(value);
+              propValue = Property::Value(value[0]);
             }
 
-            binAniFile.read(reinterpret_cast<char*>(&dummyAlphaFunction), sizeof(unsigned char));
-
             animProp.mKeyFrames.Add(progress, propValue, AlphaFunction::LINEAR);
           }
         }
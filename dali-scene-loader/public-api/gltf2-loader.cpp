@@ -18,11 +18,12 @@
 #include "dali-scene-loader/public-api/scene-definition.h"
 #include "dali-scene-loader/public-api/resource-bundle.h"
 #include "dali-scene-loader/public-api/gltf2-loader.h"
+#include "dali-scene-loader/public-api/buffer-provider.h"
 #include "dali-scene-loader/public-api/utils.h"
 #include "dali-scene-loader/public-api/shader-definition-factory.h"
 #include "dali-scene-loader/internal/gltf2-asset.h"
 #include "dali/public-api/math/quaternion.h"
-#include <fstream>
+#include <cstring>
 
 #define ENUM_STRING_MAPPING(t, x) { #x, t::x }
 
@@ -40,6 +41,20 @@ const std::string ORIENTATION_PROPERTY("orientation");
 const std::string SCALE_PROPERTY("scale");
 const std::string BLEND_SHAPE_WEIGHTS_UNIFORM("uBlendShapeWeight");
 
+constexpr uint32_t GLB_MAGIC = 0x46546C67;  // "glTF"
+constexpr uint32_t GLB_VERSION = 2;
+constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A;  // "JSON"
+constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+constexpr size_t GLB_HEADER_SIZE = 3 * sizeof(uint32_t);  // magic, version, length
+constexpr size_t GLB_CHUNK_HEADER_SIZE = 2 * sizeof(uint32_t);  // length, type
+
+///@brief The location of a chunk in a .glb file.
+struct GlbChunk
+{
+  size_t mOffset = 0;
+  size_t mLength = 0;
+};
+
 const Geometry::Type GLTF2_TO_DALI_PRIMITIVES[]{
   Geometry::POINTS,
   Geometry::LINES,
@@ -81,6 +96,13 @@ std::vector<gt::Animation> ReadAnimationArray(const json_value_s& j)
   return results;
 }
 
+uint32_t ReadUint32(const uint8_t* data)
+{
+  uint32_t value;  // .glb is little endian, like all of our targets.
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
 void ApplyAccessorMinMax(const gt::Accessor& acc, float* values)
 {
   DALI_ASSERT_ALWAYS(acc.mMax.empty() || gt::AccessorType::ElementCount(acc.mType) == acc.mMax.size());
@@ -390,6 +412,8 @@ struct ConversionContext
 
   std::vector<Index>  mMeshIds;
   NodeIndexMapper mNodeIndices;
+
+  BufferProvider mBuffers;  // maps each of the .bin files only once.
 };
 
 SamplerFlags::Type ConvertWrapMode(gt::Wrap::Type w)
@@ -430,7 +454,18 @@ SamplerFlags::Type ConvertSampler(const gt::Ref<gt::Sampler>& s)
 
 TextureDefinition ConvertTextureInfo(const gt::TextureInfo& mm)
 {
-  return TextureDefinition{ std::string(mm.mTexture->mSource->mUri), ConvertSampler(mm.mTexture->mSampler) };
+  auto& image = *mm.mTexture->mSource;
+  if (image.mBufferView)
+  {
+    // Embedded image; it's decoded from the buffer that holds it, when the material is loaded.
+    auto& bufferView = *image.mBufferView;
+    TextureDefinition texture{ std::string(bufferView.mBuffer->mUri), ConvertSampler(mm.mTexture->mSampler) };
+    texture.mImageOffset = bufferView.mByteOffset;
+    texture.mImageLength = bufferView.mByteLength;
+    return texture;
+  }
+
+  return TextureDefinition{ std::string(image.mUri), ConvertSampler(mm.mTexture->mSampler) };
 }
 
 void ConvertMaterial(const gt::Material& m, decltype(ResourceBundle::mMaterials)& outMaterials)
@@ -841,22 +876,17 @@ void ConvertNodes(const gt::Document& doc, ConversionContext& cctx)
 }
 
 template <typename T>
-void LoadDataFromAccessor(const std::string& path, Vector<T>& dataBuffer, uint32_t offset, uint32_t size)
+void LoadDataFromAccessor(BufferProvider& buffers, const std::string& path, Vector<T>& dataBuffer, uint32_t offset, uint32_t size)
 {
-  std::ifstream animationBinaryFile(path, std::ifstream::binary);
-
-  if (!animationBinaryFile.is_open())
+  auto buffer = buffers.Get(path);
+  if (!buffer || !buffer->Read(offset, size, reinterpret_cast<uint8_t*>(dataBuffer.Begin())))
   {
     throw std::runtime_error("Failed to load " + path);
   }
-
-  animationBinaryFile.seekg(offset);
-  animationBinaryFile.read(reinterpret_cast<char*>(dataBuffer.Begin()), size);
-  animationBinaryFile.close();
 }
 
 template <typename T>
-float LoadDataFromAccessors(const std::string& path, const gltf2::Accessor& input, const gltf2::Accessor& output, Vector<float>& inputDataBuffer, Vector<T>& outputDataBuffer)
+float LoadDataFromAccessors(ConversionContext& cctx, const gltf2::Accessor& input, const gltf2::Accessor& output, Vector<float>& inputDataBuffer, Vector<T>& outputDataBuffer)
 {
   inputDataBuffer.Resize(input.mCount);
   outputDataBuffer.Resize(output.mCount);
@@ -864,9 +894,9 @@ float LoadDataFromAccessors(const std::string& path, const gltf2::Accessor& inpu
   const uint32_t inputDataBufferSize = input.GetBytesLength();
   const uint32_t outputDataBufferSize = output.GetBytesLength();
 
-  LoadDataFromAccessor<float>(path + std::string(input.mBufferView->mBuffer->mUri), inputDataBuffer,
+  LoadDataFromAccessor<float>(cctx.mBuffers, cctx.mPath + std::string(input.mBufferView->mBuffer->mUri), inputDataBuffer,
     input.mBufferView->mByteOffset + input.mByteOffset, inputDataBufferSize);
-  LoadDataFromAccessor<T>(path + std::string(output.mBufferView->mBuffer->mUri), outputDataBuffer,
+  LoadDataFromAccessor<T>(cctx.mBuffers, cctx.mPath + std::string(output.mBufferView->mBuffer->mUri), outputDataBuffer,
     output.mBufferView->mByteOffset + output.mByteOffset, outputDataBufferSize);
   ApplyAccessorMinMax(output, reinterpret_cast<float*>(outputDataBuffer.begin()));
 
@@ -874,7 +904,7 @@ float LoadDataFromAccessors(const std::string& path, const gltf2::Accessor& inpu
 }
 
 template<typename T>
-float LoadKeyFrames(const std::string& path, const gt::Animation::Channel& channel, KeyFrames& keyFrames, gt::Animation::Channel::Target::Type type)
+float LoadKeyFrames(ConversionContext& cctx, const gt::Animation::Channel& channel, KeyFrames& keyFrames, gt::Animation::Channel::Target::Type type)
 {
   const gltf2::Accessor& input = *channel.mSampler->mInput;
   const gltf2::Accessor& output = *channel.mSampler->mOutput;
@@ -882,7 +912,7 @@ float LoadKeyFrames(const std::string& path, const gt::Animation::Channel& chann
   Vector<float> inputDataBuffer;
   Vector<T> outputDataBuffer;
 
-  const float duration = LoadDataFromAccessors<T>(path, input, output, inputDataBuffer, outputDataBuffer);
+  const float duration = LoadDataFromAccessors<T>(cctx, input, output, inputDataBuffer, outputDataBuffer);
 
   for (uint32_t i = 0; i < input.mCount; ++i)
   {
@@ -892,7 +922,7 @@ float LoadKeyFrames(const std::string& path, const gt::Animation::Channel& chann
   return duration;
 }
 
-float LoadBlendShapeKeyFrames(const std::string& path, const gt::Animation::Channel& channel, const std::string& nodeName, uint32_t& propertyIndex, std::vector<SceneLoader::AnimatedProperty>& properties)
+float LoadBlendShapeKeyFrames(ConversionContext& cctx, const gt::Animation::Channel& channel, const std::string& nodeName, uint32_t& propertyIndex, std::vector<SceneLoader::AnimatedProperty>& properties)
 {
   const gltf2::Accessor& input = *channel.mSampler->mInput;
   const gltf2::Accessor& output = *channel.mSampler->mOutput;
@@ -900,7 +930,7 @@ float LoadBlendShapeKeyFrames(const std::string& path, const gt::Animation::Chan
   Vector<float> inputDataBuffer;
   Vector<float> outputDataBuffer;
 
-  const float duration = LoadDataFromAccessors<float>(path, input, output, inputDataBuffer, outputDataBuffer);
+  const float duration = LoadDataFromAccessors<float>(cctx, input, output, inputDataBuffer, outputDataBuffer);
 
   char weightNameBuffer[32];
   auto prefixSize = snprintf(weightNameBuffer, sizeof(weightNameBuffer), "%s[", BLEND_SHAPE_WEIGHTS_UNIFORM.c_str());
@@ -975,7 +1005,7 @@ void ConvertAnimations(const gt::Document& doc, ConversionContext& cctx)
           animatedProperty.mPropertyName = POSITION_PROPERTY;
 
           animatedProperty.mKeyFrames = KeyFrames::New();
-          duration = LoadKeyFrames<Vector3>(cctx.mPath, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
+          duration = LoadKeyFrames<Vector3>(cctx, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
 
           animatedProperty.mTimePeriod = { 0.f, duration };
           break;
@@ -988,7 +1018,7 @@ void ConvertAnimations(const gt::Document& doc, ConversionContext& cctx)
           animatedProperty.mPropertyName = ORIENTATION_PROPERTY;
 
           animatedProperty.mKeyFrames = KeyFrames::New();
-          duration = LoadKeyFrames<Quaternion>(cctx.mPath, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
+          duration = LoadKeyFrames<Quaternion>(cctx, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
 
           animatedProperty.mTimePeriod = { 0.f, duration };
           break;
@@ -1001,14 +1031,14 @@ void ConvertAnimations(const gt::Document& doc, ConversionContext& cctx)
           animatedProperty.mPropertyName = SCALE_PROPERTY;
 
           animatedProperty.mKeyFrames = KeyFrames::New();
-          duration = LoadKeyFrames<Vector3>(cctx.mPath, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
+          duration = LoadKeyFrames<Vector3>(cctx, channel, animatedProperty.mKeyFrames, channel.mTarget.mPath);
 
           animatedProperty.mTimePeriod = { 0.f, duration };
           break;
         }
         case gt::Animation::Channel::Target::WEIGHTS:
         {
-          duration = LoadBlendShapeKeyFrames(cctx.mPath, channel, nodeName, propertyIndex, animationDef.mProperties);
+          duration = LoadBlendShapeKeyFrames(cctx, channel, nodeName, propertyIndex, animationDef.mProperties);
 
           break;
         }
@@ -1041,22 +1071,23 @@ void ProcessSkins(const gt::Document& doc, ConversionContext& cctx)
 
   struct InverseBindMatrixAccessor : public IInverseBindMatrixProvider
   {
-    std::ifstream mStream;
+    BufferProvider::BufferPtr mBuffer;
+    uint32_t mOffset;
     const uint32_t mElementSizeBytes;
 
-    InverseBindMatrixAccessor(const gt::Accessor& accessor, const std::string& path)
-    : mStream(path + std::string(accessor.mBufferView->mBuffer->mUri), std::ios::binary),
+    InverseBindMatrixAccessor(const gt::Accessor& accessor, const std::string& path, BufferProvider& buffers)
+    : mBuffer(buffers.Get(path + std::string(accessor.mBufferView->mBuffer->mUri))),
+      mOffset(accessor.mBufferView->mByteOffset + accessor.mByteOffset),
       mElementSizeBytes(accessor.GetElementSizeBytes())
     {
-      DALI_ASSERT_ALWAYS(mStream);
+      DALI_ASSERT_ALWAYS(mBuffer);
       DALI_ASSERT_DEBUG(accessor.mType == gt::AccessorType::MAT4 && accessor.mComponentType == gt::Component::FLOAT);
-
-      mStream.seekg(accessor.mBufferView->mByteOffset + accessor.mByteOffset);
     }
 
     virtual void Provide(Matrix& ibm) override
     {
-      DALI_ASSERT_ALWAYS(mStream.read(reinterpret_cast<char*>(ibm.AsFloat()), mElementSizeBytes));
+      DALI_ASSERT_ALWAYS(mBuffer->Read(mOffset, mElementSizeBytes, reinterpret_cast<uint8_t*>(ibm.AsFloat())));
+      mOffset += mElementSizeBytes;
     }
   };
 
@@ -1076,7 +1107,7 @@ void ProcessSkins(const gt::Document& doc, ConversionContext& cctx)
     std::unique_ptr<IInverseBindMatrixProvider> ibmProvider;
     if (s.mInverseBindMatrices)
     {
-      ibmProvider.reset(new InverseBindMatrixAccessor(*s.mInverseBindMatrices, cctx.mPath));
+      ibmProvider.reset(new InverseBindMatrixAccessor(*s.mInverseBindMatrices, cctx.mPath, cctx.mBuffers));
     }
     else
     {
@@ -1116,6 +1147,86 @@ void ProduceShaders(ShaderDefinitionFactory& shaderFactory, SceneDefinition& sce
   }
 }
 
+/**
+ * @brief Finds the JSON and BIN chunks of a binary glTF.
+ * @return Whether @a buffer holds a binary glTF; if not, @a json and @a bin are left untouched.
+ *  The length of the BIN chunk is 0 if there was none.
+ * @throw std::runtime_error if the header or the chunks are malformed.
+ */
+bool ReadGlbChunks(const BinaryBuffer& buffer, GlbChunk& json, GlbChunk& bin)
+{
+  const uint8_t* data = buffer.GetData();
+  if (buffer.GetSize() < GLB_HEADER_SIZE || ReadUint32(data) != GLB_MAGIC)
+  {
+    return false;
+  }
+
+  if (ReadUint32(data + sizeof(uint32_t)) != GLB_VERSION)
+  {
+    throw std::runtime_error("Unsupported .glb version.");
+  }
+
+  const size_t length = std::min(static_cast<size_t>(ReadUint32(data + 2 * sizeof(uint32_t))), buffer.GetSize());
+  json = GlbChunk{};
+  bin = GlbChunk{};
+
+  // The JSON chunk must come first; the BIN chunk, if any, second. Any other chunks are ignored.
+  size_t offset = GLB_HEADER_SIZE;
+  uint32_t chunkIndex = 0;
+  while (offset + GLB_CHUNK_HEADER_SIZE <= length)
+  {
+    const uint32_t chunkLength = ReadUint32(data + offset);
+    const uint32_t chunkType = ReadUint32(data + offset + sizeof(uint32_t));
+    offset += GLB_CHUNK_HEADER_SIZE;
+    if (chunkLength > length - offset)
+    {
+      throw std::runtime_error("Invalid .glb chunk length.");
+    }
+
+    if (chunkIndex == 0 && chunkType == GLB_CHUNK_JSON)
+    {
+      json = GlbChunk{ offset, chunkLength };
+    }
+    else if (chunkIndex == 1 && chunkType == GLB_CHUNK_BIN)
+    {
+      bin = GlbChunk{ offset, chunkLength };
+    }
+
+    offset += (chunkLength + 3) & ~3u;  // chunks are 4-byte aligned.
+    ++chunkIndex;
+  }
+  return true;
+}
+
+/**
+ * @brief Points the buffer that refers to the BIN chunk of a .glb, i.e. the first one if it
+ *  has no uri, at the .glb file itself, and offsets its buffer views to the chunk, so that
+ *  meshes, animations, skins and embedded images read it directly from the .glb.
+ * @throw std::runtime_error if there is such a buffer but no BIN chunk, or it's too short.
+ */
+void ResolveGlbBuffer(gt::Document& doc, const std::string& glbUri, const GlbChunk& bin)
+{
+  if (doc.mBuffers.empty() || !doc.mBuffers[0].mUri.empty())
+  {
+    return;
+  }
+
+  auto& buffer = doc.mBuffers[0];
+  if (bin.mLength < buffer.mByteLength)
+  {
+    throw std::runtime_error("Missing or short .glb BIN chunk.");
+  }
+
+  buffer.mUri = glbUri;
+  for (auto& bufferView : doc.mBufferViews)
+  {
+    if (bufferView.mBuffer.GetIndex() == 0)
+    {
+      bufferView.mByteOffset += static_cast<uint32_t>(bin.mOffset);
+    }
+  }
+}
+
 void SetObjectReaders()
 {
   js::SetObjectReader(BUFFER_READER);
@@ -1148,14 +1259,26 @@ void SetObjectReaders()
 
 void LoadGltfScene(const std::string& url, ShaderDefinitionFactory& shaderFactory, LoadResult& params)
 {
-  bool failed = false;
-  auto js = LoadTextFile(url.c_str(), &failed);
-  if (failed)
+  auto path = url.substr(0, url.rfind('/') + 1);
+  ConversionContext cctx{ params, path, INVALID_INDEX };
+
+  // The JSON is parsed straight from the mapped file. For a .glb, the mapping is then
+  // also where the converted animations and skins read the binary chunk from.
+  auto file = cctx.mBuffers.Get(url);
+  if (!file)
   {
     throw std::runtime_error("Failed to load " + url);
   }
 
-  json::unique_ptr root(json_parse(js.c_str(), js.size()));
+  GlbChunk jsonChunk{ 0, file->GetSize() };
+  GlbChunk binChunk;
+  const bool isGlb = ReadGlbChunks(*file, jsonChunk, binChunk);
+  if (isGlb && jsonChunk.mLength == 0)
+  {
+    throw std::runtime_error("Failed to parse " + url);
+  }
+
+  json::unique_ptr root(json_parse(file->GetData() + jsonChunk.mOffset, jsonChunk.mLength));
   if (!root)
   {
     throw std::runtime_error("Failed to parse " + url);
@@ -1179,8 +1302,11 @@ void LoadGltfScene(const std::string& url, ShaderDefinitionFactory& shaderFactor
   gt::SetRefReaderObject(doc);
   DOCUMENT_READER.Read(rootObj, doc);
 
-  auto path = url.substr(0, url.rfind('/') + 1);
-  ConversionContext cctx{ params, path, INVALID_INDEX };
+  const std::string glbUri = url.substr(path.size());
+  if (isGlb)
+  {
+    ResolveGlbBuffer(doc, glbUri, binChunk);
+  }
 
   ConvertMaterials(doc, cctx);
   ConvertMeshes(doc, cctx);
@@ -17,9 +17,11 @@
 
 // INTERNAL INCLUDES
 #include "dali-scene-loader/public-api/material-definition.h"
+#include "dali-scene-loader/public-api/buffer-provider.h"
 
 // EXTERNAL INCLUDES
 #include "dali-toolkit/public-api/image-loader/sync-image-loader.h"
+#include "dali/devel-api/adaptor-framework/image-loading.h"
 
 namespace Dali
 {
@@ -64,6 +66,28 @@ constexpr WrapMode::Type WRAP_MODES_TO_DALI[]{
 };
 
 const SamplerFlags::Type SINGLE_VALUE_SAMPLER = SamplerFlags::Encode(FilterMode::NEAREST, FilterMode::NEAREST, WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+
+PixelData LoadImage(const std::string& imagesPath, const TextureDefinition& texture, BufferProvider& buffers)
+{
+  const std::string path = imagesPath + texture.mImageUri;
+  if (texture.mImageLength == 0)
+  {
+    return SyncImageLoader::Load(path);
+  }
+
+  // Decode the embedded image straight from the (mapped) file that contains it.
+  Dali::Vector<uint8_t> encoded;
+  encoded.Resize(texture.mImageLength);
+  auto buffer = buffers.Get(path);
+  if (!buffer || !buffer->Read(texture.mImageOffset, texture.mImageLength, encoded.Begin()))
+  {
+    ExceptionFlinger(ASSERT_LOCATION) << "Failed to read embedded image from '" << path << "'.";
+  }
+
+  auto pixelBuffer = LoadImageFromBuffer(encoded);
+  return pixelBuffer ? Devel::PixelBuffer::Convert(pixelBuffer) : PixelData();
+}
+
 }
 
 SamplerFlags::Type SamplerFlags::Encode(FilterMode::Type minFilter, FilterMode::Type magFilter, WrapMode::Type wrapS, WrapMode::Type wrapT)
@@ -107,6 +131,13 @@ TextureDefinition::TextureDefinition(const std::string& imageUri, SamplerFlags::
 
 MaterialDefinition::RawData
   MaterialDefinition::LoadRaw(const std::string& imagesPath) const
+{
+  BufferProvider buffers;
+  return LoadRaw(imagesPath, buffers);
+}
+
+MaterialDefinition::RawData
+  MaterialDefinition::LoadRaw(const std::string& imagesPath, BufferProvider& buffers) const
 {
   RawData raw;
 
@@ -129,12 +160,12 @@ MaterialDefinition::RawData
   // Check for compulsory textures: Albedo, Metallic, Roughness, Normal
   if (checkStage(ALBEDO | METALLIC))
   {
-    raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+    raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
     ++iTexture;
 
     if (checkStage(NORMAL | ROUGHNESS))
     {
-      raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+      raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
       ++iTexture;
     }
     else // single value normal-roughness
@@ -148,7 +179,7 @@ MaterialDefinition::RawData
   {
     if (checkStage(ALBEDO))
     {
-      raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+      raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
       ++iTexture;
     }
     else // single value albedo, albedo-alpha or albedo-metallic
@@ -182,7 +213,7 @@ MaterialDefinition::RawData
     const bool createMetallicRoughnessAndNormal = hasTransparency || std::distance(mTextureStages.begin(), iTexture) > 0;
     if (checkStage(METALLIC | ROUGHNESS))
     {
-      raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+      raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
       ++iTexture;
     }
     else if (createMetallicRoughnessAndNormal)
@@ -196,7 +227,7 @@ MaterialDefinition::RawData
 
     if (checkStage(NORMAL))
     {
-      raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+      raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
       ++iTexture;
     }
     else if (createMetallicRoughnessAndNormal)
@@ -216,7 +247,7 @@ MaterialDefinition::RawData
   // Extra textures. TODO: emissive, occlusion etc.
   if (checkStage(SUBSURFACE))
   {
-    raw.mTextures.push_back({ SyncImageLoader::Load(imagesPath + iTexture->mTexture.mImageUri), iTexture->mTexture.mSamplerFlags });
+    raw.mTextures.push_back({ LoadImage(imagesPath, iTexture->mTexture, buffers), iTexture->mTexture.mSamplerFlags });
     ++iTexture;
   }
 
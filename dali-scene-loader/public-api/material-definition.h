@@ -33,6 +33,8 @@ namespace Dali
 namespace SceneLoader
 {
 
+class BufferProvider;
+
 /**
  * @brief Helper enum for encoding and decoding sampler states.
  */
@@ -110,11 +112,15 @@ struct DALI_SCENE_LOADER_API SamplerFlags
 
 /**
  * @brief Defines a texture from a combination of an image URI and its sampler definition.
+ *  If mImageLength is non-zero, the encoded image is embedded in the file at mImageUri,
+ *  mImageLength bytes from mImageOffset (e.g. in the binary chunk of a .glb).
  */
 struct DALI_SCENE_LOADER_API TextureDefinition
 {
   std::string mImageUri;
   SamplerFlags::Type mSamplerFlags;
+  uint32_t mImageOffset = 0;
+  uint32_t mImageLength = 0;
 
   TextureDefinition(const std::string& imageUri = "", SamplerFlags::Type samplerFlags = SamplerFlags::DEFAULT);
 };
@@ -185,6 +191,13 @@ struct DALI_SCENE_LOADER_API MaterialDefinition
    */
   RawData LoadRaw(const std::string& imagesPath) const;
 
+  /**
+   * @brief Loads raw pixel data like LoadRaw(imagesPath), getting the contents
+   *  of files with embedded images from @a buffers, so that they're only mapped once.
+   * @note This may be called from any thread.
+   */
+  RawData LoadRaw(const std::string& imagesPath, BufferProvider& buffers) const;
+
   /**
    * @brief Creates Textures from the pixel data in @a raw, gets the
    *  the cube maps from the iEnvironment'th element of @a environments,
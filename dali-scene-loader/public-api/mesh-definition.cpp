@@ -17,11 +17,13 @@
 
 // INTERNAL INCLUDES
 #include "dali-scene-loader/public-api/mesh-definition.h"
+#include "dali-scene-loader/public-api/buffer-provider.h"
 
 // EXTERNAL INCLUDES
 #include "dali/devel-api/adaptor-framework/pixel-buffer.h"
-#include <fstream>
+#include <cmath>
 #include <cstring>
+#include <limits>
 
 namespace Dali
 {
@@ -66,32 +68,25 @@ private:
 
 const std::string QUAD("quad");
 
-///@brief Reads a blob from the given stream @a source into @a target, which must have
-/// at least @a descriptor.length bytes.
-bool ReadBlob(const MeshDefinition::Blob& descriptor, std::istream& source, uint8_t* target)
+///@brief Reads a blob from the given @a source buffer into @a target, which must have
+/// at least @a descriptor.GetBufferSize() bytes. Interleaved elements are packed tightly.
+bool ReadBlob(const MeshDefinition::Blob& descriptor, const BinaryBuffer& source, uint8_t* target)
 {
-  if (!source.seekg(descriptor.mOffset, std::istream::beg))
-  {
-    return false;
-  }
-
   if (descriptor.IsConsecutive())
   {
-    return !!source.read(reinterpret_cast<char*>(target), descriptor.mLength);
+    return source.Read(descriptor.mOffset, descriptor.mLength, target);
   }
   else
   {
     DALI_ASSERT_DEBUG(descriptor.mStride > descriptor.mElementSizeHint);
-    const uint32_t diff = descriptor.mStride - descriptor.mElementSizeHint;
-    uint32_t readSize = 0;
-    while (readSize < descriptor.mLength &&
-      source.read(reinterpret_cast<char*>(target), descriptor.mElementSizeHint) &&
-      source.seekg(diff, std::istream::cur))
+    if (descriptor.mLength % descriptor.mStride != 0)
     {
-      readSize += descriptor.mStride;
-      target += descriptor.mElementSizeHint;
+      // The blob must hold whole strides.
+      return false;
     }
-    return readSize == descriptor.mLength;
+
+    return source.ReadStrided(descriptor.mOffset, descriptor.mLength / descriptor.mStride,
+      descriptor.mStride, descriptor.mElementSizeHint, target);
   }
 }
 
@@ -106,7 +101,7 @@ void ReadValues(const std::vector<uint8_t>& valuesBuffer, const std::vector<uint
   }
 }
 
-bool ReadAccessor(const MeshDefinition::Accessor& accessor, std::istream& source, uint8_t* target)
+bool ReadAccessor(const MeshDefinition::Accessor& accessor, const BinaryBuffer& source, uint8_t* target)
 {
   bool success = false;
 
@@ -310,7 +305,7 @@ void CalculateTextureSize(uint32_t totalTextureSize, uint32_t& textureWidth, uin
   textureHeight = 1u << powHeight;
 }
 
-void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, std::ifstream& binFile, const std::vector<MeshDefinition::BlendShape>& blendShapes, uint32_t numberOfVertices, float& blendShapeUnnormalizeFactor)
+void CalculateGltf2BlendShapes(uint8_t* geometryBuffer, const BinaryBuffer& binFile, const std::vector<MeshDefinition::BlendShape>& blendShapes, uint32_t numberOfVertices, float& blendShapeUnnormalizeFactor)
 {
   uint32_t geometryBufferIndex = 0u;
   float maxDistance = 0.f;
@@ -545,6 +540,13 @@ void MeshDefinition::RequestTangents()
 
 MeshDefinition::RawData
   MeshDefinition::LoadRaw(const std::string& modelsPath) const
+{
+  BufferProvider buffers;
+  return LoadRaw(modelsPath, buffers);
+}
+
+MeshDefinition::RawData
+  MeshDefinition::LoadRaw(const std::string& modelsPath, BufferProvider& buffers) const
 {
   RawData raw;
   if (IsQuad())
@@ -553,11 +555,12 @@ MeshDefinition::RawData
   }
 
   const std::string meshPath = modelsPath + mUri;
-  std::ifstream binFile(meshPath, std::ios::binary);
-  if (!binFile)
+  auto binBuffer = buffers.Get(meshPath);
+  if (!binBuffer)
   {
     ExceptionFlinger(ASSERT_LOCATION) << "Failed to read geometry data from '" << meshPath << "'";
   }
+  const BinaryBuffer& binFile = *binBuffer;
 
   if (mIndices.IsDefined())
   {
@@ -33,6 +33,8 @@ namespace Dali
 namespace SceneLoader
 {
 
+class BufferProvider;
+
 /**
  * @brief Defines a mesh with its attributes, the primitive type to render it as,
  *  and the file to load it from with the offset and length information for the
@@ -225,6 +227,13 @@ struct DALI_SCENE_LOADER_API MeshDefinition
    */
   RawData LoadRaw(const std::string& modelsPath) const;
 
+  /**
+   * @brief Loads raw geometry data like LoadRaw(modelsPath), getting the contents
+   *  of the file from @a buffers, so that meshes which share a file only map it once.
+   * @note This can be done on any thread.
+   */
+  RawData LoadRaw(const std::string& modelsPath, BufferProvider& buffers) const;
+
   /**
    * @brief Creates a MeshGeometry based firstly on the value of the uri member:
    *  if it is "quad", a textured quad is created; otherwise it uses the
@@ -18,6 +18,9 @@
 // FILE HEADER
 #include "dali-scene-loader/public-api/resource-bundle.h"
 
+// INTERNAL
+#include "dali-scene-loader/public-api/buffer-provider.h"
+
 // EXTERNAL
 #include "dali/public-api/rendering/sampler.h"
 #include "dali-toolkit/public-api/image-loader/sync-image-loader.h"
@@ -25,6 +28,12 @@
 #include <istream>
 #include <cstring>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace Dali
 {
@@ -42,6 +51,116 @@ const char* const RESOURCE_TYPE_NAMES[] = {
   "Material",
 };
 
+/**
+ * @brief Runs a sequence of jobs on a number of worker threads, in the order that they
+ *  were given, and lets the calling thread wait for them one by one. With no worker
+ *  threads, the jobs are run by Wait(), on the calling thread.
+ */
+class RawLoader
+{
+public:
+  using Job = std::function<void()>;
+
+  RawLoader(const std::vector<Job>& jobs, uint32_t numThreads)
+  : mJobs(jobs),
+    mFinished(jobs.size(), false),
+    mErrors(jobs.size()),
+    mDaliErrors(jobs.size())
+  {
+    mThreads.reserve(numThreads);
+    for (uint32_t i = 0; i < numThreads; ++i)
+    {
+      mThreads.emplace_back([this]() { Run(); });
+    }
+  }
+
+  RawLoader(const RawLoader&) = delete;
+  RawLoader& operator=(const RawLoader&) = delete;
+
+  /**
+   * @brief Stops the workers from starting any more jobs, and waits for them to finish.
+   */
+  ~RawLoader()
+  {
+    mCancelled = true;
+    for (auto& thread : mThreads)
+    {
+      thread.join();
+    }
+  }
+
+  /**
+   * @brief Waits for the @a i'th job to finish, rethrowing any exception that it threw.
+   */
+  void Wait(size_t i)
+  {
+    if (mThreads.empty())
+    {
+      mJobs[i]();
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this, i]() { return mFinished[i]; });
+    if (mErrors[i])
+    {
+      std::rethrow_exception(mErrors[i]);
+    }
+
+    auto& daliError = mDaliErrors[i];
+    if (daliError.first)
+    {
+      ExceptionFlinger(daliError.first) << daliError.second;
+    }
+  }
+
+private:
+  void Run()
+  {
+    for (size_t i = mNextJob++; i < mJobs.size() && !mCancelled; i = mNextJob++)
+    {
+      std::exception_ptr error;
+      DaliError daliError{ nullptr, {} };
+      try
+      {
+        mJobs[i]();
+      }
+      catch (const DaliException& e)
+      {
+        // ExceptionFlinger formats its message in a thread_local buffer, which doesn't
+        // outlive this thread; copy it, to throw it again on the waiting thread.
+        daliError = { e.location, e.condition };
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFinished[i] = true;
+        mErrors[i] = error;
+        mDaliErrors[i] = std::move(daliError);
+      }
+      mCondition.notify_all();
+    }
+  }
+
+  using DaliError = std::pair<const char*, std::string>;  // location, condition
+
+  const std::vector<Job>& mJobs;
+  std::vector<bool> mFinished;  // guarded by mMutex, as are the errors.
+  std::vector<std::exception_ptr> mErrors;
+  std::vector<DaliError> mDaliErrors;
+
+  std::atomic<size_t> mNextJob{ 0 };
+  std::atomic<bool> mCancelled{ false };
+
+  std::mutex mMutex;
+  std::condition_variable mCondition;
+  std::vector<std::thread> mThreads;
+};
+
 }  // nonamespace
 
 const char* GetResourceTypeName(ResourceType::Value type)
@@ -73,21 +192,34 @@ void ResourceBundle::CountEnvironmentReferences(ResourceRefCounts& refCounts) co
   }
 }
 
-void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvider pathProvider, Options::Type options)
+void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvider pathProvider, Options::Type options,
+  ProgressCallback progress)
 {
   const auto kForceLoad = MaskMatch(options, Options::ForceReload);
   const auto kKeepUnused = MaskMatch(options, Options::KeepUnused);
 
+  // Jobs are run in two stages: the LoadRaw() stage of each job is run on a worker thread, then its
+  // Load() stage on this thread, in the same order as they were added - environment maps first,
+  // which the materials' Load() needs.
+  std::vector<RawLoader::Job> rawJobs;
+  std::vector<std::function<void()>> loadJobs;
+
   const auto& refCountEnvMaps = refCounts[ResourceType::Environment];
   auto environmentsPath = pathProvider(ResourceType::Environment);
+  std::vector<EnvironmentDefinition::RawData> envMapsRaw(refCountEnvMaps.Size());
   for (uint32_t i = 0, iEnd = refCountEnvMaps.Size(); i != iEnd; ++i)
   {
     auto refCount = refCountEnvMaps[i];
     auto& iEnvMap = mEnvironmentMaps[i];
     if (refCount > 0 && (kForceLoad || !iEnvMap.second.IsLoaded()))
     {
-      auto raw = iEnvMap.first.LoadRaw(environmentsPath);
-      iEnvMap.second = iEnvMap.first.Load(std::move(raw));
+      rawJobs.push_back([this, i, &envMapsRaw, &environmentsPath]() {
+        envMapsRaw[i] = mEnvironmentMaps[i].first.LoadRaw(environmentsPath);
+      });
+      loadJobs.push_back([this, i, &envMapsRaw]() {
+        auto& iEnvMap = mEnvironmentMaps[i];
+        iEnvMap.second = iEnvMap.first.Load(std::move(envMapsRaw[i]));
+      });
     }
     else if (!kKeepUnused && refCount == 0 && iEnvMap.second.IsLoaded())
     {
@@ -98,14 +230,20 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
 
   const auto& refCountShaders = refCounts[ResourceType::Shader];
   auto shadersPath = pathProvider(ResourceType::Shader);
+  std::vector<ShaderDefinition::RawData> shadersRaw(refCountShaders.Size());
   for (uint32_t i = 0, iEnd = refCountShaders.Size(); i != iEnd; ++i)
   {
     auto refCount = refCountShaders[i];
     auto& iShader = mShaders[i];
     if (refCount > 0 && (kForceLoad || !iShader.second))
     {
-      auto raw = iShader.first.LoadRaw(shadersPath);
-      iShader.second = iShader.first.Load(std::move(raw));
+      rawJobs.push_back([this, i, &shadersRaw, &shadersPath]() {
+        shadersRaw[i] = mShaders[i].first.LoadRaw(shadersPath);
+      });
+      loadJobs.push_back([this, i, &shadersRaw]() {
+        auto& iShader = mShaders[i];
+        iShader.second = iShader.first.Load(std::move(shadersRaw[i]));
+      });
     }
     else if(!kKeepUnused && refCount == 0 && iShader.second)
     {
@@ -113,16 +251,24 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
     }
   }
 
+  BufferProvider buffers;  // meshes commonly share their .bin files, and .glb files hold images too.
+
   const auto& refCountMeshes = refCounts[ResourceType::Mesh];
   auto modelsPath = pathProvider(ResourceType::Mesh);
+  std::vector<MeshDefinition::RawData> meshesRaw(refCountMeshes.Size());
   for (uint32_t i = 0, iEnd = refCountMeshes.Size(); i != iEnd; ++i)
   {
     auto refCount = refCountMeshes[i];
     auto& iMesh = mMeshes[i];
     if (refCount > 0 && (kForceLoad || !iMesh.second.geometry))
     {
-      auto raw = iMesh.first.LoadRaw(modelsPath);
-      iMesh.second = iMesh.first.Load(std::move(raw));
+      rawJobs.push_back([this, i, &meshesRaw, &modelsPath, &buffers]() {
+        meshesRaw[i] = mMeshes[i].first.LoadRaw(modelsPath, buffers);
+      });
+      loadJobs.push_back([this, i, &meshesRaw]() {
+        auto& iMesh = mMeshes[i];
+        iMesh.second = iMesh.first.Load(std::move(meshesRaw[i]));
+      });
     }
     else if (!kKeepUnused && refCount == 0 && iMesh.second.geometry)
     {
@@ -132,20 +278,47 @@ void ResourceBundle::LoadResources(const ResourceRefCounts& refCounts, PathProvi
 
   const auto& refCountMaterials = refCounts[ResourceType::Material];
   auto imagesPath = pathProvider(ResourceType::Material);
+  std::vector<MaterialDefinition::RawData> materialsRaw(refCountMaterials.Size());
   for (uint32_t i = 0, iEnd = refCountMaterials.Size(); i != iEnd; ++i)
   {
     auto refCount = refCountMaterials[i];
     auto& iMaterial = mMaterials[i];
     if (refCount > 0 && (kForceLoad || !iMaterial.second))
     {
-      auto raw = iMaterial.first.LoadRaw(imagesPath);
-      iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(raw));
+      rawJobs.push_back([this, i, &materialsRaw, &imagesPath, &buffers]() {
+        materialsRaw[i] = mMaterials[i].first.LoadRaw(imagesPath, buffers);
+      });
+      loadJobs.push_back([this, i, &materialsRaw]() {
+        auto& iMaterial = mMaterials[i];
+        iMaterial.second = iMaterial.first.Load(mEnvironmentMaps, std::move(materialsRaw[i]));
+      });
     }
     else if (!kKeepUnused && refCount == 0 && iMaterial.second)
     {
       iMaterial.second = TextureSet();
     }
   }
+
+  const uint32_t numJobs = static_cast<uint32_t>(rawJobs.size());
+  uint32_t numThreads = 0;
+  if (!MaskMatch(options, Options::SingleThreaded))
+  {
+    numThreads = std::min(std::max(std::thread::hardware_concurrency(), 1u), numJobs);
+  }
+
+  // If a LoadRaw() throws or the loading is cancelled, the loader only lets the workers
+  // finish what they've started before it's destroyed.
+  RawLoader rawLoader(rawJobs, numThreads);
+  for (uint32_t i = 0; i != numJobs; ++i)
+  {
+    rawLoader.Wait(i);
+    loadJobs[i]();
+
+    if (progress && !progress(i + 1, numJobs))
+    {
+      break;
+    }
+  }
 }
 
 }
@@ -75,12 +75,20 @@ public:
     {
       None = 0,
       ForceReload = NthBit(0),  ///< Load resources [again] even if they were already loaded.
-      KeepUnused = NthBit(1)  ///<s Don't reset handles to resources that had a 0 reference count.
+      KeepUnused = NthBit(1),  ///<s Don't reset handles to resources that had a 0 reference count.
+      SingleThreaded = NthBit(2)  ///< Load the raw data of resources on the calling thread only.
     };
   };
 
   using PathProvider = std::function<std::string(ResourceType::Value)>;
 
+  /*
+   * @brief Called from LoadResources() on its calling thread, each time a resource was loaded,
+   *  with the number of resources loaded so far and the number of resources to load.
+   * @return Whether to carry on loading; false cancels the loading of the remaining resources.
+   */
+  using ProgressCallback = std::function<bool(uint32_t numLoaded, uint32_t numTotal)>;
+
   ResourceBundle() = default;
 
   ResourceBundle(const ResourceBundle&) = delete;
@@ -109,10 +117,16 @@ public:
    *  loaded unless we already have a handle to them (OR the ForceReload option was specified).
    *  Any handles we have to resources that come in with a zero ref count will be reset,
    *  UNLESS the KeepUnused option was specified.
+   *  The raw data of resources is loaded concurrently on worker threads (unless the
+   *  SingleThreaded option was specified), while the DALi resources are created on the
+   *  calling thread, which must be the event thread. @a progress, if any, is notified
+   *  after each resource, and may cancel the loading of the rest; resources that were
+   *  loaded by then are kept.
    */
   void LoadResources(const ResourceRefCounts& refCounts,
     PathProvider pathProvider,
-    Options::Type options = Options::None);
+    Options::Type options = Options::None,
+    ProgressCallback progress = nullptr);
 
 public: // DATA
   EnvironmentDefinition::Vector mEnvironmentMaps;
@@ -115,6 +115,16 @@ Vector4 GaussianBlurView::GetBackgroundColor() const
   return GetImpl(*this).GetBackgroundColor();
 }
 
+void GaussianBlurView::SetDualFilterLevels(unsigned int levels)
+{
+  GetImpl(*this).SetDualFilterLevels(levels);
+}
+
+unsigned int GaussianBlurView::GetDualFilterLevels() const
+{
+  return GetImpl(*this).GetDualFilterLevels();
+}
+
 GaussianBlurView::GaussianBlurViewSignal& GaussianBlurView::FinishedSignal()
 {
   return GetImpl(*this).FinishedSignal();
@@ -165,7 +165,8 @@ public:
   /**
   * @brief Create an initialized GaussianBlurView.
   * @SINCE_1_0.0
-  * @param numSamples The size of the Gaussian blur kernel (number of samples in horizontal / vertical blur directions).
+  * @param numSamples The size of the Gaussian blur kernel (number of samples in horizontal / vertical blur directions). Each sample either side of the centre
+  * is one texture fetch between two texels, weighted so they follow the Gaussian function.
   * @param blurBellCurveWidth The constant controlling the Gaussian function, must be > 0.0. Controls the width of the bell curve, i.e. the look of the blur and also indirectly
   * the amount of blurriness Smaller numbers for a tighter curve. Useful values in the range [0.5..3.0] - near the bottom of that range the curve is weighted heavily towards
   * the centre pixel of the kernel (so there won't be much blur), near the top of that range the pixels have nearly equal weighting (closely approximating a box filter
@@ -253,6 +254,23 @@ public:
   */
   Vector4 GetBackgroundColor() const;
 
+  /**
+   * @brief Blurs with a dual filter of the given number of levels instead of the Gaussian kernel.
+   *
+   * The blurred image is downsampled to half its size as many times as there are levels, then upsampled back,
+   * blurring a little at each step. The radius of the blur doubles with each level for a fixed number of texture
+   * fetches per level, which makes it cheaper than the Gaussian kernel for large radii. The numSamples and
+   * blurBellCurveWidth given to New() are then not used.
+   * @param[in] levels The number of levels, or zero to use the Gaussian kernel, which is the default.
+   */
+  void SetDualFilterLevels(unsigned int levels);
+
+  /**
+   * @brief Retrieves the number of levels of the dual filter.
+   * @return The number of levels, or zero if the Gaussian kernel is used.
+   */
+  unsigned int GetDualFilterLevels() const;
+
 public: // Signals
   /**
    * @brief If ActivateOnce has been called, then connect to this signal to be notified when the
@@ -0,0 +1,72 @@
+#ifndef DALI_TOOLKIT_ITEM_FACTORY_DEVEL_H
+#define DALI_TOOLKIT_ITEM_FACTORY_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/item-view/item-factory.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+/**
+ * @brief Lets ItemView reuse the actors of released items for new items, instead of
+ * asking the factory to create a new actor for every item which scrolls into view.
+ *
+ * An ItemFactory provides this by returning it from ItemFactory::GetExtension().
+ * Each item has a type; actors are only reused for items of the same type.
+ * ItemView still calls ItemFactory::ItemReleased() for every actor it releases, then keeps
+ * a limited number of them (without their layout constraints) for reuse.
+ */
+class ItemFactory::Extension
+{
+public:
+
+  /**
+   * @brief Virtual destructor.
+   */
+  DALI_TOOLKIT_API virtual ~Extension(){};
+
+  /**
+   * @brief Queries the type of an item.
+   *
+   * Called when ItemView needs an actor for the item, and only then; the type of
+   * the actor stays the same for as long as ItemView keeps it.
+   * @param[in] itemId The ID of the item
+   * @return The type of the item
+   */
+  virtual unsigned int GetItemType( unsigned int itemId ) = 0;
+
+  /**
+   * @brief Updates a previously released actor, to represent an item of the same type.
+   *
+   * Called instead of ItemFactory::NewItem(), when there is such an actor.
+   * @param[in] itemId The ID of the newly visible item
+   * @param[in] actor The actor to update
+   */
+  virtual void RecycleItem( unsigned int itemId, Actor actor ) = 0;
+};
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_ITEM_FACTORY_DEVEL_H
@@ -0,0 +1,84 @@
+#ifndef DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+#define DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace DevelScrollView
+{
+namespace Property
+{
+enum Type
+{
+  WRAP_ENABLED               = Dali::Toolkit::ScrollView::Property::WRAP_ENABLED,
+  PANNING_ENABLED            = Dali::Toolkit::ScrollView::Property::PANNING_ENABLED,
+  AXIS_AUTO_LOCK_ENABLED     = Dali::Toolkit::ScrollView::Property::AXIS_AUTO_LOCK_ENABLED,
+  WHEEL_SCROLL_DISTANCE_STEP = Dali::Toolkit::ScrollView::Property::WHEEL_SCROLL_DISTANCE_STEP,
+  SCROLL_MODE                = Dali::Toolkit::ScrollView::Property::SCROLL_MODE,
+
+  /**
+   * @brief Whether the children outside of the view are culled.
+   * @details Name "cullingEnabled", type Property::BOOLEAN.
+   * @note The default value is false.
+   * @note A culled child is hidden, so neither it nor its descendants are rendered, and it is shown again
+   *       when scrolled back within the culling margin around the view. The children hidden by the application
+   *       and the ones without a size are never culled.
+   * @note The bounds of the children are their position, size and scale moved by the scroll position,
+   *       so the culling is not suitable when a scroll view effect moves the children, nor when wrapping is enabled.
+   */
+  CULLING_ENABLED = SCROLL_MODE + 1,
+
+  /**
+   * @brief The margin around the view within which the children are not culled.
+   * @details Name "cullingMargin", type Property::FLOAT.
+   * @note The default value is 100.0f.
+   * @note A child is shown again when it is within the margin, but only culled again once beyond twice the margin,
+   *       so it is not toggled while scrolling back and forth around the edge.
+   */
+  CULLING_MARGIN,
+
+  /**
+   * @brief The number of children currently culled.
+   * @details Name "culledChildCount", type Property::INTEGER.
+   * @note This property is read-only.
+   */
+  CULLED_CHILD_COUNT,
+
+  /**
+   * @brief The number of children currently visible, i.e. neither culled nor hidden by the application.
+   * @details Name "visibleChildCount", type Property::INTEGER.
+   * @note This property is read-only.
+   */
+  VISIBLE_CHILD_COUNT,
+};
+
+} // namespace Property
+
+} // namespace DevelScrollView
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SCROLL_VIEW_DEVEL_H
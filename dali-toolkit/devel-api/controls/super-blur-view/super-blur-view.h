@@ -70,6 +70,14 @@ public:
     enum
     {
       IMAGE_URL = PROPERTY_START_INDEX, ///< name "imageUrl",    @see SetTexture,    type String
+
+      /**
+       * @brief Whether each blurred texture is created by downsampling and blurring the previous one in a single pass.
+       * @details Name "pyramid", type Property::BOOLEAN.
+       *          Otherwise each level is blurred with a separate two pass Gaussian blur, which uses more render passes and framebuffers.
+       * @note Optional. Default is false. Changing it blurs the texture again.
+       */
+      PYRAMID,
     };
   };
 
@@ -51,6 +51,13 @@ uint32_t ApplyMask(AsyncImageLoader                         asyncImageLoader,
   return GetImplementation(asyncImageLoader).ApplyMask(pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad);
 }
 
+bool SetLoadPriority(AsyncImageLoader asyncImageLoader,
+                     uint32_t         loadingTaskId,
+                     LoadPriority     priority)
+{
+  return GetImplementation(asyncImageLoader).SetLoadPriority(loadingTaskId, priority);
+}
+
 PixelBufferLoadedSignalType& PixelBufferLoadedSignal(AsyncImageLoader asyncImageLoader)
 {
   return GetImplementation(asyncImageLoader).PixelBufferLoadedSignal();
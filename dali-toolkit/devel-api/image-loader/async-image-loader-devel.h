@@ -42,6 +42,15 @@ enum class PreMultiplyOnLoad
   ON       ///< Multiply alpha into color channels on load
 };
 
+/**
+ * @brief The order in which the queued tasks are processed
+ */
+enum class LoadPriority
+{
+  LOW = 0, ///< Processed once there are no tasks of high priority, e.g. images which are not on the scene
+  HIGH     ///< Processed in the order they were queued, the default
+};
+
 /**
  * @brief Starts an animated image loading task.
  * @REMARK_INTERNET
@@ -95,6 +104,17 @@ DALI_TOOLKIT_API uint32_t ApplyMask(AsyncImageLoader                         asy
                                     bool                                     cropToMask,
                                     DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad);
 
+/**
+ * @brief Changes the priority of a task which is still queueing in the work thread.
+ * @param[in] asyncImageLoader The ayncImageLoader
+ * @param[in] loadingTaskId The id of the task returned when it was started
+ * @param[in] priority The new priority of the task
+ * @return true if the task is still queueing
+ */
+DALI_TOOLKIT_API bool SetLoadPriority(AsyncImageLoader asyncImageLoader,
+                                      uint32_t         loadingTaskId,
+                                      LoadPriority     priority);
+
 /**
  * Connect to this signal if you want to load a PixelBuffer instead of a PixelData.
  * @note Connecting to this signal prevents the emission of the ImageLoadedSignal.
@@ -47,6 +47,27 @@ TextureSet RemoveTexture(const std::string& textureUrl)
   return textureMgr.RemoveExternalTexture(textureUrl);
 }
 
+void SetCacheBudget(size_t budget)
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  textureMgr.SetCacheBudget(budget);
+}
+
+size_t GetCacheBudget()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return textureMgr.GetCacheBudget();
+}
+
+CacheStatistics GetCacheStatistics()
+{
+  auto  visualFactory = Toolkit::VisualFactory::Get();
+  auto& textureMgr    = GetImplementation(visualFactory).GetTextureManager();
+  return textureMgr.GetCacheStatistics();
+}
+
 } // namespace TextureManager
 
 } // namespace Toolkit
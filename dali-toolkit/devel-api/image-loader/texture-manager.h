@@ -61,6 +61,44 @@ DALI_TOOLKIT_API std::string AddTexture(TextureSet& textureSet);
  */
 DALI_TOOLKIT_API TextureSet RemoveTexture(const std::string& textureUrl);
 
+/**
+ * @brief Memory usage and cache efficiency of the toolkit texture manager.
+ */
+struct CacheStatistics
+{
+  size_t   memoryUsage{0u};     ///< The number of bytes currently used by cached textures and pixel buffers
+  size_t   peakMemoryUsage{0u}; ///< The highest value memoryUsage has reached
+  uint32_t hitCount{0u};        ///< The number of texture requests satisfied from the cache
+  uint32_t missCount{0u};       ///< The number of texture requests that required a new load
+  uint32_t visibleLoadCount{0u};   ///< The number of asynchronous loads of high priority, i.e. of images on the scene, which have been uploaded
+  uint64_t visibleLoadTime{0u};    ///< The total time in microseconds from requesting those loads to uploading them
+  uint64_t maxVisibleLoadTime{0u}; ///< The longest time in microseconds from requesting one of those loads to uploading it
+};
+
+/**
+ * @brief Sets the number of bytes the texture manager may use before evicting unreferenced textures.
+ *
+ * With a non-zero budget, textures are retained after their last visual releases them, so that
+ * requesting them again does not require a reload. The least recently used of these are evicted
+ * whenever the total memory usage exceeds the budget.
+ * With a budget of zero (the default), textures are freed as soon as they are no longer referenced.
+ * The initial budget may also be set with the DALI_TEXTURE_CACHE_BUDGET environment variable.
+ * @param[in] budget The budget in bytes
+ */
+DALI_TOOLKIT_API void SetCacheBudget(size_t budget);
+
+/**
+ * @brief Retrieves the number of bytes the texture manager may use before evicting unreferenced textures.
+ * @return The budget in bytes
+ */
+DALI_TOOLKIT_API size_t GetCacheBudget();
+
+/**
+ * @brief Retrieves the memory usage and cache hit statistics of the texture manager.
+ * @return The cache statistics
+ */
+DALI_TOOLKIT_API CacheStatistics GetCacheStatistics();
+
 } // namespace TextureManager
 
 } // namespace Toolkit
@@ -0,0 +1,80 @@
+#ifndef DALI_TOOLKIT_RENDER_TARGET_POOL_H
+#define DALI_TOOLKIT_RENDER_TARGET_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+/**
+ * API to inspect and tune the pool of render targets which the effect controls (GaussianBlurView, BloomView,
+ * ShadowView, EffectsView, SuperBlurView) render their intermediate passes into.
+ *
+ * A render target released by a control stays in the pool, to be reused by any control which needs one of the
+ * same size and format, until it has been idle for the idle timeout or the pool exceeds its memory budget.
+ */
+namespace RenderTargetPool
+{
+/**
+ * @brief The work done by the pool.
+ */
+struct Statistics
+{
+  uint32_t allocationCount{0u}; ///< The number of render targets which have been created
+  uint32_t reuseCount{0u};      ///< The number of times a pooled render target has been reused instead
+  uint32_t evictionCount{0u};   ///< The number of idle render targets which have been destroyed
+  uint32_t pooledCount{0u};     ///< The number of render targets currently in the pool, leased or idle
+  uint32_t leasedCount{0u};     ///< The number of those render targets currently used by a control
+  uint64_t pooledMemory{0u};    ///< The estimated size in bytes of the render targets in the pool
+};
+
+/**
+ * @brief Retrieves the work done by the pool.
+ * @return The statistics of the pool
+ */
+DALI_TOOLKIT_API Statistics GetStatistics();
+
+/**
+ * @brief Sets the memory budget of the pool.
+ *
+ * Idle render targets are destroyed, least recently used first, to keep the pool within the budget.
+ * Render targets which would exceed it are not pooled. The default is 64 MB.
+ * @param[in] bytes The budget in bytes
+ */
+DALI_TOOLKIT_API void SetMemoryBudget(uint64_t bytes);
+
+/**
+ * @brief Sets how long an idle render target is kept in the pool.
+ * @param[in] milliseconds The timeout in milliseconds. The default is 5 seconds.
+ */
+DALI_TOOLKIT_API void SetIdleTimeout(uint32_t milliseconds);
+
+} // namespace RenderTargetPool
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_RENDER_TARGET_POOL_H
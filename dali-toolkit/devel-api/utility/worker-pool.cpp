@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/devel-api/utility/worker-pool.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/worker-pool.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+namespace WorkerPool
+{
+uint32_t GetNumberOfThreads()
+{
+  Internal::WorkerPoolPtr pool = Internal::WorkerPool::Get();
+  return pool->GetNumberOfThreads();
+}
+
+Statistics GetStatistics(Subsystem subsystem)
+{
+  Internal::WorkerPoolPtr pool = Internal::WorkerPool::Get();
+  return pool->GetStatistics(subsystem);
+}
+
+} // namespace WorkerPool
+
+} // namespace Toolkit
+
+} // namespace Dali
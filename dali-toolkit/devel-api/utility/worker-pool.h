@@ -0,0 +1,76 @@
+#ifndef DALI_TOOLKIT_WORKER_POOL_H
+#define DALI_TOOLKIT_WORKER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/public-api/dali-toolkit-common.h>
+
+namespace Dali
+{
+namespace Toolkit
+{
+/**
+ * API to inspect the pool of worker threads which does the background work of the toolkit.
+ * The number of threads may be set with the DALI_TOOLKIT_WORKER_THREADS environment variable.
+ */
+namespace WorkerPool
+{
+/**
+ * @brief The subsystems which submit their work to the pool.
+ */
+enum class Subsystem
+{
+  IMAGE_LOADING,    ///< The asynchronous image loaders, including the ones of the texture manager
+  SVG_RASTERIZATION ///< The rasterization of SVG images
+};
+
+/**
+ * @brief The work done by the pool for a subsystem.
+ */
+struct Statistics
+{
+  uint32_t queueDepth{0u};     ///< The number of tasks currently waiting for a worker
+  uint32_t processedCount{0u}; ///< The number of tasks which have been processed
+  uint64_t totalLatency{0u};   ///< The total time in microseconds those tasks waited for a worker
+  uint64_t maxLatency{0u};     ///< The longest time in microseconds one of those tasks waited for a worker
+};
+
+/**
+ * @brief Retrieves the number of worker threads of the pool.
+ * @return The number of threads
+ */
+DALI_TOOLKIT_API uint32_t GetNumberOfThreads();
+
+/**
+ * @brief Retrieves the work done by the pool for a subsystem.
+ * @param[in] subsystem The subsystem
+ * @return The statistics of the subsystem
+ */
+DALI_TOOLKIT_API Statistics GetStatistics(Subsystem subsystem);
+
+} // namespace WorkerPool
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_WORKER_POOL_H
@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <sys/stat.h>
+#include <algorithm>
+#include <cctype>
 #include <sstream>
 
 #include <dali/public-api/actors/camera-actor.h>
@@ -44,6 +46,7 @@
 #include <dali-toolkit/internal/builder/builder-get-is.inl.h>
 #include <dali-toolkit/internal/builder/builder-impl-debug.h>
 #include <dali-toolkit/internal/builder/builder-set-property.h>
+#include <dali-toolkit/internal/builder/json-parser-impl.h>
 #include <dali-toolkit/internal/builder/replacement.h>
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
@@ -148,11 +151,22 @@ void CollectAllStyles( const TreeNode& stylesCollection, const TreeNode& style,
 }
 
 
+/**
+ * Styles are looked up ignoring the case of their name, as TreeNode::GetChildIgnoreCase() does.
+ */
+std::string ToLowerCase( const std::string& name )
+{
+  std::string lowerCase( name );
+  std::transform( lowerCase.begin(), lowerCase.end(), lowerCase.begin(), []( char c ) { return std::tolower( c ); } );
+  return lowerCase;
+}
+
 } // namespace anon
 
 
 Builder::Builder()
-: mSlotDelegate( this )
+: mSlotDelegate( this ),
+  mStyleNodesIndexed( false )
 {
   mParser = Dali::Toolkit::JsonParser::New();
 
@@ -181,33 +195,13 @@ void Builder::LoadFromString( std::string const& data, Dali::Toolkit::Builder::U
   }
   else
   {
-    // load constant map (allows the user to override the constants in the json after loading)
-    LoadConstants( *parser.GetRoot(), mReplacementMap );
-    // load configuration map
-    LoadConfiguration( *parser.GetRoot(), mConfigurationMap );
-    // merge includes
-    if( OptionalChild includes = IsChild(*parser.GetRoot(), KEYNAME_INCLUDES) )
-    {
-      Replacement replacer( mReplacementMap );
-
-      for(TreeNode::ConstIterator iter = (*includes).CBegin(); iter != (*includes).CEnd(); ++iter)
-      {
-        OptionalString filename = replacer.IsString( (*iter).second );
-
-        if( filename )
-        {
-#if defined(DEBUG_ENABLED)
-          DALI_SCRIPT_VERBOSE("Loading Include '%s'\n", (*filename).c_str());
-#endif
-          LoadFromString( GetFileContents(*filename) );
-        }
-      }
-    }
+    LoadConstantsAndIncludes( *parser.GetRoot() );
 
     if( mParser.Parse( data ) )
     {
       // Drop the styles and get them to be rebuilt against the new parse tree as required.
-      mStyles.Clear();
+      mStyles.clear();
+      mStyleNodesIndexed = false;
     }
     else
     {
@@ -226,6 +220,59 @@ void Builder::LoadFromString( std::string const& data, Dali::Toolkit::Builder::U
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Cannot parse JSON");
 }
 
+bool Builder::LoadFromSnapshot( const std::vector<char>& snapshot )
+{
+  // parser to get constants and includes only
+  Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
+
+  if( !GetImplementation( parser ).ParseSnapshot( snapshot ) )
+  {
+    DALI_LOG_WARNING( "JSON snapshot is invalid\n" );
+    return false;
+  }
+
+  LoadConstantsAndIncludes( *parser.GetRoot() );
+
+  // Valid as replayed above
+  GetImplementation( mParser ).ParseSnapshot( snapshot );
+
+  // Drop the styles and get them to be rebuilt against the new parse tree as required.
+  mStyles.clear();
+  mStyleNodesIndexed = false;
+
+  DUMP_PARSE_TREE(mParser); // This macro only writes out if DEBUG is enabled and the "DUMP_TREE" constant is defined in the stylesheet.
+  DUMP_TEST_MAPPINGS(mParser);
+
+  DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Cannot load JSON snapshot");
+  return true;
+}
+
+void Builder::LoadConstantsAndIncludes( const TreeNode& root )
+{
+  // load constant map (allows the user to override the constants in the json after loading)
+  LoadConstants( root, mReplacementMap );
+  // load configuration map
+  LoadConfiguration( root, mConfigurationMap );
+  // merge includes
+  if( OptionalChild includes = IsChild(root, KEYNAME_INCLUDES) )
+  {
+    Replacement replacer( mReplacementMap );
+
+    for(TreeNode::ConstIterator iter = (*includes).CBegin(); iter != (*includes).CEnd(); ++iter)
+    {
+      OptionalString filename = replacer.IsString( (*iter).second );
+
+      if( filename )
+      {
+#if defined(DEBUG_ENABLED)
+        DALI_SCRIPT_VERBOSE("Loading Include '%s'\n", (*filename).c_str());
+#endif
+        LoadFromString( GetFileContents(*filename) );
+      }
+    }
+  }
+}
+
 void Builder::AddConstants( const Property::Map& map )
 {
   mReplacementMap.Merge( map );
@@ -310,6 +357,7 @@ BaseHandle Builder::CreateFromJson( const std::string& json )
 
   if( mParser.Parse(newTemplate) )
   {
+    mStyleNodesIndexed = false;
     Replacement replacement( mReplacementMap );
     ret = Create( "@temp@", replacement );
   }
@@ -329,6 +377,7 @@ bool Builder::ApplyFromJson(  Handle& handle, const std::string& json )
 
   if( mParser.Parse(newStyle) )
   {
+    mStyleNodesIndexed = false;
     Replacement replacement( mReplacementMap );
     ret = ApplyStyle( "@temp@", handle, replacement );
   }
@@ -346,27 +395,20 @@ bool Builder::LookupStyleName( const std::string& styleName )
 {
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
 
-  OptionalChild styles = IsChild( *mParser.GetRoot(), KEYNAME_STYLES );
-  OptionalChild style  = IsChildIgnoreCase( *styles, styleName );
-
-  if( styles && style )
-  {
-    return true;
-  }
-  return false;
+  return FindStyleNode( styleName ) != NULL;
 }
 
 const StylePtr Builder::GetStyle( const std::string& styleName )
 {
-  const StylePtr* style = mStyles.FindConst( styleName );
+  auto iter = mStyles.find( ToLowerCase( styleName ) );
 
-  if( style==NULL )
+  if( iter == mStyles.end() )
   {
     return StylePtr(NULL);
   }
   else
   {
-    return *style;
+    return iter->second;
   }
 }
 
@@ -1098,12 +1140,9 @@ bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Re
 {
   DALI_ASSERT_ALWAYS(mParser.GetRoot() && "Builder script not loaded");
 
-  OptionalChild styles = IsChild( *mParser.GetRoot(), KEYNAME_STYLES );
-
-  std::string styleNameLower(styleName);
-  OptionalChild style  = IsChildIgnoreCase( *styles, styleNameLower );
+  const TreeNode* style = FindStyleNode( styleName );
 
-  if( styles && style )
+  if( style )
   {
     ApplyAllStyleProperties( *mParser.GetRoot(), *style, handle, replacement );
     return true;
@@ -1114,6 +1153,31 @@ bool Builder::ApplyStyle( const std::string& styleName, Handle& handle, const Re
   }
 }
 
+const TreeNode* Builder::FindStyleNode( const std::string& styleName )
+{
+  if( !mStyleNodesIndexed )
+  {
+    // Index the styles once per parse rather than searching them for each styled control.
+    mStyleNodes.clear();
+    if( OptionalChild styles = IsChild( *mParser.GetRoot(), KEYNAME_STYLES ) )
+    {
+      for( TreeNode::ConstIterator iter = (*styles).CBegin(); iter != (*styles).CEnd(); ++iter )
+      {
+        const TreeNode& style = (*iter).second;
+        if( style.GetName() )
+        {
+          // The first of the styles whose names only differ by case is found, as with GetChildIgnoreCase().
+          mStyleNodes.emplace( ToLowerCase( style.GetName() ), &style );
+        }
+      }
+    }
+    mStyleNodesIndexed = true;
+  }
+
+  auto iter = mStyleNodes.find( ToLowerCase( styleName ) );
+  return ( iter != mStyleNodes.end() ) ? iter->second : NULL;
+}
+
 void Builder::ApplyAllStyleProperties( const TreeNode& root, const TreeNode& node,
                                        Dali::Handle& handle, const Replacement& constant )
 {
@@ -1124,8 +1188,13 @@ void Builder::ApplyAllStyleProperties( const TreeNode& root, const TreeNode& nod
   StylePtr* matchedStyle = NULL;
   if( styleName )
   {
-    matchedStyle = mStyles.Find( styleName );
-    if( ! matchedStyle )
+    const std::string styleKey = ToLowerCase( styleName );
+    auto styleIter = mStyles.find( styleKey );
+    if( styleIter != mStyles.end() )
+    {
+      matchedStyle = &styleIter->second;
+    }
+    else
     {
       OptionalChild styleNodes = IsChild(root, KEYNAME_STYLES);
       OptionalChild inheritFromNode = IsChild(node, KEYNAME_INHERIT);
@@ -1162,8 +1231,10 @@ void Builder::ApplyAllStyleProperties( const TreeNode& root, const TreeNode& nod
         }
 
         RecordStyle( style, node, handle, constant );
-        mStyles.Add( styleName, style ); // shallow copy
-        matchedStyle = &style;
+
+        // Recorded once, the style is then applied to each control without looking anything up by name.
+        style->Compile();
+        matchedStyle = &( mStyles[ styleKey ] = style ); // shallow copy
       }
     }
   }
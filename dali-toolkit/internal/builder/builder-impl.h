@@ -22,6 +22,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/object/base-object.h>
@@ -83,6 +84,14 @@ public:
   void LoadFromString( const std::string &data,
                        Dali::Toolkit::Builder::UIFormat rep = Dali::Toolkit::Builder::JSON );
 
+  /**
+   * Load from a snapshot of json recorded with RecordJsonSnapshot(), as LoadFromString()
+   * loads from the json, without parsing it again.
+   * @param[in] snapshot The snapshot
+   * @return true if loaded, false if the snapshot is invalid in which case nothing is loaded
+   */
+  bool LoadFromSnapshot( const std::vector<char>& snapshot );
+
   /**
    * @copydoc Toolkit::Builder::AddConstants
    */
@@ -272,6 +281,19 @@ private:
                    Handle&            handle,
                    const Replacement& replacement);
 
+  /**
+   * Find the node of a style in the parse tree, ignoring the case of its name.
+   * @param[in] styleName The style name to search for
+   * @return The style node, or NULL if there is no such style
+   */
+  const TreeNode* FindStyleNode( const std::string& styleName );
+
+  /**
+   * Load the constants and configuration of a loaded document, and the documents it includes.
+   * @param[in] root The root of the document
+   */
+  void LoadConstantsAndIncludes( const TreeNode& root );
+
   void ApplyAllStyleProperties( const TreeNode&    root,
                                 const TreeNode&    node,
                                 Dali::Handle&      handle,
@@ -380,7 +402,9 @@ private:
   Property::Map                       mReplacementMap;
   Property::Map                       mConfigurationMap;
   MappingsLut                         mCompleteMappings;
-  Dictionary<StylePtr>                mStyles; // State based styles
+  std::unordered_map<std::string, const TreeNode*> mStyleNodes; // Style nodes by lower case name, indexed on first lookup
+  std::unordered_map<std::string, StylePtr>        mStyles;     // State based styles by lower case name
+  bool                                             mStyleNodesIndexed;
   Toolkit::Builder::BuilderSignalType mQuitSignal;
 };
 
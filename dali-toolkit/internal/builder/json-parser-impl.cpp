@@ -23,7 +23,8 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/builder/tree-node-manipulator.h>
-#include <dali-toolkit/internal/builder/json-parser-state.h>
+#include <dali-toolkit/internal/builder/json-sax-parser.h>
+#include <dali-toolkit/internal/builder/json-snapshot.h>
 
 namespace Dali
 {
@@ -38,6 +39,7 @@ namespace
 {
 
 const char ERROR_DESCRIPTION_NONE[] = "No Error";
+const char ERROR_INVALID_SNAPSHOT[] = "Invalid snapshot";
 
 template <typename IteratorType,typename EndIteratorType>
 inline IteratorType Advance(IteratorType& iter, EndIteratorType& end, int n)
@@ -49,6 +51,149 @@ inline IteratorType Advance(IteratorType& iter, EndIteratorType& end, int n)
   return iter;
 }
 
+/*
+ * Builds a TreeNode tree from the values reported by the JsonSaxParser.
+ *
+ * If there is an existing tree then the values are merged into it; named values replace
+ * the children with the same name, and arrays of numbers are replaced rather than appended to.
+ */
+class TreeBuilder : public JsonSaxHandler
+{
+public:
+  TreeBuilder(TreeNode* root, TreeNodeArena& arena)
+  : mRoot(root),
+    mCurrent(nullptr),
+    mArena(arena),
+    mNumberOfCreatedNodes(0),
+    mMerge(root != nullptr)
+  {
+  }
+
+  TreeNode* GetRoot() const
+  {
+    return mRoot;
+  }
+
+  int GetCreatedNodeCount() const
+  {
+    return mNumberOfCreatedNodes;
+  }
+
+  bool StartObject(const char* name) override
+  {
+    mCurrent = NewNode(name, TreeNode::OBJECT);
+    return true;
+  }
+
+  bool EndObject() override
+  {
+    mCurrent = TreeNodeManipulator(mCurrent).GetParent();
+    return true;
+  }
+
+  bool StartArray(const char* name) override
+  {
+    mCurrent = NewNode(name, TreeNode::ARRAY);
+    return true;
+  }
+
+  bool EndArray() override
+  {
+    mCurrent = TreeNodeManipulator(mCurrent).GetParent();
+    return true;
+  }
+
+  bool String(const char* name, const char* value, bool substitution) override
+  {
+    TreeNodeManipulator modify(NewNode(name, TreeNode::STRING));
+    modify.SetString(value);
+    modify.SetSubstitution(substitution);
+    return true;
+  }
+
+  bool Integer(const char* name, int value) override
+  {
+    TreeNodeManipulator(NewNode(name, TreeNode::INTEGER)).SetInteger(value);
+    return true;
+  }
+
+  bool Float(const char* name, float value) override
+  {
+    TreeNodeManipulator(NewNode(name, TreeNode::FLOAT)).SetFloat(value);
+    return true;
+  }
+
+  bool Boolean(const char* name, bool value) override
+  {
+    TreeNodeManipulator(NewNode(name, TreeNode::BOOLEAN)).SetBoolean(value);
+    return true;
+  }
+
+  bool Null(const char* name) override
+  {
+    NewNode(name, TreeNode::IS_NULL);
+    return true;
+  }
+
+private:
+  /*
+   * Create a new node with name and type in the current node, or when merging reuse
+   * the existing node with the same name, setting it to the new type.
+   */
+  TreeNode* NewNode(const char* name, TreeNode::NodeType type)
+  {
+    TreeNode* node = nullptr;
+
+    if(mMerge)
+    {
+      if(nullptr == mCurrent)
+      {
+        node = mRoot;
+      }
+      else if(name)
+      {
+        node = const_cast<TreeNode*>(TreeNodeManipulator(mCurrent).GetChild(name));
+      }
+    }
+
+    if(node)
+    {
+      // Where the new type is different the children of the node are removed, as are
+      // the children of an array of numbers. Other objects and arrays are merged.
+      TreeNodeManipulator modify(node);
+      modify.SetName(name);
+      modify.SetType(type);
+      modify.SetSubstitution(false);
+    }
+    else
+    {
+      node = TreeNodeManipulator::NewTreeNode(mArena);
+      TreeNodeManipulator modify(node);
+      modify.SetType(type);
+      modify.SetName(name);
+
+      if(nullptr == mCurrent)
+      {
+        mRoot = node;
+      }
+      else
+      {
+        TreeNodeManipulator(mCurrent).AddChild(node);
+      }
+
+      ++mNumberOfCreatedNodes;
+    }
+
+    return node;
+  }
+
+  TreeNode* mRoot;            ///< The root node
+  TreeNode* mCurrent;         ///< The open object or array, NULL before the root
+  TreeNodeArena& mArena;      ///< The arena which owns new nodes
+  int mNumberOfCreatedNodes;  ///< The number of nodes created
+  bool mMerge;                ///< Whether the values are merged into an existing tree
+};
+
 } // anon namespace
 
 
@@ -72,7 +217,7 @@ JsonParser::JsonParser(const TreeNode& tree)
     mNumberOfChars(0),
     mNumberOfNodes(0)
 {
-  mRoot = TreeNodeManipulator::Copy( tree, mNumberOfNodes, mNumberOfChars );
+  mRoot = TreeNodeManipulator::Copy( tree, mArena, mNumberOfNodes, mNumberOfChars );
 
   mSources.push_back( VectorChar( (sizeof(char) * mNumberOfChars) ) );
 
@@ -87,27 +232,22 @@ JsonParser::JsonParser(const TreeNode& tree)
 
 JsonParser::~JsonParser()
 {
-  if(mRoot)
-  {
-    TreeNodeManipulator modify(mRoot);
-    modify.RemoveChildren();
-    delete mRoot;
-    mRoot = NULL;
-  }
+  // The nodes are released with mArena
 }
 
 bool JsonParser::Parse(const std::string& source)
 {
   mSources.push_back( VectorChar(source.begin(), source.end()) );
 
-  JsonParserState parserState(mRoot);
+  JsonSaxParser parser;
+  TreeBuilder builder(mRoot, mArena);
 
-  if( parserState.ParseJson(mSources.back()) )
+  if( parser.Parse(mSources.back(), builder) )
   {
-    mRoot = parserState.GetRoot();
+    mRoot = builder.GetRoot();
 
-    mNumberOfChars += parserState.GetParsedStringSize();
-    mNumberOfNodes += parserState.GetCreatedNodeCount();
+    mNumberOfChars += parser.GetParsedStringSize();
+    mNumberOfNodes += builder.GetCreatedNodeCount();
 
     mErrorDescription   = ERROR_DESCRIPTION_NONE;
     mErrorPosition      = 0;
@@ -118,19 +258,48 @@ bool JsonParser::Parse(const std::string& source)
   {
     mRoot = NULL;
 
-    mErrorDescription   = parserState.GetErrorDescription();
+    mErrorDescription   = parser.GetErrorDescription();
     if(NULL == mErrorDescription)
     {
       mErrorDescription = ERROR_DESCRIPTION_NONE;
     }
-    mErrorPosition      = parserState.GetErrorPosition();
-    mErrorLine          = parserState.GetErrorLineNumber();
-    mErrorColumn        = parserState.GetErrorColumn();
+    mErrorPosition      = parser.GetErrorPosition();
+    mErrorLine          = parser.GetErrorLineNumber();
+    mErrorColumn        = parser.GetErrorColumn();
   }
 
   return mRoot != NULL;
 }
 
+bool JsonParser::ParseSnapshot(const std::vector<char>& snapshot)
+{
+  mSources.push_back( snapshot );
+
+  TreeBuilder builder(mRoot, mArena);
+  int stringSize = 0;
+
+  if( ReplayJsonSnapshot(mSources.back(), builder, stringSize) )
+  {
+    mRoot = builder.GetRoot();
+
+    mNumberOfChars += stringSize;
+    mNumberOfNodes += builder.GetCreatedNodeCount();
+
+    mErrorDescription   = ERROR_DESCRIPTION_NONE;
+  }
+  else
+  {
+    mRoot = NULL;
+
+    mErrorDescription   = ERROR_INVALID_SNAPSHOT;
+  }
+
+  mErrorPosition      = 0;
+  mErrorLine          = 0;
+  mErrorColumn        = 0;
+
+  return mRoot != NULL;
+}
 
 const TreeNode* JsonParser::GetRoot() const
 {
@@ -29,6 +29,7 @@
 #include <dali-toolkit/devel-api/builder/tree-node.h>
 
 #include <dali-toolkit/internal/builder/builder-get-is.inl.h>
+#include <dali-toolkit/internal/builder/tree-node-manipulator.h>
 
 namespace Dali
 {
@@ -64,6 +65,14 @@ public:
    */
   bool Parse(const std::string& source);
 
+  /*
+   * Build the tree from a snapshot recorded with RecordJsonSnapshot(), merging it
+   * into the current tree as Parse() does, without parsing the json again.
+   * @param snapshot The snapshot
+   * @return true if the snapshot is valid
+   */
+  bool ParseSnapshot(const std::vector<char>& snapshot);
+
   /*
    * @copydoc Toolkit::JsonParser::Pack()
    */
@@ -116,6 +125,8 @@ private:
 
   SourceContainer mSources;         ///< List of strings from Parse() merge operations
 
+  TreeNodeArena mArena;             ///< Owns all the nodes of the tree
+
   TreeNode* mRoot;                  ///< Tree root
 
   const char *mErrorDescription;    ///< Last parse error description
@@ -0,0 +1,806 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/json-sax-parser.h>
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <cstring>
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#endif
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const char ERROR_STOPPED_BY_HANDLER[] = "Parse stopped by handler";
+
+#if defined( __SSE2__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+const int CHUNK_SIZE = 16; ///< The number of characters scanned at once
+
+#if defined( __SSE2__ )
+
+/**
+ * Find the whitespace in the 16 characters at the given position
+ * @param[in] position The first character
+ * @param[out] newLines A mask with a bit set for each new line character
+ * @return A mask with a bit set for each whitespace character
+ */
+inline uint32_t FindWhiteSpace(const char* position, uint32_t& newLines)
+{
+  const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+  const __m128i newLine = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+  const __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+                                     _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), newLine));
+  newLines = static_cast<uint32_t>(_mm_movemask_epi8(newLine));
+  return static_cast<uint32_t>(_mm_movemask_epi8(blank));
+}
+
+/**
+ * Find the characters which end a run of plain string characters, i.e. quotes, backslashes and control characters
+ * @param[in] position The first character
+ * @return A mask with a bit set for each such character
+ */
+inline uint32_t FindStringSpecial(const char* position)
+{
+  const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+  const __m128i control = _mm_set1_epi8('\x1F');
+  const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+                                       _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
+  return static_cast<uint32_t>(_mm_movemask_epi8(special));
+}
+
+#else // NEON
+
+/**
+ * Gather the top bit of each byte into a 16 bit mask, like _mm_movemask_epi8().
+ */
+inline uint32_t MoveMask(uint8x16_t input)
+{
+  static const uint8_t BIT_WEIGHTS[CHUNK_SIZE] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+  const uint8x16_t bits = vandq_u8(input, vld1q_u8(BIT_WEIGHTS));
+  uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+  sum = vpadd_u8(sum, sum);
+  sum = vpadd_u8(sum, sum);
+  return static_cast<uint32_t>(vget_lane_u8(sum, 0)) | (static_cast<uint32_t>(vget_lane_u8(sum, 1)) << 8);
+}
+
+inline uint32_t FindWhiteSpace(const char* position, uint32_t& newLines)
+{
+  const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(position));
+  const uint8x16_t newLine = vceqq_u8(chunk, vdupq_n_u8('\n'));
+  const uint8x16_t blank = vorrq_u8(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(' ')), vceqq_u8(chunk, vdupq_n_u8('\t'))),
+                                    vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\r')), newLine));
+  newLines = MoveMask(newLine);
+  return MoveMask(blank);
+}
+
+inline uint32_t FindStringSpecial(const char* position)
+{
+  const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(position));
+  const uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('"')), vceqq_u8(chunk, vdupq_n_u8('\\'))),
+                                      vcleq_u8(chunk, vdupq_n_u8(0x1F)));
+  return MoveMask(special);
+}
+
+#endif
+
+#endif // SIMD
+
+// true if character represent a digit
+inline bool IsDigit(char c)
+{
+  return (c >= '0' && c <= '9');
+}
+
+// true if the character can be part of a number
+inline bool IsNumberCharacter(char c)
+{
+  return IsDigit(c) || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-';
+}
+
+// convert string to integer
+bool StringToInteger(const char* first, const char* last, int& out)
+{
+  int sign = 1;
+  if(first != last)
+  {
+    if(*first == '-')
+    {
+      sign = -1;
+      ++first;
+    }
+    else if(*first == '+')
+    {
+      ++first;
+    }
+  }
+
+  if(first == last)
+  {
+    return false;
+  }
+
+  // json error for int starting with zero
+  if(0 == (*first - '0') && (first + 1 != last))
+  {
+    return false;
+  }
+
+  int result = 0;
+  for(; first != last && IsDigit(*first); ++first)
+  {
+    result = 10 * result + (*first - '0');
+  }
+  out = result * sign;
+
+  return first == last;
+}
+
+// convert hexadecimal string to unsigned integer
+bool HexStringToUnsignedInteger(const char* first, const char* last, unsigned int& out)
+{
+  unsigned int result = 0;
+  for(; first != last; ++first)
+  {
+    int digit;
+    if(IsDigit(*first))
+    {
+      digit = *first - '0';
+    }
+    else if(*first >= 'a' && *first <= 'f')
+    {
+      digit = *first - 'a' + 10;
+    }
+    else if(*first >= 'A' && *first <= 'F')
+    {
+      digit = *first - 'A' + 10;
+    }
+    else
+    {
+      break;
+    }
+    result = 16 * result + digit;
+  }
+  out = result;
+
+  return first == last;
+}
+
+// convert string to floating point
+bool StringToFloat(const char* first, const char* last, float& out)
+{
+  // sign
+  float sign = 1;
+  if(first != last)
+  {
+    if(*first == '-')
+    {
+      sign = -1;
+      ++first;
+    }
+    else if(*first == '+')
+    {
+      ++first;
+    }
+  }
+
+  // integer part
+  float result = 0;
+  for(; first != last && IsDigit(*first); ++first)
+  {
+    result = 10 * result + (*first - '0');
+  }
+
+  // fraction part
+  if(first != last && *first == '.')
+  {
+    ++first;
+
+    float inv_base = 0.1f;
+    for(; first != last && IsDigit(*first); ++first)
+    {
+      result += (*first - '0') * inv_base;
+      inv_base *= 0.1f;
+    }
+  }
+
+  // result w\o exponent
+  result *= sign;
+
+  // exponent
+  bool exponent_negative = false;
+  int exponent = 0;
+  if(first != last && (*first == 'e' || *first == 'E'))
+  {
+    ++first;
+
+    if(first != last && *first == '-')
+    {
+      exponent_negative = true;
+      ++first;
+    }
+    else if(first != last && *first == '+')
+    {
+      ++first;
+    }
+
+    if(first == last || !IsDigit(*first))
+    {
+      return false;
+    }
+
+    for(; first != last && IsDigit(*first); ++first)
+    {
+      exponent = 10 * exponent + (*first - '0');
+    }
+  }
+
+  if(exponent)
+  {
+    float power_of_ten = 10;
+    for(; exponent > 1; exponent--)
+    {
+      power_of_ten *= 10;
+    }
+
+    if(exponent_negative)
+    {
+      result /= power_of_ten;
+    }
+    else
+    {
+      result *= power_of_ten;
+    }
+  }
+
+  out = result;
+
+  return first == last;
+}
+
+} // anon namespace
+
+JsonSaxParser::JsonSaxParser()
+  : mStart(nullptr),
+    mIter(nullptr),
+    mEnd(nullptr),
+    mScopes(),
+    mErrorDescription(nullptr),
+    mErrorPosition(0),
+    mLine(0),
+    mLineStart(0),
+    mNumberOfParsedChars(0)
+{
+}
+
+bool JsonSaxParser::Parse(std::vector<char>& source, JsonSaxHandler& handler)
+{
+  mStart = mIter = mEnd = nullptr;
+  mScopes.clear();
+  mErrorDescription = nullptr;
+  mErrorPosition    = 0;
+  mLine             = 0;
+  mLineStart        = 0;
+  mNumberOfParsedChars = 0;
+
+  if(source.empty())
+  {
+    return Error("Empty source buffer to parse");
+  }
+
+  mStart = source.data();
+  mIter  = mStart;
+  mEnd   = mStart + source.size();
+
+  SkipWhiteSpace();
+  if(AtEnd() || ('{' != *mIter && '[' != *mIter))
+  {
+    return Error("Json must start with object {} or array []");
+  }
+
+  const char* name = nullptr;
+  bool expectValue = true;
+  while(true)
+  {
+    SkipWhiteSpace();
+
+    if(!expectValue && mScopes.empty())
+    {
+      if(!AtEnd())
+      {
+        return Error("Unexpected character. Json must have one object or array at its root");
+      }
+      return true;
+    }
+
+    if(AtEnd())
+    {
+      return Error("Unexpected termination character");
+    }
+
+    const char c = *mIter;
+    if(expectValue)
+    {
+      if('{' == c)
+      {
+        if(!handler.StartObject(name))
+        {
+          return Error(ERROR_STOPPED_BY_HANDLER);
+        }
+        mScopes.push_back('{');
+        ++mIter;
+        SkipWhiteSpace();
+
+        if(!AtEnd() && '}' == *mIter)
+        {
+          if(!handler.EndObject())
+          {
+            return Error(ERROR_STOPPED_BY_HANDLER);
+          }
+          mScopes.pop_back();
+          ++mIter;
+          expectValue = false;
+        }
+        else if(!ParseKey(name))
+        {
+          return false;
+        }
+      }
+      else if('[' == c)
+      {
+        if(!handler.StartArray(name))
+        {
+          return Error(ERROR_STOPPED_BY_HANDLER);
+        }
+        mScopes.push_back('[');
+        ++mIter;
+        SkipWhiteSpace();
+        name = nullptr;
+
+        if(!AtEnd() && ']' == *mIter)
+        {
+          if(!handler.EndArray())
+          {
+            return Error(ERROR_STOPPED_BY_HANDLER);
+          }
+          mScopes.pop_back();
+          ++mIter;
+          expectValue = false;
+        }
+      }
+      else if(',' == c)
+      {
+        return Error("Missing Value");
+      }
+      else
+      {
+        if(!ParseScalar(name, handler))
+        {
+          return false;
+        }
+        expectValue = false;
+      }
+    }
+    else if(',' == c)
+    {
+      ++mIter;
+      SkipWhiteSpace();
+      if(!AtEnd() && ('}' == *mIter || ']' == *mIter))
+      {
+        return Error("Unexpected comma");
+      }
+
+      name = nullptr;
+      if('{' == mScopes.back() && !ParseKey(name))
+      {
+        return false;
+      }
+      expectValue = true;
+    }
+    else if('}' == c || ']' == c)
+    {
+      if(('}' == c) != ('{' == mScopes.back()))
+      {
+        return Error(('}' == c) ? "Mismatched array definition" : "Mismatched braces in object definition");
+      }
+      if(!(('}' == c) ? handler.EndObject() : handler.EndArray()))
+      {
+        return Error(ERROR_STOPPED_BY_HANDLER);
+      }
+      mScopes.pop_back();
+      ++mIter;
+    }
+    else
+    {
+      return Error("Expected a comma");
+    }
+  }
+}
+
+void JsonSaxParser::SkipWhiteSpace()
+{
+  while(!AtEnd())
+  {
+#if defined( __SSE2__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+    while(mEnd - mIter >= CHUNK_SIZE)
+    {
+      uint32_t newLines = 0;
+      const uint32_t notWhiteSpace = ~FindWhiteSpace(mIter, newLines) & 0xFFFF;
+      const int length = notWhiteSpace ? __builtin_ctz(notWhiteSpace) : CHUNK_SIZE;
+
+      newLines &= (1u << length) - 1u;
+      if(newLines)
+      {
+        mLine += __builtin_popcount(newLines);
+        mLineStart = static_cast<int>(mIter - mStart) + 31 - __builtin_clz(newLines);
+      }
+
+      mIter += length;
+      if(length < CHUNK_SIZE)
+      {
+        break;
+      }
+    }
+#endif
+
+    for(; !AtEnd(); ++mIter)
+    {
+      const char c = *mIter;
+      if('\n' == c)
+      {
+        ++mLine;
+        mLineStart = static_cast<int>(mIter - mStart);
+      }
+      else if(!(' ' == c || '\t' == c || '\r' == c))
+      {
+        break;
+      }
+    }
+
+    if(mEnd - mIter < 2 || '/' != mIter[0])
+    {
+      break;
+    }
+
+    if('/' == mIter[1])
+    {
+      // the new line ending the comment is counted as whitespace
+      char* newLine = static_cast<char*>(std::memchr(mIter, '\n', mEnd - mIter));
+      mIter = newLine ? newLine : mEnd;
+    }
+    else if('*' == mIter[1])
+    {
+      for(mIter += 2; !AtEnd(); ++mIter)
+      {
+        if('\n' == *mIter)
+        {
+          ++mLine;
+          mLineStart = static_cast<int>(mIter - mStart);
+        }
+        else if('*' == *mIter && mEnd - mIter >= 2 && '/' == mIter[1])
+        {
+          mIter += 2;
+          break;
+        }
+      }
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+bool JsonSaxParser::ParseKey(const char*& name)
+{
+  if(AtEnd())
+  {
+    return Error("Unexpected termination character");
+  }
+  if('"' != *mIter)
+  {
+    return Error("Unexpected character");
+  }
+  ++mIter;
+
+  bool substitution = false;
+  name = DecodeString(substitution);
+  if(nullptr == name)
+  {
+    return false;
+  }
+
+  SkipWhiteSpace();
+  if(AtEnd() || ':' != *mIter)
+  {
+    return Error("Expected ':'");
+  }
+  ++mIter;
+  return true;
+}
+
+bool JsonSaxParser::ParseScalar(const char* name, JsonSaxHandler& handler)
+{
+  bool handled = true;
+  switch(*mIter)
+  {
+    case '"':
+    {
+      ++mIter;
+      bool substitution = false;
+      const char* value = DecodeString(substitution);
+      if(nullptr == value)
+      {
+        return false;
+      }
+      handled = handler.String(name, value, substitution);
+      break;
+    }
+    case 't':
+    {
+      if(!ParseSymbol("true"))
+      {
+        return Error("Unexpected character; expected symbol ie 'true'");
+      }
+      handled = handler.Boolean(name, true);
+      break;
+    }
+    case 'f':
+    {
+      if(!ParseSymbol("false"))
+      {
+        return Error("Unexpected character; expected symbol ie 'false'");
+      }
+      handled = handler.Boolean(name, false);
+      break;
+    }
+    case 'n':
+    {
+      if(!ParseSymbol("null"))
+      {
+        return Error("Unexpected character; expected symbol ie 'null'");
+      }
+      handled = handler.Null(name);
+      break;
+    }
+    default:
+    {
+      if('-' == *mIter || IsDigit(*mIter))
+      {
+        return ParseNumber(name, handler);
+      }
+      return Error("Unexpected character");
+    }
+  }
+
+  return handled || Error(ERROR_STOPPED_BY_HANDLER);
+}
+
+bool JsonSaxParser::ParseNumber(const char* name, JsonSaxHandler& handler)
+{
+  char* first = mIter;
+  bool isFloat = false;
+  for(; !AtEnd() && IsNumberCharacter(*mIter); ++mIter)
+  {
+    isFloat = isFloat || '.' == *mIter || 'e' == *mIter || 'E' == *mIter;
+  }
+
+  bool handled = true;
+  if(isFloat)
+  {
+    float f = 0.f;
+    if(!StringToFloat(first, mIter, f))
+    {
+      return Error("Bad float number");
+    }
+    handled = handler.Float(name, f);
+  }
+  else
+  {
+    int i = 0;
+    if(!StringToInteger(first, mIter, i))
+    {
+      return Error("Bad integer number");
+    }
+    handled = handler.Integer(name, i);
+  }
+
+  return handled || Error(ERROR_STOPPED_BY_HANDLER);
+}
+
+bool JsonSaxParser::ParseSymbol(const char* symbol)
+{
+  const size_t length = std::strlen(symbol);
+  if(static_cast<size_t>(mEnd - mIter) < length || 0 != std::memcmp(mIter, symbol, length))
+  {
+    return false;
+  }
+  mIter += length;
+  return true;
+}
+
+char* JsonSaxParser::DecodeString(bool& substitution)
+{
+  char* first = mIter;
+  char* last  = mIter; // where the next unescaped character is written
+
+  while(true)
+  {
+#if defined( __SSE2__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+    // copy runs of plain characters until a quote, backslash or control character
+    while(mEnd - mIter >= CHUNK_SIZE)
+    {
+      const uint32_t special = FindStringSpecial(mIter);
+      const int length = special ? __builtin_ctz(special) : CHUNK_SIZE;
+      if(last != mIter)
+      {
+        std::memmove(last, mIter, length);
+      }
+      last += length;
+      mIter += length;
+      if(special)
+      {
+        break;
+      }
+    }
+#endif
+
+    if(AtEnd())
+    {
+      Error("Unexpected termination character");
+      return nullptr;
+    }
+
+    const char c = *mIter;
+    if('"' == c)
+    {
+      *last = 0;
+      ++mIter;
+      break;
+    }
+    else if(static_cast<unsigned char>(c) < '\x20')
+    {
+      Error("Control characters not allowed in strings");
+      return nullptr;
+    }
+    else if('\\' == c)
+    {
+      if(mEnd - mIter < 2)
+      {
+        Error("Unrecognized escape sequence");
+        return nullptr;
+      }
+
+      switch(mIter[1])
+      {
+        case '"':
+        case '\\':
+        case '/':
+        {
+          *last++ = mIter[1];
+          break;
+        }
+        case 'b':
+        {
+          *last++ = '\b';
+          break;
+        }
+        case 'f':
+        {
+          *last++ = '\f';
+          break;
+        }
+        case 'n':
+        {
+          *last++ = '\n';
+          break;
+        }
+        case 'r':
+        {
+          *last++ = '\r';
+          break;
+        }
+        case 't':
+        {
+          *last++ = '\t';
+          break;
+        }
+        case 'u':
+        {
+          unsigned int codepoint;
+          if(mEnd - mIter < 6)
+          {
+            Error("Bad unicode codepoint; not enough characters");
+            return nullptr;
+          }
+          if(!HexStringToUnsignedInteger(mIter + 2, mIter + 6, codepoint))
+          {
+            Error("Bad unicode codepoint");
+            return nullptr;
+          }
+
+          if(codepoint <= 0x7F)
+          {
+            *last++ = static_cast<char>(codepoint);
+          }
+          else if(codepoint <= 0x7FF)
+          {
+            *last++ = static_cast<char>(0xC0 | (codepoint >> 6));
+            *last++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+          }
+          else
+          {
+            *last++ = static_cast<char>(0xE0 | (codepoint >> 12));
+            *last++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            *last++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+          }
+
+          mIter += 4;
+          break;
+        }
+        default:
+        {
+          Error("Unrecognized escape sequence");
+          return nullptr;
+        }
+      }
+
+      mIter += 2;
+    }
+    else
+    {
+      *last++ = c;
+      ++mIter;
+    }
+  }
+
+  mNumberOfParsedChars += static_cast<int>(last - first) + 1; // null terminator
+
+  // A {reference} is an opening brace followed, anywhere later, by a closing one.
+  const char* open = static_cast<const char*>(std::memchr(first, '{', last - first));
+  substitution = (nullptr != open) && (nullptr != std::memchr(open + 1, '}', last - open - 1));
+
+  return first;
+}
+
+bool JsonSaxParser::Error(const char* description)
+{
+  mErrorDescription = description;
+  mErrorPosition    = mStart ? static_cast<int>(mIter - mStart) : 0;
+  return false;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,246 @@
+#ifndef DALI_JSON_SAX_PARSER_H
+#define DALI_JSON_SAX_PARSER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * Receives the values of a json document in document order.
+ *
+ * Names and string values are null terminated and point into the buffer being parsed.
+ * The name is NULL for array elements and for the root.
+ * Returning false from any of the methods stops the parse.
+ */
+class JsonSaxHandler
+{
+public:
+  /**
+   * Destructor
+   */
+  virtual ~JsonSaxHandler() = default;
+
+  /**
+   * Called at the start of an object, before its members
+   * @param name The name of the object
+   * @return false to stop parsing
+   */
+  virtual bool StartObject(const char* name) = 0;
+
+  /**
+   * Called after the last member of an object
+   * @return false to stop parsing
+   */
+  virtual bool EndObject() = 0;
+
+  /**
+   * Called at the start of an array, before its elements
+   * @param name The name of the array
+   * @return false to stop parsing
+   */
+  virtual bool StartArray(const char* name) = 0;
+
+  /**
+   * Called after the last element of an array
+   * @return false to stop parsing
+   */
+  virtual bool EndArray() = 0;
+
+  /**
+   * Called for a string value
+   * @param name The name of the value
+   * @param value The unescaped string
+   * @param substitution Whether the string contains a {reference} to be substituted
+   * @return false to stop parsing
+   */
+  virtual bool String(const char* name, const char* value, bool substitution) = 0;
+
+  /**
+   * Called for an integer value
+   * @param name The name of the value
+   * @param value The integer
+   * @return false to stop parsing
+   */
+  virtual bool Integer(const char* name, int value) = 0;
+
+  /**
+   * Called for a number with a fraction or an exponent
+   * @param name The name of the value
+   * @param value The number
+   * @return false to stop parsing
+   */
+  virtual bool Float(const char* name, float value) = 0;
+
+  /**
+   * Called for true and false
+   * @param name The name of the value
+   * @param value The boolean
+   * @return false to stop parsing
+   */
+  virtual bool Boolean(const char* name, bool value) = 0;
+
+  /**
+   * Called for null
+   * @param name The name of the value
+   * @return false to stop parsing
+   */
+  virtual bool Null(const char* name) = 0;
+};
+
+/**
+ * Parses json, reporting the values to a JsonSaxHandler as they are read.
+ *
+ * Accepts the same json as the builder always has, including C and C++ style comments.
+ * Strings are unescaped in place, so no memory is allocated per value.
+ * Whitespace and string bodies are scanned 16 characters at a time where SSE2 or NEON is available.
+ */
+class JsonSaxParser
+{
+public:
+  /**
+   * Constructor
+   */
+  JsonSaxParser();
+
+  /**
+   * Parse json source
+   * The source is modified in place and must outlive any use of the names and strings passed to the handler.
+   * @param source The vector buffer to parse
+   * @param handler The handler which receives the values
+   * @return true if parsed successfully
+   */
+  bool Parse(std::vector<char>& source, JsonSaxHandler& handler);
+
+  /**
+   * Get the error description of the last parse
+   * @return The error description or NULL if no error
+   */
+  const char* GetErrorDescription() const { return mErrorDescription; }
+
+  /**
+   * Get the error line number
+   * @return The line number of the error
+   */
+  int GetErrorLineNumber() const { return mLine; }
+
+  /**
+   * Get the error column
+   * @return The error column
+   */
+  int GetErrorColumn() const { return mErrorPosition - mLineStart; }
+
+  /**
+   * Get the error position
+   * @return The error position
+   */
+  int GetErrorPosition() const { return mErrorPosition; }
+
+  /**
+   * Get the size of the string data that has been parsed, including null terminators
+   * @return The size of string data
+   */
+  int GetParsedStringSize() const { return mNumberOfParsedChars; }
+
+private:
+  JsonSaxParser(const JsonSaxParser&) = delete;
+  JsonSaxParser& operator=(const JsonSaxParser&) = delete;
+
+  /**
+   * Skip whitespace and comments, counting new lines
+   */
+  void SkipWhiteSpace();
+
+  /**
+   * Parse a key and the following ':'
+   * @param[out] name The unescaped key
+   * @return true if parsed successfully
+   */
+  bool ParseKey(const char*& name);
+
+  /**
+   * Parse a value which is not an object or an array and pass it to the handler
+   * @param name The name of the value
+   * @param handler The handler which receives the value
+   * @return true if parsed successfully
+   */
+  bool ParseScalar(const char* name, JsonSaxHandler& handler);
+
+  /**
+   * Parse a number and pass it to the handler
+   * @param name The name of the value
+   * @param handler The handler which receives the value
+   * @return true if parsed successfully
+   */
+  bool ParseNumber(const char* name, JsonSaxHandler& handler);
+
+  /**
+   * Parse over a symbol such as 'true'
+   * @param symbol The null terminated symbol
+   * @return true if the symbol was found
+   */
+  bool ParseSymbol(const char* symbol);
+
+  /**
+   * Unescape the string which starts after the opening quote, in place, and null terminate it
+   * @param[out] substitution Whether the string contains a {reference}
+   * @return The start of the string, or NULL on error
+   */
+  char* DecodeString(bool& substitution);
+
+  /**
+   * Set error meta data
+   * @return always false.
+   */
+  bool Error(const char* description);
+
+  /**
+   * @return True if at the end of the data to parse
+   */
+  bool AtEnd() const
+  {
+    return mIter == mEnd;
+  }
+
+  char* mStart;                ///< Start of the buffer being parsed
+  char* mIter;                 ///< Current position
+  char* mEnd;                  ///< End of the buffer being parsed
+  std::vector<char> mScopes;   ///< The open objects '{' and arrays '['
+  const char* mErrorDescription; ///< The error description if set
+  int mErrorPosition;          ///< The error position
+  int mLine;                   ///< The number of new lines before the current position
+  int mLineStart;              ///< The position of the last new line
+  int mNumberOfParsedChars;    ///< The size of string data
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_JSON_SAX_PARSER_H
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/builder/json-snapshot.h>
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <cstring>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+enum ValueType
+{
+  START_OBJECT = 1,
+  END_OBJECT,
+  START_ARRAY,
+  END_ARRAY,
+  STRING,
+  INTEGER,
+  FLOAT,
+  BOOLEAN,
+  NULL_VALUE
+};
+
+const char TYPE_MASK    = 0x0f;
+const char HAS_NAME     = 0x10; ///< The tag is followed by a name
+const char SUBSTITUTION = 0x20; ///< The string contains a {reference}
+
+/**
+ * Reads the values of a snapshot, checking they don't run past its end.
+ */
+class SnapshotReader
+{
+public:
+  SnapshotReader(const std::vector<char>& snapshot)
+  : mIter(snapshot.data()),
+    mEnd(snapshot.data() + snapshot.size()),
+    mStringSize(0)
+  {
+  }
+
+  bool AtEnd() const
+  {
+    return mIter == mEnd;
+  }
+
+  char ReadTag()
+  {
+    return *mIter++;
+  }
+
+  /**
+   * Read a null terminated string, returning NULL if the snapshot is truncated
+   */
+  const char* ReadString()
+  {
+    const char* terminator = static_cast<const char*>(std::memchr(mIter, '\0', mEnd - mIter));
+    if(!terminator)
+    {
+      return nullptr;
+    }
+
+    const char* string = mIter;
+    mIter = terminator + 1;
+    mStringSize += static_cast<int>(mIter - string);
+    return string;
+  }
+
+  bool Read(void* data, std::size_t size)
+  {
+    if(static_cast<std::size_t>(mEnd - mIter) < size)
+    {
+      return false;
+    }
+
+    std::memcpy(data, mIter, size);
+    mIter += size;
+    return true;
+  }
+
+  int GetStringSize() const
+  {
+    return mStringSize;
+  }
+
+private:
+  const char* mIter;
+  const char* mEnd;
+  int mStringSize;
+};
+
+} // unnamed namespace
+
+JsonSnapshotRecorder::JsonSnapshotRecorder(std::vector<char>& snapshot)
+: mSnapshot(snapshot)
+{
+}
+
+bool JsonSnapshotRecorder::StartObject(const char* name)
+{
+  AppendTag(START_OBJECT, name);
+  return true;
+}
+
+bool JsonSnapshotRecorder::EndObject()
+{
+  AppendTag(END_OBJECT, nullptr);
+  return true;
+}
+
+bool JsonSnapshotRecorder::StartArray(const char* name)
+{
+  AppendTag(START_ARRAY, name);
+  return true;
+}
+
+bool JsonSnapshotRecorder::EndArray()
+{
+  AppendTag(END_ARRAY, nullptr);
+  return true;
+}
+
+bool JsonSnapshotRecorder::String(const char* name, const char* value, bool substitution)
+{
+  AppendTag(STRING, name, substitution);
+  Append(value, std::strlen(value) + 1);
+  return true;
+}
+
+bool JsonSnapshotRecorder::Integer(const char* name, int value)
+{
+  AppendTag(INTEGER, name);
+  const int32_t number = value;
+  Append(&number, sizeof(number));
+  return true;
+}
+
+bool JsonSnapshotRecorder::Float(const char* name, float value)
+{
+  AppendTag(FLOAT, name);
+  Append(&value, sizeof(value));
+  return true;
+}
+
+bool JsonSnapshotRecorder::Boolean(const char* name, bool value)
+{
+  AppendTag(BOOLEAN, name);
+  mSnapshot.push_back(value ? 1 : 0);
+  return true;
+}
+
+bool JsonSnapshotRecorder::Null(const char* name)
+{
+  AppendTag(NULL_VALUE, name);
+  return true;
+}
+
+void JsonSnapshotRecorder::AppendTag(char type, const char* name, bool substitution)
+{
+  mSnapshot.push_back(type | (name ? HAS_NAME : 0) | (substitution ? SUBSTITUTION : 0));
+  if(name)
+  {
+    Append(name, std::strlen(name) + 1);
+  }
+}
+
+void JsonSnapshotRecorder::Append(const void* data, std::size_t size)
+{
+  const char* bytes = static_cast<const char*>(data);
+  mSnapshot.insert(mSnapshot.end(), bytes, bytes + size);
+}
+
+bool RecordJsonSnapshot(const std::string& source, std::vector<char>& snapshot)
+{
+  std::vector<char> buffer(source.begin(), source.end());
+
+  snapshot.clear();
+  JsonSaxParser parser;
+  JsonSnapshotRecorder recorder(snapshot);
+  return parser.Parse(buffer, recorder);
+}
+
+bool ReplayJsonSnapshot(const std::vector<char>& snapshot, JsonSaxHandler& handler, int& stringSize)
+{
+  SnapshotReader reader(snapshot);
+  int depth = 0;
+  bool replayedRoot = false;
+  bool ok = !reader.AtEnd();
+
+  while(ok && !reader.AtEnd())
+  {
+    const char tag = reader.ReadTag();
+    const char type = tag & TYPE_MASK;
+
+    const char* name = nullptr;
+    if(tag & HAS_NAME)
+    {
+      name = reader.ReadString();
+      ok = (name != nullptr);
+    }
+
+    // There is a single root, and the values after it are in objects or arrays
+    const bool isEnd = (type == END_OBJECT) || (type == END_ARRAY);
+    if(isEnd ? (depth == 0) : (depth == 0 && replayedRoot))
+    {
+      ok = false;
+    }
+    replayedRoot = true;
+
+    if(!ok)
+    {
+      break;
+    }
+
+    switch(type)
+    {
+      case START_OBJECT:
+      {
+        ++depth;
+        ok = handler.StartObject(name);
+        break;
+      }
+      case END_OBJECT:
+      {
+        --depth;
+        ok = handler.EndObject();
+        break;
+      }
+      case START_ARRAY:
+      {
+        ++depth;
+        ok = handler.StartArray(name);
+        break;
+      }
+      case END_ARRAY:
+      {
+        --depth;
+        ok = handler.EndArray();
+        break;
+      }
+      case STRING:
+      {
+        const char* value = reader.ReadString();
+        ok = value && handler.String(name, value, (tag & SUBSTITUTION) != 0);
+        break;
+      }
+      case INTEGER:
+      {
+        int32_t value;
+        ok = reader.Read(&value, sizeof(value)) && handler.Integer(name, value);
+        break;
+      }
+      case FLOAT:
+      {
+        float value;
+        ok = reader.Read(&value, sizeof(value)) && handler.Float(name, value);
+        break;
+      }
+      case BOOLEAN:
+      {
+        char value;
+        ok = reader.Read(&value, sizeof(value)) && handler.Boolean(name, value != 0);
+        break;
+      }
+      case NULL_VALUE:
+      {
+        ok = handler.Null(name);
+        break;
+      }
+      default:
+      {
+        ok = false;
+        break;
+      }
+    }
+  }
+
+  stringSize = reader.GetStringSize();
+  return ok && (depth == 0);
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
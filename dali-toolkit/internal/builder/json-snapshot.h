@@ -0,0 +1,104 @@
+#ifndef DALI_JSON_SNAPSHOT_H
+#define DALI_JSON_SNAPSHOT_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/builder/json-sax-parser.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * Records the values reported by the JsonSaxParser as a snapshot, which can be replayed
+ * to a JsonSaxHandler without parsing the json again.
+ *
+ * A snapshot is a sequence of values in document order. Each value is a tag byte giving its
+ * type, then its null terminated name if it has one, then its null terminated string or its
+ * 4 byte number. Names and strings are unescaped, so they are replayed from the snapshot in place.
+ * The numbers are in the byte order of the recording machine.
+ */
+class JsonSnapshotRecorder : public JsonSaxHandler
+{
+public:
+  /**
+   * Constructor
+   * @param snapshot The buffer the values are appended to
+   */
+  explicit JsonSnapshotRecorder(std::vector<char>& snapshot);
+
+  bool StartObject(const char* name) override;
+  bool EndObject() override;
+  bool StartArray(const char* name) override;
+  bool EndArray() override;
+  bool String(const char* name, const char* value, bool substitution) override;
+  bool Integer(const char* name, int value) override;
+  bool Float(const char* name, float value) override;
+  bool Boolean(const char* name, bool value) override;
+  bool Null(const char* name) override;
+
+private:
+  /**
+   * Append the tag and the name of a value
+   */
+  void AppendTag(char type, const char* name, bool substitution = false);
+
+  /**
+   * Append raw bytes
+   */
+  void Append(const void* data, std::size_t size);
+
+  std::vector<char>& mSnapshot; ///< The recorded values
+};
+
+/**
+ * Parse json source and record it as a snapshot
+ * @param source The json source
+ * @param[out] snapshot The snapshot
+ * @return true if the source was parsed successfully
+ */
+bool RecordJsonSnapshot(const std::string& source, std::vector<char>& snapshot);
+
+/**
+ * Replay a snapshot to a handler
+ * The names and strings passed to the handler point into the snapshot.
+ * A snapshot which is truncated or unbalanced is rejected, but only after the values before the error are replayed.
+ * @param snapshot The snapshot
+ * @param handler The handler which receives the values
+ * @param[out] stringSize The size of the string data replayed, including null terminators
+ * @return true if the whole snapshot was replayed
+ */
+bool ReplayJsonSnapshot(const std::vector<char>& snapshot, JsonSaxHandler& handler, int& stringSize);
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_JSON_SNAPSHOT_H
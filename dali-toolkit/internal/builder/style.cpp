@@ -15,6 +15,7 @@
  */
 
 #include <dali/public-api/object/handle.h>
+#include <dali/public-api/object/property-index-ranges.h>
 #include <dali/devel-api/scripting/scripting.h>
 #include <dali-toolkit/public-api/controls/control.h>
 #include <dali-toolkit/devel-api/controls/control-devel.h>
@@ -33,6 +34,60 @@ namespace Internal
 extern const Dali::Scripting::StringEnum ControlStateTable[];
 extern const unsigned int ControlStateTableCount;
 
+namespace
+{
+
+/**
+ * Get the type of a visual map, returning false if it gives none.
+ */
+bool GetVisualType( const Property::Map& visualMap, int& visualType )
+{
+  visualType = -1;
+  Property::Value* typeValue = visualMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
+  if( typeValue )
+  {
+    Scripting::GetEnumerationProperty( *typeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, visualType );
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Set a visual property of handle to a visual map, merging in the instanced
+ * properties if the visual types match.
+ */
+void SetVisualProperty( Handle& handle,
+                        Property::Index index,
+                        const Property::Value& visualValue,
+                        bool hasType,
+                        int visualType,
+                        const Property::Map* instancedProperties )
+{
+  if( instancedProperties && hasType )
+  {
+    Property::Value* instanceTypeValue = instancedProperties->Find( Toolkit::Visual::Property::TYPE );
+    if( instanceTypeValue )
+    {
+      int instanceVisualType=-1;
+      Scripting::GetEnumerationProperty( *instanceTypeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, instanceVisualType );
+
+      if( instanceVisualType == visualType )
+      {
+        // Same type - merge remaining instance data
+        Property::Map mergedMap;
+        mergedMap.Merge( *visualValue.GetMap() );
+        mergedMap.Merge( *instancedProperties );
+        handle.SetProperty( index, Property::Value( mergedMap ) );
+        return;
+      }
+    }
+  }
+
+  handle.SetProperty( index, visualValue );
+}
+
+} // unnamed namespace
+
 StylePtr Style::New()
 {
   StylePtr stylePtr( new Style() );
@@ -89,7 +144,28 @@ void Style::ApplyVisuals(
   Handle handle,
   const Dictionary<Property::Map>& instancedProperties ) const
 {
-  ApplyVisuals( handle, visuals, instancedProperties );
+  if( ! mCompiled )
+  {
+    ApplyVisuals( handle, visuals, instancedProperties );
+    return;
+  }
+
+  const std::vector<Property::Index>& indices = GetVisualIndices( handle );
+  for( std::size_t i = 0; i < mCompiledVisuals.size(); ++i )
+  {
+    const CompiledVisual& visual = mCompiledVisuals[i];
+    Property::Index index = indices[i];
+    if( index == Property::INVALID_INDEX )
+    {
+      // Not a property of the type, but it may be a custom property of this control
+      index = handle.GetPropertyIndex( visual.name );
+    }
+    if( index != Property::INVALID_INDEX )
+    {
+      const Property::Map* instancedMap = instancedProperties.FindConst( visual.name );
+      SetVisualProperty( handle, index, visual.value, visual.hasType, visual.visualType, instancedMap );
+    }
+  }
 }
 
 void Style::ApplyVisuals(
@@ -100,7 +176,7 @@ void Style::ApplyVisuals(
   for( Dictionary<Property::Map>::iterator iter = visualMaps.Begin(); iter != visualMaps.End() ; ++iter )
   {
     const std::string& visualName = (*iter).key;
-    Property::Map map = (*iter).entry;
+    const Property::Map& map = (*iter).entry;
     Property::Map* instancedMap = instancedProperties.Find( visualName );
     ApplyVisual( handle, visualName, map, instancedMap );
   }
@@ -116,51 +192,89 @@ void Style::ApplyVisual(
   Dali::Property::Index index = handle.GetPropertyIndex( visualName );
   if( index != Property::INVALID_INDEX )
   {
-    const Property::Map* applyMap = &visualMap;
-    Property::Map mergedMap;
+    int visualType;
+    const bool hasType = GetVisualType( visualMap, visualType );
+    SetVisualProperty( handle, index, Property::Value( visualMap ), hasType, visualType, instancedProperties );
+  }
+}
 
-    // If there are instanced properties, and the visual types match,
-    // merge them into the visual map
-    if( instancedProperties )
+void Style::ApplyProperties( Handle handle ) const
+{
+  if( mCompiled )
+  {
+    for( const auto& property : mCompiledProperties )
     {
-      Property::Value* instanceTypeValue = instancedProperties->Find( Toolkit::Visual::Property::TYPE);
-      Property::Value* newTypeValue = visualMap.Find( Toolkit::Visual::Property::TYPE, VISUAL_TYPE );
-      if( instanceTypeValue && newTypeValue )
-      {
-        int instanceVisualType=-1;
-        int newVisualType=-1;
-        Scripting::GetEnumerationProperty( *instanceTypeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, instanceVisualType );
-        Scripting::GetEnumerationProperty( *newTypeValue, VISUAL_TYPE_TABLE, VISUAL_TYPE_TABLE_COUNT, newVisualType );
-
-        if( instanceVisualType == newVisualType )
-        {
-          // Same type - merge remaining instance data
-          mergedMap.Merge( visualMap );
-          mergedMap.Merge( *instancedProperties );
-          applyMap = &mergedMap;
-        }
-      }
+      handle.SetProperty( property.first, property.second );
     }
+    return;
+  }
 
-    // Apply the visual property map to the handle
-    const Property::Value value(const_cast<Property::Map&>(*applyMap));
-    handle.SetProperty( index, value );
+  for( Property::Map::SizeType i=0; i<properties.Count(); ++i )
+  {
+    KeyValuePair keyValue = properties.GetKeyValue( i );
+    if( keyValue.first.type == Property::Key::INDEX )
+    {
+      handle.SetProperty( keyValue.first.indexKey, keyValue.second );
+    }
   }
 }
 
-void Style::ApplyProperties( Handle handle ) const
+void Style::Compile()
 {
+  mCompiledVisuals.clear();
+  for( Dictionary<Property::Map>::iterator iter = visuals.Begin(); iter != visuals.End() ; ++iter )
+  {
+    CompiledVisual visual;
+    visual.name = (*iter).key;
+    visual.value = Property::Value( (*iter).entry );
+    visual.hasType = GetVisualType( (*iter).entry, visual.visualType );
+    mCompiledVisuals.push_back( std::move( visual ) );
+  }
+
+  mCompiledProperties.clear();
   for( Property::Map::SizeType i=0; i<properties.Count(); ++i )
   {
     KeyValuePair keyValue = properties.GetKeyValue( i );
     if( keyValue.first.type == Property::Key::INDEX )
     {
-      handle.SetProperty( keyValue.first.indexKey, keyValue.second );
+      mCompiledProperties.emplace_back( keyValue.first.indexKey, keyValue.second );
+    }
+  }
+
+  mVisualIndices.clear();
+  mCompiled = true;
+
+  for( Dictionary<StylePtr>::iterator iter = subStates.Begin(); iter != subStates.End() ; ++iter )
+  {
+    (*iter).entry->Compile();
+  }
+}
+
+const std::vector<Property::Index>& Style::GetVisualIndices( Handle handle ) const
+{
+  auto iter = mVisualIndices.find( handle.GetTypeName() );
+  if( iter != mVisualIndices.end() )
+  {
+    return iter->second;
+  }
+
+  std::vector<Property::Index>& indices = mVisualIndices[ handle.GetTypeName() ];
+  indices.reserve( mCompiledVisuals.size() );
+  for( const auto& visual : mCompiledVisuals )
+  {
+    // Only the default and registered properties are the same for every control of the type
+    Property::Index index = handle.GetPropertyIndex( visual.name );
+    if( index >= PROPERTY_CUSTOM_START_INDEX )
+    {
+      index = Property::INVALID_INDEX;
     }
+    indices.push_back( index );
   }
+  return indices;
 }
 
 Style::Style()
+: mCompiled( false )
 {
 }
 Style::~Style()
@@ -17,6 +17,10 @@
  * limitations under the License.
  */
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali-toolkit/devel-api/visual-factory/transition-data.h>
 #include <dali-toolkit/internal/builder/dictionary.h>
@@ -42,6 +46,11 @@ typedef IntrusivePtr<Style> StylePtr;
  *
  * It has methods to enable the base control to apply visuals and
  * properties per state.
+ *
+ * Once recorded, a style is compiled so that applying it to a control
+ * is a loop of indexed SetProperty() calls: the visual maps are wrapped
+ * in property values and their visual types parsed once, and the
+ * indices of the visual properties are resolved once per control type.
  */
 class Style : public RefObject
 {
@@ -99,6 +108,13 @@ public:
    */
   void ApplyProperties( Handle handle ) const;
 
+  /**
+   * Compile the visuals and properties of the style and of its states
+   * for them to be applied without lookups by name. Called once they
+   * are recorded, as they aren't compiled again when changed.
+   */
+  void Compile();
+
 protected:
   /**
    * @brief Default constructor.
@@ -117,6 +133,27 @@ private:
   // Not implemented
   DALI_INTERNAL Style& operator=(const Style& rhs);
 
+  struct CompiledVisual
+  {
+    std::string name;      ///< The name of the visual property
+    Property::Value value; ///< The visual map, wrapped once rather than per control
+    int visualType;        ///< The parsed visual type, -1 if unknown
+    bool hasType;          ///< Whether the visual map gives a type
+  };
+
+  /**
+   * Get the indices of the visual properties in the type of the handle,
+   * resolving them for the first control of the type.
+   * Property::INVALID_INDEX is given for the names which are not
+   * properties of the type.
+   */
+  const std::vector<Property::Index>& GetVisualIndices( Handle handle ) const;
+
+  std::vector<CompiledVisual> mCompiledVisuals;
+  std::vector<std::pair<Property::Index, Property::Value> > mCompiledProperties;
+  mutable std::unordered_map<std::string, std::vector<Property::Index> > mVisualIndices; // By type name
+  bool mCompiled;
+
 public:
   // Everything must be shallow-copiable.
   Dictionary<StylePtr> subStates; // Each named style maps to a state.
@@ -17,6 +17,7 @@
 
 // EXTERNAL INCLUDES
 #include <cstring>
+#include <new>
 #include <sstream>
 
 // INTERNAL INCLUDES
@@ -36,6 +37,8 @@ namespace Internal
 namespace
 {
 
+const size_t NODES_PER_ARENA_BLOCK = 256;
+
 void Indent(std::ostream& o, int level, int indentWidth)
 {
   for (int i = 0; i < level*indentWidth; ++i)
@@ -67,14 +70,35 @@ std::string EscapeQuotes( const char* aString)
 
 } // anonymous namespace
 
+TreeNodeArena::TreeNodeArena()
+  : mBlocks(),
+    mNextInBlock(NODES_PER_ARENA_BLOCK)
+{
+}
+
+TreeNodeArena::~TreeNodeArena()
+{
+  // TreeNode has nothing to destroy, so the storage is released as is.
+}
+
+void* TreeNodeArena::Allocate()
+{
+  if(NODES_PER_ARENA_BLOCK == mNextInBlock)
+  {
+    mBlocks.emplace_back(new NodeStorage[NODES_PER_ARENA_BLOCK]);
+    mNextInBlock = 0;
+  }
+  return mBlocks.back()[mNextInBlock++].mData;
+}
+
 TreeNodeManipulator::TreeNodeManipulator(TreeNode* node)
   : mNode(node)
 {
 }
 
-TreeNode* TreeNodeManipulator::NewTreeNode()
+TreeNode* TreeNodeManipulator::NewTreeNode(TreeNodeArena& arena)
 {
-  return new TreeNode();
+  return new(arena.Allocate()) TreeNode();
 }
 
 void TreeNodeManipulator::ShallowCopy(const TreeNode* from, TreeNode* to)
@@ -167,25 +191,14 @@ void TreeNodeManipulator::RemoveChildren()
 {
   DALI_ASSERT_DEBUG(mNode && "Operation on NULL JSON node");
 
-  CollectNodes collector;
-
-  DepthFirst( mNode, collector );
-
-  for(CollectNodes::iterator iter = collector.nodes.begin(); iter != collector.nodes.end(); ++iter)
-  {
-    if( *iter != mNode)
-    {
-      delete *iter;
-    }
-  }
-
+  // The children are owned by the parser's arena, so only unlink them here.
   mNode->mFirstChild = NULL;
   mNode->mLastChild  = NULL;
 }
 
-TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, int& numberNodes, int& numberChars)
+TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, TreeNodeArena& arena, int& numberNodes, int& numberChars)
 {
-  TreeNode* root = NewTreeNode();
+  TreeNode* root = NewTreeNode(arena);
 
   ShallowCopy(&tree, root);
 
@@ -201,12 +214,12 @@ TreeNode* TreeNodeManipulator::Copy(const TreeNode& tree, int& numberNodes, int&
 
   ++numberNodes;
 
-  CopyChildren(&tree, root, numberNodes, numberChars);
+  CopyChildren(&tree, root, arena, numberNodes, numberChars);
 
   return root;
 }
 
-void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, int& numberNodes, int& numberChars)
+void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, TreeNodeArena& arena, int& numberNodes, int& numberChars)
 {
   DALI_ASSERT_DEBUG(from && "Operation on NULL JSON node");
   DALI_ASSERT_DEBUG(to);
@@ -224,7 +237,7 @@ void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, int&
       numberChars += std::strlen(child->mStringValue) + 1;
     }
 
-    TreeNode* newNode = NewTreeNode();
+    TreeNode* newNode = NewTreeNode(arena);
 
     ShallowCopy(child, newNode);
 
@@ -234,7 +247,7 @@ void TreeNodeManipulator::CopyChildren(const TreeNode* from, TreeNode* to, int&
 
     ++numberNodes;
 
-    CopyChildren(child, newNode, numberNodes, numberChars);
+    CopyChildren(child, newNode, arena, numberNodes, numberChars);
   }
 }
 
@@ -22,6 +22,7 @@
 #include <utility> // pair
 #include <iterator>
 #include <cstring>
+#include <memory>
 
 #include <dali-toolkit/public-api/dali-toolkit-common.h>
 #include <dali/public-api/common/vector-wrapper.h>
@@ -40,6 +41,43 @@ namespace Internal
 typedef std::vector<char> VectorChar;
 typedef VectorChar::iterator VectorCharIter;
 
+/*
+ * TreeNodeArena allocates TreeNode storage in blocks rather than one node at a time.
+ * The nodes are released together when the arena is destroyed; removing a node from
+ * its tree does not release it.
+ */
+class TreeNodeArena
+{
+public:
+  /*
+   * Constructor
+   */
+  TreeNodeArena();
+
+  /*
+   * Destructor, releases all the nodes allocated from the arena.
+   */
+  ~TreeNodeArena();
+
+  /*
+   * Allocate uninitialised storage for a single TreeNode.
+   * @return The storage
+   */
+  void* Allocate();
+
+private:
+  TreeNodeArena(const TreeNodeArena&) = delete;
+  TreeNodeArena& operator=(const TreeNodeArena&) = delete;
+
+  struct NodeStorage
+  {
+    alignas(TreeNode) unsigned char mData[sizeof(TreeNode)];
+  };
+
+  std::vector<std::unique_ptr<NodeStorage[]>> mBlocks; ///< The blocks of node storage
+  size_t mNextInBlock;                                  ///< The index of the next free node in the last block
+};
+
 /*
  * TreeNodeManipulator performs modification operations on a TreeNode which are
  * otherwise prohibited on the TreeNode public interface.
@@ -55,9 +93,10 @@ public:
 
   /*
    * Create a new TreeNode instance
+   * @param arena The arena which owns the node
    * @return new TreeNode
    */
-  static TreeNode* NewTreeNode();
+  static TreeNode* NewTreeNode(TreeNodeArena& arena);
 
   /*
    * Shallow copy node data
@@ -76,16 +115,18 @@ public:
 
   /*
    * Remove all children from the node
+   * The children remain allocated in their arena until it is destroyed.
    */
   void RemoveChildren();
 
   /*
    * Make a deep copy of the tree.
    * @param tree The tree to copy
+   * @param arena The arena which owns the new nodes
    * @param numberOfNodes The number of nodes that were copied
    * @param numberOfChars The size of string data.
    */
-  static TreeNode* Copy(const TreeNode& tree, int& numberOfNodes, int& numberOfChars);
+  static TreeNode* Copy(const TreeNode& tree, TreeNodeArena& arena, int& numberOfNodes, int& numberOfChars);
 
   /*
    * Add child to the node
@@ -186,7 +227,7 @@ private:
   /*
    * Recursively copy children
    */
-  static void CopyChildren(const TreeNode* from, TreeNode* to, int& numberNodes, int& numberChars);
+  static void CopyChildren(const TreeNode* from, TreeNode* to, TreeNodeArena& arena, int& numberNodes, int& numberChars);
 
   /*
    * Do write to string stream
@@ -36,6 +36,7 @@
 #include <dali-toolkit/internal/controls/gaussian-blur-view/gaussian-blur-view-impl.h>
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace Dali
 {
@@ -367,21 +368,14 @@ void BloomView::AllocateResources()
     // Create render targets
 
     // create off screen buffer of new size to render our child actors to
-    mRenderTargetForRenderingChildren = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-    Texture textureForChildren = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-    mRenderTargetForRenderingChildren.AttachColorTexture( textureForChildren );
+    RenderTargetPoolPtr renderTargetPool = RenderTargetPool::Get();
+    mRenderTargetForRenderingChildren = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
-    mBloomExtractTarget = FrameBuffer::New( mDownsampledWidth, mDownsampledHeight, FrameBuffer::Attachment::NONE );
-    Texture texture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mDownsampledWidth), unsigned(mDownsampledHeight) );
-    mBloomExtractTarget.AttachColorTexture( texture );
+    mBloomExtractTarget = renderTargetPool->Acquire( unsigned(mDownsampledWidth), unsigned(mDownsampledHeight), mPixelFormat );
 
-    FrameBuffer blurExtractTarget = FrameBuffer::New( mDownsampledWidth, mDownsampledHeight, FrameBuffer::Attachment::NONE );
-    texture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mDownsampledWidth), unsigned(mDownsampledHeight) );
-    blurExtractTarget.AttachColorTexture( texture );
+    FrameBuffer blurExtractTarget = renderTargetPool->Acquire( unsigned(mDownsampledWidth), unsigned(mDownsampledHeight), mPixelFormat );
 
-    mOutputRenderTarget = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-    Texture outputTexture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-    mOutputRenderTarget.AttachColorTexture( outputTexture );
+    mOutputRenderTarget = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
     //////////////////////////////////////////////////////
     // Point actors and render tasks at new render targets
@@ -454,6 +448,11 @@ void BloomView::RemoveRenderTasks()
   GetImpl(mGaussianBlurView).RemoveRenderTasks();
 
   taskList.RemoveTask(mCompositeTask);
+
+  // the tasks hold their render targets, which go back to the pool once released
+  mRenderChildrenTask.Reset();
+  mBloomExtractTask.Reset();
+  mCompositeTask.Reset();
 }
 
 void BloomView::Activate()
@@ -479,6 +478,9 @@ void BloomView::Deactivate()
   mTargetActor.RemoveRenderer( 0u );
   mCompositeActor.RemoveRenderer( 0u );
 
+  // the blur renders from and to render targets of the pool too
+  mGaussianBlurView.SetUserImageAndOutputRenderTarget( Texture(), FrameBuffer() );
+
   mGaussianBlurView.SetProperty( Actor::Property::VISIBLE, false );
 
   mActivated = false;
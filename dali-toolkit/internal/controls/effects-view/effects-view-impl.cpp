@@ -37,6 +37,7 @@
 #include <dali-toolkit/internal/filters/spread-filter.h>
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace Dali
 {
@@ -434,17 +435,14 @@ void EffectsView::AllocateResources()
 
     Actor self( Self() );
 
-    mFrameBufferForChildren = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-    Texture textureForChildren = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-    mFrameBufferForChildren.AttachColorTexture( textureForChildren );
+    RenderTargetPoolPtr renderTargetPool = RenderTargetPool::Get();
+    mFrameBufferForChildren = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
-    SetRendererTexture( mRendererForChildren, textureForChildren );
+    SetRendererTexture( mRendererForChildren, mFrameBufferForChildren.GetColorTexture() );
 
-    mFrameBufferPostFilter = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-    Texture texturePostFilter = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-    mFrameBufferPostFilter.AttachColorTexture( texturePostFilter );
+    mFrameBufferPostFilter = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
-    SetRendererTexture( mRendererPostFilter, texturePostFilter );
+    SetRendererTexture( mRendererPostFilter, mFrameBufferPostFilter.GetColorTexture() );
 
     SetupFilters();
   }
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/gaussian-blur-view/gaussian-blur-kernel.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+float CalculateGaussianWeight( float x, float blurBellCurveWidth )
+{
+  // The normalisation of the kernel makes the constant factor of the Gaussian function unnecessary.
+  return std::exp( -( x * x ) / ( 2.0f * blurBellCurveWidth * blurBellCurveWidth ) );
+}
+
+} // namespace
+
+void CalculateGaussianKernel( unsigned int numSamples, float blurBellCurveWidth, std::vector< float >& weights )
+{
+  // Each sample on either side of the centre spans two texels, so the kernel and the bell curve are twice as wide in texels.
+  const unsigned int radius = ( numSamples >> 1 ) << 1;
+  const float texelBellCurveWidth = 2.0f * blurBellCurveWidth;
+
+  weights.resize( radius + 1u );
+
+  float totalWeights = weights[0] = CalculateGaussianWeight( 0.0f, texelBellCurveWidth );
+  for( unsigned int i = 1u; i <= radius; ++i )
+  {
+    weights[i] = CalculateGaussianWeight( static_cast< float >( i ), texelBellCurveWidth );
+    totalWeights += 2.0f * weights[i];
+  }
+
+  for( auto&& weight : weights )
+  {
+    weight /= totalWeights;
+  }
+}
+
+unsigned int GetNumberOfLinearSamples( unsigned int numSamples )
+{
+  return 1u + ( ( numSamples >> 1 ) << 1 );
+}
+
+void CalculateLinearSamplingKernel( unsigned int numSamples, float blurBellCurveWidth, std::vector< float >& offsets, std::vector< float >& weights )
+{
+  std::vector< float > referenceWeights;
+  CalculateGaussianKernel( numSamples, blurBellCurveWidth, referenceWeights );
+
+  const unsigned int radius = referenceWeights.size() - 1u;
+
+  offsets.clear();
+  weights.clear();
+
+  // The centre texel is fetched on its own, the bilinear filter can't share it between both sides.
+  offsets.push_back( 0.0f );
+  weights.push_back( referenceWeights[0] );
+
+  // The radius is even, so every other texel pairs up with the next one.
+  for( unsigned int i = 1u; i < radius; i += 2u )
+  {
+    const float weight1 = referenceWeights[i];
+    const float weight2 = referenceWeights[i + 1u];
+    const float weight = weight1 + weight2;
+
+    // Between the two texels, weighted towards the heavier one. Both weights underflow with very narrow bell curves.
+    const float offset = ( weight > 0.0f ) ? ( static_cast< float >( i ) * weight1 + static_cast< float >( i + 1u ) * weight2 ) / weight : static_cast< float >( i ) + 0.5f;
+    offsets.push_back( offset );
+    weights.push_back( weight );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
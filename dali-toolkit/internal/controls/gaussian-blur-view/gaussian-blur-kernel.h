@@ -0,0 +1,74 @@
+#ifndef DALI_TOOLKIT_INTERNAL_GAUSSIAN_BLUR_KERNEL_H
+#define DALI_TOOLKIT_INTERNAL_GAUSSIAN_BLUR_KERNEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Calculates the reference Gaussian kernel, one tap per texel.
+ *
+ * Each of the samples on either side of the centre spans two texels, as the samples of GaussianBlurView always have,
+ * so the kernel covers 2 * ( numSamples / 2 ) texels on either side and the bell curve is twice as wide in texels.
+ * The kernel is symmetric, so only the centre tap and the taps on one side are returned.
+ *
+ * @param[in] numSamples The size of the kernel, i.e. the number of samples in one direction. An even size is rounded up.
+ * @param[in] blurBellCurveWidth The width of the bell curve, in samples. Must be > 0.0.
+ * @param[out] weights The weight of the centre texel, then the weights of the texels 1, 2, ... away from it on either side.
+ *                     Normalised so the weights of the whole kernel add up to one.
+ */
+void CalculateGaussianKernel( unsigned int numSamples, float blurBellCurveWidth, std::vector< float >& weights );
+
+/**
+ * @brief Retrieves the number of texture fetches of the linear sampling kernel of a given size.
+ *
+ * @param[in] numSamples The size of the kernel.
+ * @return The number of fetches, i.e. the centre one and one per sample, i.e. pair of texels, on either side.
+ */
+unsigned int GetNumberOfLinearSamples( unsigned int numSamples );
+
+/**
+ * @brief Calculates the linear sampling kernel equivalent to the reference Gaussian kernel.
+ *
+ * Each pair of adjacent texels is fetched once, at the offset between them at which the bilinear filter of the
+ * texture hardware weights them as the reference kernel does.
+ *
+ * @param[in] numSamples The size of the kernel.
+ * @param[in] blurBellCurveWidth The width of the bell curve, in samples. Must be > 0.0.
+ * @param[out] offsets The offset in texels of the centre fetch, i.e. zero, then the offsets of the fetches on one side.
+ * @param[out] weights The weight of each of those fetches. The fetches on the other side have the same weights.
+ */
+void CalculateLinearSamplingKernel( unsigned int numSamples, float blurBellCurveWidth, std::vector< float >& offsets, std::vector< float >& weights );
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_GAUSSIAN_BLUR_KERNEL_H
@@ -37,6 +37,8 @@
 #include <dali-toolkit/public-api/visuals/visual-properties.h>
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/controls/gaussian-blur-view/gaussian-blur-kernel.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 // TODO:
 // pixel format / size - set from JSON
@@ -120,12 +122,69 @@ const char* const GAUSSIAN_BLUR_FRAGMENT_SOURCE = DALI_COMPOSE_SHADER(
     }\n
 );
 
+const char* const DUAL_FILTER_HALF_PIXEL_PROPERTY_NAME = "uHalfPixel";
+
+// Downsamples to the next level: the centre and the four diagonal samples each average 2x2 texels of the larger level.
+const char* const DUAL_FILTER_DOWNSAMPLE_FRAGMENT_SOURCE = DALI_COMPOSE_SHADER(
+    varying mediump vec2 vTexCoord;\n
+    uniform sampler2D sTexture;\n
+    uniform mediump vec2 uHalfPixel;\n
+
+    void main()\n
+    {\n
+       mediump vec4 col = texture2D(sTexture, vTexCoord) * 4.0;\n
+       col += texture2D(sTexture, vTexCoord - uHalfPixel);\n
+       col += texture2D(sTexture, vTexCoord + uHalfPixel);\n
+       col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x, -uHalfPixel.y));\n
+       col += texture2D(sTexture, vTexCoord - vec2(uHalfPixel.x, -uHalfPixel.y));\n
+       gl_FragColor = col * 0.125;\n
+    }\n
+);
+
+// Upsamples to the previous level: a ring of eight samples, the diagonal ones between texels of the smaller level weighted twice.
+const char* const DUAL_FILTER_UPSAMPLE_FRAGMENT_SOURCE = DALI_COMPOSE_SHADER(
+    varying mediump vec2 vTexCoord;\n
+    uniform sampler2D sTexture;\n
+    uniform mediump vec2 uHalfPixel;\n
+
+    void main()\n
+    {\n
+       mediump vec4 col = texture2D(sTexture, vTexCoord + vec2(-uHalfPixel.x * 2.0, 0.0));\n
+       col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x * 2.0, 0.0));\n
+       col += texture2D(sTexture, vTexCoord + vec2(0.0, -uHalfPixel.y * 2.0));\n
+       col += texture2D(sTexture, vTexCoord + vec2(0.0, uHalfPixel.y * 2.0));\n
+       col += texture2D(sTexture, vTexCoord - uHalfPixel) * 2.0;\n
+       col += texture2D(sTexture, vTexCoord + uHalfPixel) * 2.0;\n
+       col += texture2D(sTexture, vTexCoord + vec2(uHalfPixel.x, -uHalfPixel.y)) * 2.0;\n
+       col += texture2D(sTexture, vTexCoord - vec2(uHalfPixel.x, -uHalfPixel.y)) * 2.0;\n
+       gl_FragColor = col / 12.0;\n
+    }\n
+);
+
+/**
+ * Half a texel of a level of the dual filter, i.e. of the downsampled size halved as many times as the level.
+ */
+Vector2 GetDualFilterHalfPixel( float downsampledWidth, float downsampledHeight, unsigned int level )
+{
+  return Vector2( 0.5f / static_cast<float>( std::max( 1u, unsigned(downsampledWidth) >> level ) ),
+                  0.5f / static_cast<float>( std::max( 1u, unsigned(downsampledHeight) >> level ) ) );
+}
+
+FrameBuffer CreateDualFilterRenderTarget( float downsampledWidth, float downsampledHeight, unsigned int level, Pixel::Format pixelFormat )
+{
+  const unsigned int width = std::max( 1u, unsigned(downsampledWidth) >> level );
+  const unsigned int height = std::max( 1u, unsigned(downsampledHeight) >> level );
+
+  return RenderTargetPool::Get()->Acquire( width, height, pixelFormat );
+}
+
 } // namespace
 
 
 GaussianBlurView::GaussianBlurView()
 : Control( ControlBehaviour( DISABLE_SIZE_NEGOTIATION | DISABLE_STYLE_CHANGE_SIGNALS ) ),
   mNumSamples(GAUSSIAN_BLUR_VIEW_DEFAULT_NUM_SAMPLES),
+  mNumLinearSamples(GetNumberOfLinearSamples(GAUSSIAN_BLUR_VIEW_DEFAULT_NUM_SAMPLES)),
   mBlurBellCurveWidth( 0.001f ),
   mPixelFormat(GAUSSIAN_BLUR_VIEW_DEFAULT_RENDER_TARGET_PIXEL_FORMAT),
   mDownsampleWidthScale(GAUSSIAN_BLUR_VIEW_DEFAULT_DOWNSAMPLE_WIDTH_SCALE),
@@ -139,6 +198,7 @@ GaussianBlurView::GaussianBlurView()
   mLastSize(Vector2::ZERO),
   mChildrenRoot(Actor::New()),
   mInternalRoot(Actor::New()),
+  mDualFilterLevels( 0u ),
   mBlurStrengthPropertyIndex(Property::INVALID_INDEX),
   mActivated( false )
 {
@@ -153,6 +213,7 @@ GaussianBlurView::GaussianBlurView( const unsigned int numSamples,
                                     bool blurUserImage)
 : Control( ControlBehaviour( DISABLE_SIZE_NEGOTIATION | DISABLE_STYLE_CHANGE_SIGNALS ) ),
   mNumSamples(numSamples),
+  mNumLinearSamples(GetNumberOfLinearSamples(numSamples)),
   mBlurBellCurveWidth( 0.001f ),
   mPixelFormat(renderTargetPixelFormat),
   mDownsampleWidthScale(downsampleWidthScale),
@@ -166,6 +227,7 @@ GaussianBlurView::GaussianBlurView( const unsigned int numSamples,
   mLastSize(Vector2::ZERO),
   mChildrenRoot(Actor::New()),
   mInternalRoot(Actor::New()),
+  mDualFilterLevels( 0u ),
   mBlurStrengthPropertyIndex(Property::INVALID_INDEX),
   mActivated( false )
 {
@@ -239,6 +301,26 @@ Vector4 GaussianBlurView::GetBackgroundColor() const
   return mBackgroundColor;
 }
 
+void GaussianBlurView::SetDualFilterLevels( unsigned int levels )
+{
+  if( levels != mDualFilterLevels )
+  {
+    mDualFilterLevels = levels;
+
+    // if we have already activated the blur, need to recreate the passes for the new filter now
+    if( mActivated )
+    {
+      Deactivate();
+      Activate();
+    }
+  }
+}
+
+unsigned int GaussianBlurView::GetDualFilterLevels() const
+{
+  return mDualFilterLevels;
+}
+
 ///////////////////////////////////////////////////////////
 //
 // Private methods
@@ -254,7 +336,7 @@ void GaussianBlurView::OnInitialize()
   // Create shaders
 
   std::ostringstream fragmentStringStream;
-  fragmentStringStream << "#define NUM_SAMPLES " << mNumSamples << "\n";
+  fragmentStringStream << "#define NUM_SAMPLES " << mNumLinearSamples << "\n";
   fragmentStringStream << GAUSSIAN_BLUR_FRAGMENT_SOURCE;
   std::string fragmentSource(fragmentStringStream.str());
 
@@ -266,11 +348,13 @@ void GaussianBlurView::OnInitialize()
   mHorizBlurActor.SetProperty( Actor::Property::PARENT_ORIGIN,ParentOrigin::CENTER );
   Renderer renderer = CreateRenderer( BASIC_VERTEX_SOURCE, fragmentSource.c_str() );
   mHorizBlurActor.AddRenderer( renderer );
+  mBlurShader = renderer.GetShader();
 
   // Create an actor for performing a vertical blur on the texture
   mVertBlurActor = Actor::New();
   mVertBlurActor.SetProperty( Actor::Property::PARENT_ORIGIN,ParentOrigin::CENTER );
   renderer = CreateRenderer( BASIC_VERTEX_SOURCE, fragmentSource.c_str() );
+  renderer.SetShader( mBlurShader );
   mVertBlurActor.AddRenderer( renderer );
 
   // Register a property that the user can control to fade the blur in / out via the GaussianBlurView object
@@ -407,17 +491,13 @@ void GaussianBlurView::AllocateResources()
     mRenderFullSizeCamera.SetProperty( Actor::Property::POSITION, Vector3(0.0f, 0.0f, mTargetSize.height * cameraPosConstraintScale));
 
     // create offscreen buffer of new size to render our child actors to
-    mRenderTargetForRenderingChildren = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-    Texture texture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-    mRenderTargetForRenderingChildren.AttachColorTexture( texture );
+    mRenderTargetForRenderingChildren = RenderTargetPool::Get()->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
     // Set actor for performing a horizontal blur
     SetRendererTexture( mHorizBlurActor.GetRendererAt(0), mRenderTargetForRenderingChildren );
 
     // Create offscreen buffer for vert blur pass
-    mRenderTarget1 = FrameBuffer::New( mDownsampledWidth, mDownsampledHeight, FrameBuffer::Attachment::NONE );
-    texture = Texture::New(TextureType::TEXTURE_2D, mPixelFormat, unsigned(mDownsampledWidth), unsigned(mDownsampledHeight));
-    mRenderTarget1.AttachColorTexture( texture );
+    mRenderTarget1 = RenderTargetPool::Get()->Acquire( unsigned(mDownsampledWidth), unsigned(mDownsampledHeight), mPixelFormat );
 
     // use the completed blur in the first buffer and composite with the original child actors render
     SetRendererTexture( mCompositingActor.GetRendererAt(0), mRenderTarget1 );
@@ -426,10 +506,15 @@ void GaussianBlurView::AllocateResources()
     SetRendererTexture( mTargetActor.GetRendererAt(0), mRenderTargetForRenderingChildren );
   }
 
-  // Create offscreen buffer for horiz blur pass
-  mRenderTarget2 = FrameBuffer::New( mDownsampledWidth, mDownsampledHeight, FrameBuffer::Attachment::NONE );
-  Texture texture = Texture::New(TextureType::TEXTURE_2D, mPixelFormat, unsigned(mDownsampledWidth), unsigned(mDownsampledHeight));
-  mRenderTarget2.AttachColorTexture( texture );
+  // Create offscreen buffer for horiz blur pass, or for the first level of the dual filter
+  if( mDualFilterLevels > 0u )
+  {
+    mRenderTarget2 = CreateDualFilterRenderTarget( mDownsampledWidth, mDownsampledHeight, 1u, mPixelFormat );
+  }
+  else
+  {
+    mRenderTarget2 = RenderTargetPool::Get()->Acquire( unsigned(mDownsampledWidth), unsigned(mDownsampledHeight), mPixelFormat );
+  }
 
   // size needs to match render target
   mHorizBlurActor.SetProperty( Actor::Property::SIZE, Vector2(mDownsampledWidth, mDownsampledHeight) );
@@ -438,8 +523,60 @@ void GaussianBlurView::AllocateResources()
   mVertBlurActor.SetProperty( Actor::Property::SIZE, Vector2(mDownsampledWidth, mDownsampledHeight) );
   SetRendererTexture( mVertBlurActor.GetRendererAt(0), mRenderTarget2 );
 
-  // set gaussian blur up for new sized render targets
-  SetShaderConstants();
+  if( mDualFilterLevels > 0u )
+  {
+    if( !mDualFilterDownsampleShader )
+    {
+      mDualFilterDownsampleShader = Shader::New( BASIC_VERTEX_SOURCE, DUAL_FILTER_DOWNSAMPLE_FRAGMENT_SOURCE );
+      mDualFilterUpsampleShader = Shader::New( BASIC_VERTEX_SOURCE, DUAL_FILTER_UPSAMPLE_FRAGMENT_SOURCE );
+    }
+    mHorizBlurActor.GetRendererAt(0).SetShader( mDualFilterDownsampleShader );
+    mVertBlurActor.GetRendererAt(0).SetShader( mDualFilterUpsampleShader );
+
+    AllocateDualFilterResources();
+  }
+  else
+  {
+    mHorizBlurActor.GetRendererAt(0).SetShader( mBlurShader );
+    mVertBlurActor.GetRendererAt(0).SetShader( mBlurShader );
+
+    // set gaussian blur up for new sized render targets
+    SetShaderConstants();
+  }
+}
+
+void GaussianBlurView::AllocateDualFilterResources()
+{
+  // The separated blur passes downsample to the first level and upsample from it
+  mHorizBlurActor.RegisterProperty( DUAL_FILTER_HALF_PIXEL_PROPERTY_NAME, GetDualFilterHalfPixel( mDownsampledWidth, mDownsampledHeight, 1u ) );
+  mVertBlurActor.RegisterProperty( DUAL_FILTER_HALF_PIXEL_PROPERTY_NAME, GetDualFilterHalfPixel( mDownsampledWidth, mDownsampledHeight, 1u ) );
+
+  std::vector< FrameBuffer > levels( 1u, mRenderTarget2 );
+  for( unsigned int level = 2u; level <= mDualFilterLevels; ++level )
+  {
+    levels.push_back( CreateDualFilterRenderTarget( mDownsampledWidth, mDownsampledHeight, level, mPixelFormat ) );
+  }
+
+  // Each further level is downsampled from the previous one, then upsampled back into it once the levels below are done
+  for( unsigned int i = 0u, numberOfPasses = 2u * ( mDualFilterLevels - 1u ); i < numberOfPasses; ++i )
+  {
+    const bool downsample = i < mDualFilterLevels - 1u;
+    const unsigned int level = downsample ? i + 2u : 2u * mDualFilterLevels - 1u - i; // the smaller level of the pass
+
+    Actor actor = Actor::New();
+    actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+    actor.SetProperty( Actor::Property::SIZE, Vector2( mDownsampledWidth, mDownsampledHeight ) );
+    actor.RegisterProperty( DUAL_FILTER_HALF_PIXEL_PROPERTY_NAME, GetDualFilterHalfPixel( mDownsampledWidth, mDownsampledHeight, level ) );
+
+    Renderer renderer = CreateRenderer( BASIC_VERTEX_SOURCE, downsample ? DUAL_FILTER_DOWNSAMPLE_FRAGMENT_SOURCE : DUAL_FILTER_UPSAMPLE_FRAGMENT_SOURCE );
+    renderer.SetShader( downsample ? mDualFilterDownsampleShader : mDualFilterUpsampleShader );
+    SetRendererTexture( renderer, downsample ? levels[level - 2u] : levels[level - 1u] );
+    actor.AddRenderer( renderer );
+    mInternalRoot.Add( actor );
+
+    mDualFilterActors.push_back( actor );
+    mDualFilterRenderTargets.push_back( downsample ? levels[level - 1u] : levels[level - 2u] );
+  }
 }
 
 void GaussianBlurView::CreateRenderTasks()
@@ -479,6 +616,24 @@ void GaussianBlurView::CreateRenderTasks()
     mHorizBlurTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
   }
 
+  // with a dual filter, go through the levels below the first one before upsampling from it
+  for( std::size_t i = 0; i < mDualFilterActors.size(); ++i )
+  {
+    RenderTask task = taskList.CreateTask();
+    task.SetSourceActor( mDualFilterActors[i] );
+    task.SetExclusive(true);
+    task.SetInputEnabled( false );
+    task.SetClearEnabled( true );
+    task.SetClearColor( mBackgroundColor );
+    task.SetCameraActor(mRenderDownsampledCamera);
+    task.SetFrameBuffer( mDualFilterRenderTargets[i] );
+    if( mRenderOnce )
+    {
+      task.SetRefreshRate(RenderTask::REFRESH_ONCE);
+    }
+    mDualFilterTasks.push_back( task );
+  }
+
   // use the second buffer and perform a horizontal blur targeting the first buffer
   mVertBlurTask = taskList.CreateTask();
   mVertBlurTask.SetSourceActor( mVertBlurActor );
@@ -525,8 +680,19 @@ void GaussianBlurView::RemoveRenderTasks()
 
   taskList.RemoveTask(mRenderChildrenTask);
   taskList.RemoveTask(mHorizBlurTask);
+  for( auto&& task : mDualFilterTasks )
+  {
+    taskList.RemoveTask(task);
+  }
+  mDualFilterTasks.clear();
   taskList.RemoveTask(mVertBlurTask);
   taskList.RemoveTask(mCompositeTask);
+
+  // the tasks hold their render targets, which go back to the pool once released
+  mRenderChildrenTask.Reset();
+  mHorizBlurTask.Reset();
+  mVertBlurTask.Reset();
+  mCompositeTask.Reset();
 }
 
 void GaussianBlurView::Activate()
@@ -558,6 +724,20 @@ void GaussianBlurView::Deactivate()
     mRenderTargetForRenderingChildren.Reset();
     mRenderTarget1.Reset();
     mRenderTarget2.Reset();
+    // the render targets go back to the pool once nothing renders from their textures either
+    if( !mBlurUserImage )
+    {
+      SetRendererTexture( mHorizBlurActor.GetRendererAt(0), Texture() );
+      SetRendererTexture( mCompositingActor.GetRendererAt(0), Texture() );
+      SetRendererTexture( mTargetActor.GetRendererAt(0), Texture() );
+    }
+    SetRendererTexture( mVertBlurActor.GetRendererAt(0), Texture() );
+    for( auto&& actor : mDualFilterActors )
+    {
+      actor.Unparent();
+    }
+    mDualFilterActors.clear();
+    mDualFilterRenderTargets.clear();
     RemoveRenderTasks();
     mRenderOnce = false;
     mActivated = false;
@@ -570,70 +750,46 @@ void GaussianBlurView::SetBlurBellCurveWidth(float blurBellCurveWidth)
   mBlurBellCurveWidth = std::max( blurBellCurveWidth, 0.001f );
 }
 
-float GaussianBlurView::CalcGaussianWeight(float x)
-{
-  return (1.0f / sqrt(2.0f * Math::PI * mBlurBellCurveWidth)) * exp(-(x * x) / (2.0f * mBlurBellCurveWidth * mBlurBellCurveWidth));
-}
-
 void GaussianBlurView::SetShaderConstants()
 {
-  Vector2 *uvOffsets;
-  float ofs;
-  float *weights;
-  float w, totalWeights;
-  unsigned int i;
-
-  uvOffsets = new Vector2[mNumSamples + 1];
-  weights = new float[mNumSamples + 1];
-
-  totalWeights = weights[0] = CalcGaussianWeight(0);
-  uvOffsets[0].x = 0.0f;
-  uvOffsets[0].y = 0.0f;
-
-  for(i=0; i<mNumSamples >> 1; i++)
-  {
-    w = CalcGaussianWeight((float)(i + 1));
-    weights[(i << 1) + 1] = w;
-    weights[(i << 1) + 2] = w;
-    totalWeights += w * 2.0f;
-
-    // offset texture lookup to between texels, that way the bilinear filter in the texture hardware will average two samples with one lookup
-    ofs = ((float)(i << 1)) + 1.5f;
-
-    // get offsets from units of pixels into uv coordinates in [0..1]
-    float ofsX = ofs / mDownsampledWidth;
-    float ofsY = ofs / mDownsampledHeight;
-    uvOffsets[(i << 1) + 1].x = ofsX;
-    uvOffsets[(i << 1) + 1].y = ofsY;
-
-    uvOffsets[(i << 1) + 2].x = -ofsX;
-    uvOffsets[(i << 1) + 2].y = -ofsY;
-  }
-
-  for(i=0; i<mNumSamples; i++)
+  // adjacent samples of the kernel are fetched together, at the offset between their texels where the bilinear filter in the texture hardware weights them as the kernel does
+  std::vector< float > offsets;
+  std::vector< float > weights;
+  CalculateLinearSamplingKernel( mNumSamples, mBlurBellCurveWidth, offsets, weights );
+
+  // get offsets from units of pixels into uv coordinates in [0..1], the centre fetch first then a fetch either side for each further offset
+  Vector2* uvOffsets = new Vector2[mNumLinearSamples];
+  float* uvWeights = new float[mNumLinearSamples];
+
+  uvOffsets[0] = Vector2::ZERO;
+  uvWeights[0] = weights[0];
+  for( unsigned int i = 1; i < offsets.size(); i++ )
   {
-    weights[i] /= totalWeights;
+    uvOffsets[(i << 1) - 1] = Vector2( offsets[i] / mDownsampledWidth, offsets[i] / mDownsampledHeight );
+    uvOffsets[i << 1] = -uvOffsets[(i << 1) - 1];
+    uvWeights[(i << 1) - 1] = weights[i];
+    uvWeights[i << 1] = weights[i];
   }
 
   // set shader constants
   Vector2 xAxis(1.0f, 0.0f);
   Vector2 yAxis(0.0f, 1.0f);
-  for (i = 0; i < mNumSamples; ++i )
+  for (unsigned int i = 0; i < mNumLinearSamples; ++i )
   {
     mHorizBlurActor.RegisterProperty( GetSampleOffsetsPropertyName( i ), uvOffsets[ i ] * xAxis );
-    mHorizBlurActor.RegisterProperty( GetSampleWeightsPropertyName( i ), weights[ i ] );
+    mHorizBlurActor.RegisterProperty( GetSampleWeightsPropertyName( i ), uvWeights[ i ] );
 
     mVertBlurActor.RegisterProperty( GetSampleOffsetsPropertyName( i ), uvOffsets[ i ] * yAxis );
-    mVertBlurActor.RegisterProperty( GetSampleWeightsPropertyName( i ), weights[ i ] );
+    mVertBlurActor.RegisterProperty( GetSampleWeightsPropertyName( i ), uvWeights[ i ] );
   }
 
   delete[] uvOffsets;
-  delete[] weights;
+  delete[] uvWeights;
 }
 
 std::string GaussianBlurView::GetSampleOffsetsPropertyName( unsigned int index ) const
 {
-  DALI_ASSERT_ALWAYS( index < mNumSamples );
+  DALI_ASSERT_ALWAYS( index < mNumLinearSamples );
 
   std::ostringstream oss;
   oss << "uSampleOffsets[" << index << "]";
@@ -642,7 +798,7 @@ std::string GaussianBlurView::GetSampleOffsetsPropertyName( unsigned int index )
 
 std::string GaussianBlurView::GetSampleWeightsPropertyName( unsigned int index ) const
 {
-  DALI_ASSERT_ALWAYS( index < mNumSamples );
+  DALI_ASSERT_ALWAYS( index < mNumLinearSamples );
 
   std::ostringstream oss;
   oss << "uSampleWeights[" << index << "]";
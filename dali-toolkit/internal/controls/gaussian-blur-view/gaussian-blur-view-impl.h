@@ -21,7 +21,9 @@
 // EXTERNAL INCLUDES
 #include <sstream>
 #include <cmath>
+#include <vector>
 #include <dali/public-api/object/property-map.h>
+#include <dali/public-api/rendering/shader.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/control-impl.h>
@@ -86,6 +88,12 @@ public:
   /// @copydoc Dali::Toolkit::GaussianBlurView::GetBackgroundColor
   Vector4 GetBackgroundColor() const;
 
+  /// @copydoc Dali::Toolkit::GaussianBlurView::SetDualFilterLevels
+  void SetDualFilterLevels( unsigned int levels );
+
+  /// @copydoc Dali::Toolkit::GaussianBlurView::GetDualFilterLevels
+  unsigned int GetDualFilterLevels() const;
+
   void AllocateResources();
   void CreateRenderTasks();
   void RemoveRenderTasks();
@@ -107,8 +115,14 @@ private:
   void OnChildRemove( Actor& child ) override;
 
   void SetBlurBellCurveWidth(float blurBellCurveWidth);
-  float CalcGaussianWeight(float x);
   void SetShaderConstants();
+
+  /**
+   * @brief Creates the actors and render targets of the dual filter levels after the first one.
+   *
+   * The first level reuses the actors and render target of the separated blur passes.
+   */
+  void AllocateDualFilterResources();
   std::string GetSampleOffsetsPropertyName( unsigned int index ) const;
   std::string GetSampleWeightsPropertyName( unsigned int index ) const;
 
@@ -116,6 +130,7 @@ private:
 
   /////////////////////////////////////////////////////////////
   unsigned int mNumSamples;       // number of blur samples in each of horiz/vert directions
+  unsigned int mNumLinearSamples; // number of texture fetches of the shader, adjacent samples are fetched together
   float mBlurBellCurveWidth;      // constant used when calculating the gaussian weights
   Pixel::Format mPixelFormat;     // pixel format used by render targets
 
@@ -170,6 +185,16 @@ private:
   RenderTask mHorizBlurTask;
   RenderTask mVertBlurTask;
 
+  /////////////////////////////////////////////////////////////
+  // for blurring with a dual filter instead, the separated blur passes downsample to and upsample from the first level
+  unsigned int mDualFilterLevels;
+  Shader mBlurShader;
+  Shader mDualFilterDownsampleShader;
+  Shader mDualFilterUpsampleShader;
+  std::vector< FrameBuffer > mDualFilterRenderTargets; // levels after the first one
+  std::vector< Actor > mDualFilterActors;              // downsampling from the second level down, then upsampling back up
+  std::vector< RenderTask > mDualFilterTasks;
+
   /////////////////////////////////////////////////////////////
   // for compositing blur and children renders to offscreen target
   Actor mCompositingActor;
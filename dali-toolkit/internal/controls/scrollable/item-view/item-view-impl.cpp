@@ -35,6 +35,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/item-factory.h>
+#include <dali-toolkit/devel-api/controls/scrollable/item-view/item-factory-devel.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/default-item-layout.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/default-item-layout-property.h>
 #include <dali-toolkit/internal/controls/scrollable/item-view/grid-layout.h>
@@ -68,6 +69,8 @@ const float DEFAULT_KEYBOARD_FOCUS_SCROLL_DURATION = 0.2f;
 
 const unsigned int OVERSHOOT_SIZE_CONSTRAINT_TAG(42);
 
+const size_t MAXIMUM_RECYCLED_ACTORS_PER_TYPE = 64; ///< How many released actors to keep for each item type, for ItemFactory::Extension.
+
 /**
  * Local helper to convert pan distance (in actor coordinates) to the layout-specific scrolling direction
  */
@@ -277,14 +280,18 @@ DALI_ACTION_REGISTRATION(              Toolkit, ItemView, "disableRefresh",
 
 DALI_TYPE_REGISTRATION_END()
 
+bool ItemIdLess( const Item& item, ItemId id )
+{
+  return item.first < id;
+}
+
+// The item pool is kept sorted by item ID, so that items can be found with a binary search.
 const ItemIter FindItemById( ItemContainer& items, ItemId id )
 {
-  for( ItemIter iter = items.begin(); items.end() != iter; ++iter )
+  ItemIter iter = std::lower_bound( items.begin(), items.end(), id, ItemIdLess );
+  if( iter != items.end() && iter->first == id )
   {
-    if( iter->first == id )
-    {
-      return iter;
-    }
+    return iter;
   }
 
   return items.end();
@@ -292,9 +299,9 @@ const ItemIter FindItemById( ItemContainer& items, ItemId id )
 
 void InsertToItemContainer( ItemContainer& items, Item item )
 {
-  if( items.end() == FindItemById( items, item.first ) )
+  ItemIter iterToInsert = std::lower_bound( items.begin(), items.end(), item.first, ItemIdLess );
+  if( iterToInsert == items.end() || iterToInsert->first != item.first )
   {
-    ItemIter iterToInsert = std::lower_bound( items.begin(), items.end(), item );
     items.insert( iterToInsert, item );
   }
 }
@@ -639,13 +646,10 @@ Actor ItemView::GetItem(unsigned int itemId) const
 {
   Actor actor;
 
-  for ( ConstItemIter iter = mItemPool.begin(); iter != mItemPool.end(); ++iter )
+  ConstItemIter iter = std::lower_bound( mItemPool.begin(), mItemPool.end(), itemId, ItemIdLess );
+  if( iter != mItemPool.end() && iter->first == itemId )
   {
-    if( iter->first == itemId )
-    {
-      actor = iter->second;
-      break;
-    }
+    actor = iter->second;
   }
 
   return actor;
@@ -724,6 +728,11 @@ void ItemView::InsertItem( Item newItem, float durationSeconds )
       lastItem.second.RemoveConstraints();
       mActiveLayout->ApplyConstraints( lastItem.second, lastItem.first, layoutSize, Self() );
     }
+    else
+    {
+      // The only item was displaced and is dropped from the ItemPool
+      mRecyclableActorTypes.erase( displacedActor.GetObjectPtr() );
+    }
   }
 
   CalculateDomainSize( layoutSize );
@@ -957,7 +966,7 @@ void ItemView::AddNewActor( unsigned int itemId, const Vector3& layoutSize )
 
   if( mItemPool.end() == FindItemById( mItemPool, itemId ) )
   {
-    Actor actor = mItemFactory.NewItem( itemId );
+    Actor actor = NewActor( itemId );
 
     if( actor )
     {
@@ -973,6 +982,37 @@ void ItemView::AddNewActor( unsigned int itemId, const Vector3& layoutSize )
   mAddingItems = false;
 }
 
+Actor ItemView::NewActor( ItemId itemId )
+{
+  ItemFactory::Extension* extension = mItemFactory.GetExtension();
+  if( !extension )
+  {
+    return mItemFactory.NewItem( itemId );
+  }
+
+  const unsigned int itemType = extension->GetItemType( itemId );
+
+  Actor actor;
+  RecycledActors& recycledActors = mRecycledActors[itemType];
+  if( !recycledActors.empty() )
+  {
+    actor = recycledActors.back();
+    recycledActors.pop_back();
+    extension->RecycleItem( itemId, actor );
+  }
+  else
+  {
+    actor = mItemFactory.NewItem( itemId );
+  }
+
+  if( actor )
+  {
+    mRecyclableActorTypes[actor.GetObjectPtr()] = RecyclableActor{ WeakHandle< Actor >( actor ), itemType };
+  }
+
+  return actor;
+}
+
 void ItemView::SetupActor( Item item, const Vector3& layoutSize )
 {
   item.second.SetProperty( Actor::Property::PARENT_ORIGIN, mItemsParentOrigin );
@@ -992,6 +1032,21 @@ void ItemView::ReleaseActor( ItemId item, Actor actor )
 {
   Self().Remove( actor );
   mItemFactory.ItemReleased(item, actor);
+
+  // Keep the actor for the next item of the same type, if it was made by the factory for reuse.
+  auto typeIter = mRecyclableActorTypes.find( actor.GetObjectPtr() );
+  if( typeIter != mRecyclableActorTypes.end() )
+  {
+    const bool recyclable = typeIter->second.actor.GetHandle() == actor;
+    RecycledActors& recycledActors = mRecycledActors[typeIter->second.itemType];
+    mRecyclableActorTypes.erase( typeIter );
+
+    if( recyclable && recycledActors.size() < MAXIMUM_RECYCLED_ACTORS_PER_TYPE )
+    {
+      actor.RemoveConstraints();
+      recycledActors.push_back( actor );
+    }
+  }
 }
 
 ItemRange ItemView::GetItemRange(ItemLayout& layout, const Vector3& layoutSize, float layoutPosition, bool reserveExtra)
@@ -24,6 +24,8 @@
 #include <dali/public-api/object/property-notification.h>
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/object/property-array.h>
+#include <dali/public-api/object/weak-handle.h>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/control-impl.h>
@@ -389,6 +391,13 @@ private:
    */
   void AddNewActor( ItemId item, const Vector3& layoutSize );
 
+  /**
+   * Get an actor for an item from the ItemFactory; if it has an extension, reuse a released actor of the same item type if there is one.
+   * @param[in] itemId The ID for the new item.
+   * @return The actor, or an uninitialized handle if the factory didn't provide one.
+   */
+  Actor NewActor( ItemId itemId );
+
   /**
    * Apply the constraints etc. that are required for ItemView children.
    * @param[in] item The item to setup.
@@ -398,6 +407,7 @@ private:
 
   /**
    * Remove the Actor from the ItemPool and notify the ItemFactory the actor has been released by ItemView.
+   * Actors that are reusable through the ItemFactory's extension are then kept for the next item of their type.
    * @param[in] item The ID for the item to be released.
    * @param[in] actor The actor to be removed from ItemView.
    */
@@ -616,8 +626,21 @@ private:
 
   Property::Array mlayoutArray;
 
+  using RecycledActors = std::vector< Actor >;
+
+  /**
+   * A reusable actor in the ItemPool. The weak handle tells an actor apart from a later one allocated at the same address.
+   */
+  struct RecyclableActor
+  {
+    WeakHandle< Actor > actor;
+    unsigned int itemType;
+  };
+
   ItemContainer mItemPool;
   ItemFactory& mItemFactory;
+  std::unordered_map< unsigned int, RecycledActors > mRecycledActors;        ///< Released actors that can be reused, by item type
+  std::unordered_map< const BaseObject*, RecyclableActor > mRecyclableActorTypes; ///< The item type of the reusable actors in the ItemPool
   std::vector< ItemLayoutPtr > mLayouts;            ///< Container of Dali::Toolkit::ItemLayout objects
   Actor mOvershootOverlay;                          ///< The overlay actor for overshoot effect
   Animation mResizeAnimation;
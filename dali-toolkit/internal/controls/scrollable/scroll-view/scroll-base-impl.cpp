@@ -29,6 +29,34 @@ namespace Toolkit
 namespace Internal
 {
 
+namespace
+{
+
+/**
+ * Whether the bounds of an actor, moved by the scroll position, are within the margin around the view.
+ * Actors without a size are always within, as they may only be grouping their children.
+ */
+bool IsActorWithinView(Actor actor, const Vector2& scrollPosition, const Vector2& viewSize, float margin)
+{
+  const Vector3 size = actor.GetProperty<Vector3>(Actor::Property::SIZE) * actor.GetProperty<Vector3>(Actor::Property::SCALE);
+  if(size.x <= 0.0f || size.y <= 0.0f)
+  {
+    return true;
+  }
+
+  const Vector3 parentOrigin = actor.GetProperty<Vector3>(Actor::Property::PARENT_ORIGIN);
+  const Vector3 anchorPoint = actor.GetProperty<Vector3>(Actor::Property::ANCHOR_POINT);
+  const Vector3 position = actor.GetProperty<Vector3>(Actor::Property::POSITION);
+
+  const float left = parentOrigin.x * viewSize.x + position.x + scrollPosition.x - anchorPoint.x * size.x;
+  const float top = parentOrigin.y * viewSize.y + position.y + scrollPosition.y - anchorPoint.y * size.y;
+
+  return (left < viewSize.x + margin) && (left + size.x > -margin) &&
+         (top < viewSize.y + margin) && (top + size.y > -margin);
+}
+
+} // unnamed namespace
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // ScrollBase
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +139,60 @@ void ScrollBase::RemoveConstraintsFromBoundActors()
   }
 }
 
+void ScrollBase::CullBoundActors(const Vector2& scrollPosition, const Vector2& viewSize, float margin)
+{
+  for(ActorInfoIter i = mBoundActors.begin();i != mBoundActors.end(); ++i)
+  {
+    ActorInfo& actorInfo = **i;
+    if(actorInfo.mCulled)
+    {
+      if(IsActorWithinView(actorInfo.mActor, scrollPosition, viewSize, margin))
+      {
+        actorInfo.SetCulled(false);
+      }
+    }
+    else if(actorInfo.mActor.GetProperty<bool>(Actor::Property::VISIBLE) &&
+            !IsActorWithinView(actorInfo.mActor, scrollPosition, viewSize, margin * 2.0f))
+    {
+      actorInfo.SetCulled(true);
+    }
+  }
+}
+
+void ScrollBase::UncullBoundActors()
+{
+  for(ActorInfoIter i = mBoundActors.begin();i != mBoundActors.end(); ++i)
+  {
+    (*i)->SetCulled(false);
+  }
+}
+
+unsigned int ScrollBase::GetCulledActorCount() const
+{
+  unsigned int count = 0u;
+  for(ActorInfoConstIter i = mBoundActors.begin();i != mBoundActors.end(); ++i)
+  {
+    if((*i)->mCulled)
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+unsigned int ScrollBase::GetVisibleActorCount() const
+{
+  unsigned int count = 0u;
+  for(ActorInfoConstIter i = mBoundActors.begin();i != mBoundActors.end(); ++i)
+  {
+    if((*i)->mActor.GetProperty<bool>(Actor::Property::VISIBLE))
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
 } // namespace Internal
 
 } // namespace Toolkit
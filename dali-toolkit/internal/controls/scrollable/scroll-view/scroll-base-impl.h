@@ -22,6 +22,8 @@
 // TODO - Replace list with dali-vector.h
 #include <list>
 #include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/devel-api/actors/actor-devel.h>
 
 // INTERNAL INCLUDES
 
@@ -50,24 +52,29 @@ class ScrollBase : public Scrollable
 {
 public:
 
-  struct ActorInfo : public Dali::RefObject
+  struct ActorInfo : public Dali::RefObject, public ConnectionTracker
   {
     /**
      * ActorInfo constructor
      * @param[in] actor The actor that this ActorInfo represents.
      */
     ActorInfo(Actor actor)
-    : mActor(actor)
+    : mActor(actor),
+      mCulled(false),
+      mCulling(false)
     {
+      DevelActor::VisibilityChangedSignal(mActor).Connect(this, &ActorInfo::OnVisibilityChanged);
     }
 
     /**
      * ActorInfo destructor
-     * removes scrollview-related constraints only.
+     * removes scrollview-related constraints only,
+     * and shows the actor again if culled.
      */
     ~ActorInfo()
     {
       RemoveConstraints();
+      SetCulled(false);
     }
 
     /**
@@ -99,8 +106,41 @@ public:
       mConstraints.clear();
     }
 
+    /**
+     * Culls the actor by hiding it, or shows it again.
+     * @param[in] culled Whether the actor is culled.
+     */
+    void SetCulled(bool culled)
+    {
+      if(culled != mCulled)
+      {
+        mCulling = true;
+        mActor.SetProperty(Actor::Property::VISIBLE, !culled);
+        mCulling = false;
+        mCulled = culled;
+      }
+    }
+
+    /**
+     * Called when the visibility of the actor changes.
+     * The actor is no longer culled once the application sets its visibility,
+     * so culling neither counts it nor shows it again over the application's setting.
+     * @param[in] actor The actor whose visibility changed.
+     * @param[in] visible Whether the actor is now visible.
+     * @param[in] type Whether the actor itself or one of its parents changed.
+     */
+    void OnVisibilityChanged(Actor actor, bool visible, DevelActor::VisibilityChange::Type type)
+    {
+      if(!mCulling && type == DevelActor::VisibilityChange::SELF)
+      {
+        mCulled = false;
+      }
+    }
+
     Actor mActor;                                     ///< The Actor that this ActorInfo represents.
     std::vector<Constraint> mConstraints;       ///< A list keeping track of constraints applied to the actor via this delegate.
+    bool mCulled;                                     ///< Whether the actor was hidden by culling.
+    bool mCulling;                                    ///< Whether culling is changing the visibility of the actor.
   };
 
   typedef IntrusivePtr<ActorInfo> ActorInfoPtr;
@@ -180,6 +220,40 @@ public:
    */
   void RemoveConstraintsFromBoundActors();
 
+  /**
+   * Culls the bound actors which are outside of the view, and shows again the culled ones within it.
+   *
+   * The bounds of the actors are their event side bounds moved by the scroll position.
+   * An actor is shown again when its bounds are within the margin around the view,
+   * but only culled when they are beyond twice the margin, so it is not toggled while
+   * scrolling back and forth around the edge.
+   * The actors hidden by the application and the ones without a size are never culled.
+   *
+   * @param[in] scrollPosition The scroll position the bound actors are moved by.
+   * @param[in] viewSize The size of the view.
+   * @param[in] margin The margin around the view.
+   */
+  void CullBoundActors(const Vector2& scrollPosition, const Vector2& viewSize, float margin);
+
+  /**
+   * Shows again all the culled bound actors.
+   */
+  void UncullBoundActors();
+
+  /**
+   * Gets the number of bound actors hidden by culling.
+   *
+   * @return The number of culled actors.
+   */
+  unsigned int GetCulledActorCount() const;
+
+  /**
+   * Gets the number of visible bound actors.
+   *
+   * @return The number of visible actors.
+   */
+  unsigned int GetVisibleActorCount() const;
+
 protected:
 
   static const char* const SCROLL_DOMAIN_OFFSET_PROPERTY_NAME;
@@ -34,6 +34,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/controls/scroll-bar/scroll-bar.h>
+#include <dali-toolkit/devel-api/controls/scrollable/scroll-view/scroll-view-devel.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-view-constraints.h>
 #include <dali-toolkit/public-api/controls/scrollable/scroll-view/scroll-mode.h>
@@ -78,6 +79,8 @@ const Vector2 DEFAULT_WHEEL_SCROLL_DISTANCE_STEP_PROPORTION = Vector2(0.17f, 0.1
 const unsigned long MINIMUM_TIME_BETWEEN_DOWN_AND_UP_FOR_RESET( 150u );
 const float TOUCH_DOWN_TIMER_INTERVAL = 100.0f;
 const float DEFAULT_SCROLL_UPDATE_DISTANCE( 30.0f );                ///< Default distance to travel in pixels for scroll update signal
+const float DEFAULT_CULLING_MARGIN( 100.0f );                       ///< Default margin in pixels around the view within which the children are not culled
+const float MINIMUM_CULLING_STEP( 1.0f );                           ///< Minimum distance to travel in pixels before the culling is updated
 
 const std::string INTERNAL_MAX_POSITION_PROPERTY_NAME( "internalMaxPosition" );
 
@@ -254,6 +257,10 @@ DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "panningEnabled",             B
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "axisAutoLockEnabled",        BOOLEAN,   AXIS_AUTO_LOCK_ENABLED      )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "wheelScrollDistanceStep",    VECTOR2,   WHEEL_SCROLL_DISTANCE_STEP  )
 DALI_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollMode",                 MAP,       SCROLL_MODE )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, ScrollView, "cullingEnabled",             BOOLEAN,   CULLING_ENABLED             )
+DALI_DEVEL_PROPERTY_REGISTRATION( Toolkit, ScrollView, "cullingMargin",              FLOAT,     CULLING_MARGIN              )
+DALI_DEVEL_PROPERTY_REGISTRATION_READ_ONLY( Toolkit, ScrollView, "culledChildCount",   INTEGER,   CULLED_CHILD_COUNT          )
+DALI_DEVEL_PROPERTY_REGISTRATION_READ_ONLY( Toolkit, ScrollView, "visibleChildCount",  INTEGER,   VISIBLE_CHILD_COUNT         )
 
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPosition",  VECTOR2, SCROLL_POSITION)
 DALI_ANIMATABLE_PROPERTY_REGISTRATION( Toolkit, ScrollView, "scrollPrePosition",   VECTOR2, SCROLL_PRE_POSITION)
@@ -636,6 +643,7 @@ ScrollView::ScrollView()
   mScrollStateFlags(0),
   mLockAxis(LockPossible),
   mScrollUpdateDistance(DEFAULT_SCROLL_UPDATE_DISTANCE),
+  mCullingMargin(DEFAULT_CULLING_MARGIN),
   mMaxOvershoot(DEFAULT_MAX_OVERSHOOT, DEFAULT_MAX_OVERSHOOT),
   mUserMaxOvershoot(DEFAULT_MAX_OVERSHOOT, DEFAULT_MAX_OVERSHOOT),
   mSnapOvershootDuration(DEFAULT_SNAP_OVERSHOOT_DURATION),
@@ -665,7 +673,8 @@ ScrollView::ScrollView()
   mDefaultMaxOvershoot(true),
   mCanScrollHorizontal(true),
   mCanScrollVertical(true),
-  mTransientScrollBar(true)
+  mTransientScrollBar(true),
+  mCullingEnabled(false)
 {
 }
 
@@ -1073,6 +1082,12 @@ void ScrollView::SetWrapMode(bool enable)
 {
   mWrapMode = enable;
   Self().SetProperty(Toolkit::ScrollView::Property::WRAP, enable);
+
+  if( mCullingEnabled )
+  {
+    // The wrapped positions of the children are not known on the event side
+    UpdateCulling();
+  }
 }
 
 int ScrollView::GetScrollUpdateDistance() const
@@ -1164,6 +1179,36 @@ void ScrollView::SetWheelScrollDistanceStep(Vector2 step)
   mWheelScrollDistanceStep = step;
 }
 
+void ScrollView::SetCullingEnabled(bool enable)
+{
+  if( mCullingEnabled != enable )
+  {
+    mCullingEnabled = enable;
+    SetCullingNotification( enable );
+    UpdateCulling();
+  }
+}
+
+bool ScrollView::IsCullingEnabled() const
+{
+  return mCullingEnabled;
+}
+
+void ScrollView::SetCullingMargin(float margin)
+{
+  mCullingMargin = std::max( margin, 0.0f );
+  if( mCullingEnabled )
+  {
+    SetCullingNotification( true );
+    UpdateCulling();
+  }
+}
+
+float ScrollView::GetCullingMargin() const
+{
+  return mCullingMargin;
+}
+
 Vector2 ScrollView::GetWheelScrollDistanceStep() const
 {
   return mWheelScrollDistanceStep;
@@ -1928,6 +1973,52 @@ void ScrollView::OnScrollUpdateNotification(Dali::PropertyNotification& source)
   mScrollUpdatedSignal.Emit( currentScrollPosition );
 }
 
+void ScrollView::UpdateCulling()
+{
+  if( mCullingEnabled && !mWrapMode )
+  {
+    Actor self = Self();
+    const Vector2 scrollPosition = self.GetCurrentProperty< Vector2 >( Toolkit::ScrollView::Property::SCROLL_POSITION );
+    const Vector2 viewSize( self.GetProperty< Vector3 >( Actor::Property::SIZE ) );
+    CullBoundActors( scrollPosition, viewSize, mCullingMargin );
+  }
+  else
+  {
+    UncullBoundActors();
+  }
+}
+
+void ScrollView::SetCullingNotification( bool enabled )
+{
+  Actor self = Self();
+  if( mCullingXNotification )
+  {
+    mCullingXNotification.NotifySignal().Disconnect( this, &ScrollView::OnCullingNotification );
+    self.RemovePropertyNotification( mCullingXNotification );
+    mCullingXNotification.Reset();
+  }
+  if( mCullingYNotification )
+  {
+    mCullingYNotification.NotifySignal().Disconnect( this, &ScrollView::OnCullingNotification );
+    self.RemovePropertyNotification( mCullingYNotification );
+    mCullingYNotification.Reset();
+  }
+  if( enabled )
+  {
+    // Updated every half margin, so the children are shown before they are scrolled into the view
+    const float step = std::max( mCullingMargin * 0.5f, MINIMUM_CULLING_STEP );
+    mCullingXNotification = self.AddPropertyNotification( Toolkit::ScrollView::Property::SCROLL_POSITION, 0, StepCondition( step, 0.0f ) );
+    mCullingXNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+    mCullingYNotification = self.AddPropertyNotification( Toolkit::ScrollView::Property::SCROLL_POSITION, 1, StepCondition( step, 0.0f ) );
+    mCullingYNotification.NotifySignal().Connect( this, &ScrollView::OnCullingNotification );
+  }
+}
+
+void ScrollView::OnCullingNotification(Dali::PropertyNotification& source)
+{
+  UpdateCulling();
+}
+
 bool ScrollView::DoConnectSignal( BaseObject* object, ConnectionTrackerInterface* tracker, const std::string& signalName, FunctorDelegate* functor )
 {
   Dali::BaseHandle handle( object );
@@ -1972,6 +2063,10 @@ void ScrollView::OnSizeSet( const Vector3& size )
   {
     mOvershootIndicator->Reset();
   }
+  if( mCullingEnabled )
+  {
+    UpdateCulling();
+  }
 
   ScrollBase::OnSizeSet( size );
 }
@@ -2014,6 +2109,11 @@ void ScrollView::OnChildAdd(Actor& child)
   else if(mAlterChild)
   {
     BindActor(child);
+
+    if( mCullingEnabled )
+    {
+      UpdateCulling();
+    }
   }
 }
 
@@ -2932,6 +3032,17 @@ void ScrollView::SetProperty( BaseObject* object, Property::Index index, const P
         {
           scrollViewImpl.SetScrollMode( *map );
         }
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::CULLING_ENABLED:
+      {
+        scrollViewImpl.SetCullingEnabled( value.Get<bool>() );
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::CULLING_MARGIN:
+      {
+        scrollViewImpl.SetCullingMargin( value.Get<float>() );
+        break;
       }
     }
   }
@@ -2968,6 +3079,26 @@ Property::Value ScrollView::GetProperty( BaseObject* object, Property::Index ind
         value = scrollViewImpl.GetWheelScrollDistanceStep();
         break;
       }
+      case Toolkit::DevelScrollView::Property::CULLING_ENABLED:
+      {
+        value = scrollViewImpl.IsCullingEnabled();
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::CULLING_MARGIN:
+      {
+        value = scrollViewImpl.GetCullingMargin();
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::CULLED_CHILD_COUNT:
+      {
+        value = static_cast<int>( scrollViewImpl.GetCulledActorCount() );
+        break;
+      }
+      case Toolkit::DevelScrollView::Property::VISIBLE_CHILD_COUNT:
+      {
+        value = static_cast<int>( scrollViewImpl.GetVisibleActorCount() );
+        break;
+      }
     }
   }
 
@@ -355,6 +355,30 @@ public:
    */
   void SetWheelScrollDistanceStep(Vector2 step);
 
+  /**
+   * Enables or disables the culling of the children outside of the view.
+   * @param[in] enable Whether to cull the children.
+   */
+  void SetCullingEnabled(bool enable);
+
+  /**
+   * Whether the children outside of the view are culled.
+   * @return true if culling is enabled.
+   */
+  bool IsCullingEnabled() const;
+
+  /**
+   * Sets the margin around the view within which the children are not culled.
+   * @param[in] margin The margin in actor coordinates.
+   */
+  void SetCullingMargin(float margin);
+
+  /**
+   * Gets the margin around the view within which the children are not culled.
+   * @return The margin in actor coordinates.
+   */
+  float GetCullingMargin() const;
+
   /**
    * @copydoc Toolkit::ScrollView::GetCurrentPage
    */
@@ -866,6 +890,22 @@ private:
    */
   void OnScrollUpdateNotification(Dali::PropertyNotification& source);
 
+  /**
+   * Culls the children outside of the view at the current scroll position,
+   * or shows all of them again if culling is disabled.
+   */
+  void UpdateCulling();
+
+  /**
+   * Adds the property notifications updating the culling while scrolling, or removes them.
+   */
+  void SetCullingNotification( bool enabled );
+
+  /**
+   * Updates the culling when the scroll position has moved by a step.
+   */
+  void OnCullingNotification(Dali::PropertyNotification& source);
+
   /**
    * Set up default rulers using a property map
    * @param[in] scrollModeMap A map defining the characteristics of X and Y scrolling
@@ -917,6 +957,10 @@ private:
   Dali::PropertyNotification mScrollXUpdateNotification; ///< scroll x position update notification
   Dali::PropertyNotification mScrollYUpdateNotification; ///< scroll y position update notification
 
+  float mCullingMargin;                 ///< Margin around the view within which the children are not culled
+  Dali::PropertyNotification mCullingXNotification; ///< scroll x position notification updating the culling
+  Dali::PropertyNotification mCullingYNotification; ///< scroll y position notification updating the culling
+
   Actor mInternalActor;                 ///< Internal actor (we keep internal actors in here e.g. scrollbars, so we can ignore it in searches)
 
   ScrollViewEffectContainer mEffects;   ///< Container keeping track of all the applied effects.
@@ -972,6 +1016,7 @@ private:
   bool mCanScrollHorizontal:1;            ///< Local value of our property to check against
   bool mCanScrollVertical:1;              ///< Local value of our property to check against
   bool mTransientScrollBar:1;             ///< True if scroll-bar should be automatically show/hidden during/after panning
+  bool mCullingEnabled:1;                 ///< Whether the children outside of the view are culled
 };
 
 } // namespace Internal
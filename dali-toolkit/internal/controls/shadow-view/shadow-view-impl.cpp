@@ -35,6 +35,7 @@
 #include <dali-toolkit/internal/controls/shadow-view/shadow-view-impl.h>
 #include <dali-toolkit/internal/filters/blur-two-pass-filter.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 // TODO:
 // pixel format / size - set from JSON
@@ -248,13 +249,10 @@ void ShadowView::OnInitialize()
   mCameraActor.SetProperty( Actor::Property::POSITION, DEFAULT_LIGHT_POSITION );
 
   // Create render targets needed for rendering from light's point of view
-  mSceneFromLightRenderTarget = FrameBuffer::New( stageSize.width, stageSize.height, FrameBuffer::Attachment::NONE );
-  Texture textureFromLight = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, unsigned(stageSize.width), unsigned(stageSize.height) );
-  mSceneFromLightRenderTarget.AttachColorTexture( textureFromLight );
+  RenderTargetPoolPtr renderTargetPool = RenderTargetPool::Get();
+  mSceneFromLightRenderTarget = renderTargetPool->Acquire( unsigned(stageSize.width), unsigned(stageSize.height), Pixel::RGBA8888 );
 
-  mOutputFrameBuffer = FrameBuffer::New( stageSize.width * 0.5f, stageSize.height * 0.5f, FrameBuffer::Attachment::NONE );
-  Texture outputTexture = Texture::New( TextureType::TEXTURE_2D, Pixel::RGBA8888, unsigned(stageSize.width * 0.5f), unsigned(stageSize.height * 0.5f) );
-  mOutputFrameBuffer.AttachColorTexture( outputTexture );
+  mOutputFrameBuffer = renderTargetPool->Acquire( unsigned(stageSize.width * 0.5f), unsigned(stageSize.height * 0.5f), Pixel::RGBA8888 );
 
   //////////////////////////////////////////////////////
   // Connect to actor tree
@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <cmath>
 #include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/render-tasks/render-task-list.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/public-api/object/property-map.h>
 #include <dali/public-api/object/type-registry.h>
@@ -36,6 +37,7 @@
 #include <dali-toolkit/internal/visuals/visual-base-impl.h>
 #include <dali-toolkit/internal/visuals/visual-factory-impl.h>
 #include <dali-toolkit/internal/controls/control/control-data-impl.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace //Unnamed namespace
 {
@@ -50,6 +52,7 @@ const float GAUSSIAN_BLUR_BELL_CURVE_WIDTH_INCREMENTATION = 5.f;
 const Pixel::Format GAUSSIAN_BLUR_RENDER_TARGET_PIXEL_FORMAT = Pixel::RGBA8888;
 const float GAUSSIAN_BLUR_DOWNSAMPLE_WIDTH_SCALE = 0.5f;
 const float GAUSSIAN_BLUR_DOWNSAMPLE_HEIGHT_SCALE = 0.5f;
+const float ARBITRARY_FIELD_OF_VIEW = Math::PI / 4.0f;
 
 const char* ALPHA_UNIFORM_NAME( "uAlpha" );
 const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
@@ -65,6 +68,25 @@ const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
   }\n
 );
 
+// Downsamples the previous level to half its size: the four diagonal samples each average 2x2 texels,
+// so every output pixel is a weighted average of 4x4 input texels, which doubles the blur radius per level.
+const char* TEXEL_OFFSET_UNIFORM_NAME( "uTexelOffset" );
+const char* PYRAMID_FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+  varying mediump vec2 vTexCoord;\n
+  uniform sampler2D sTexture;\n
+  uniform mediump vec2 uTexelOffset;\n
+  \n
+  void main()\n
+  {\n
+    mediump vec4 color = texture2D( sTexture, vTexCoord ) * 4.0;\n
+    color += texture2D( sTexture, vTexCoord - uTexelOffset );\n
+    color += texture2D( sTexture, vTexCoord + uTexelOffset );\n
+    color += texture2D( sTexture, vTexCoord + vec2( uTexelOffset.x, -uTexelOffset.y ) );\n
+    color += texture2D( sTexture, vTexCoord - vec2( uTexelOffset.x, -uTexelOffset.y ) );\n
+    gl_FragColor = color * 0.125;\n
+  }\n
+);
+
 /**
  * The constraint is used to blend the group of blurred images continuously with a unified blur strength property value which ranges from zero to one.
  */
@@ -122,6 +144,7 @@ BaseHandle Create()
 DALI_TYPE_REGISTRATION_BEGIN( Toolkit::SuperBlurView, Toolkit::Control, Create )
 
 DALI_PROPERTY_REGISTRATION( Toolkit, SuperBlurView, "imageUrl", STRING, IMAGE_URL )
+DALI_PROPERTY_REGISTRATION( Toolkit, SuperBlurView, "pyramid",  BOOLEAN, PYRAMID   )
 
 DALI_TYPE_REGISTRATION_END()
 
@@ -132,7 +155,8 @@ SuperBlurView::SuperBlurView( unsigned int blurLevels )
   mTargetSize( Vector2::ZERO ),
   mBlurStrengthPropertyIndex(Property::INVALID_INDEX),
   mBlurLevels( blurLevels ),
-  mResourcesCleared( true )
+  mResourcesCleared( true ),
+  mPyramid( false )
 {
   DALI_ASSERT_ALWAYS( mBlurLevels > 0 && " Minimal blur level is one, otherwise no blur is needed" );
   mGaussianBlurView.assign( blurLevels, Toolkit::GaussianBlurView() );
@@ -184,13 +208,24 @@ void SuperBlurView::SetTexture( Texture texture )
 
   Actor self( Self() );
 
-  BlurTexture( 0, mInputTexture );
+  if( mPyramid )
+  {
+    BlurPyramid();
+  }
+  else
+  {
+    BlurTexture( 0, mInputTexture );
+    for( unsigned int level = 1; level < mBlurLevels; level++ )
+    {
+      BlurTexture( level, mBlurredImage[level-1].GetColorTexture() );
+    }
+  }
+
   SetRendererTexture( mRenderers[0], texture );
 
   unsigned int i = 1;
   for(; i<mBlurLevels; i++)
   {
-    BlurTexture( i, mBlurredImage[i-1].GetColorTexture() );
     SetRendererTexture( mRenderers[i], mBlurredImage[i-1] );
   }
 
@@ -251,6 +286,59 @@ void SuperBlurView::BlurTexture( unsigned int idx, Texture texture )
   }
 }
 
+void SuperBlurView::BlurPyramid()
+{
+  // All the levels are rendered with the same camera, each into its own smaller framebuffer,
+  // so no intermediate framebuffers are needed.
+  mPyramidRoot = Actor::New();
+  mPyramidRoot.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+  Stage::GetCurrent().Add( mPyramidRoot );
+
+  CameraActor camera = CameraActor::New();
+  camera.SetInvertYAxis( true );
+  camera.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+  camera.SetFieldOfView( ARBITRARY_FIELD_OF_VIEW );
+  camera.SetNearClippingPlane( 1.0f );
+  camera.SetAspectRatio( mTargetSize.width / mTargetSize.height );
+  camera.SetType( Dali::Camera::FREE_LOOK ); // camera orientation based solely on actor
+  camera.SetProperty( Actor::Property::POSITION, Vector3( 0.0f, 0.0f, ( mTargetSize.height * 0.5f ) / tanf( ARBITRARY_FIELD_OF_VIEW * 0.5f ) ) );
+  mPyramidRoot.Add( camera );
+
+  RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
+  for( unsigned int level = 0; level < mBlurLevels; level++ )
+  {
+    Texture input = ( level == 0 ) ? mInputTexture : mBlurredImage[level-1].GetColorTexture();
+    FrameBuffer output = mBlurredImage[level];
+
+    Renderer renderer = CreateRenderer( BASIC_VERTEX_SOURCE, PYRAMID_FRAGMENT_SHADER );
+    SetRendererTexture( renderer, input );
+    // Half a texel of the output is a texel of the input, as the output is half the size.
+    renderer.RegisterProperty( TEXEL_OFFSET_UNIFORM_NAME, Vector2( 0.5f / static_cast<float>( output.GetColorTexture().GetWidth() ),
+                                                                   0.5f / static_cast<float>( output.GetColorTexture().GetHeight() ) ) );
+
+    Actor actor = Actor::New();
+    actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER );
+    actor.SetProperty( Actor::Property::SIZE, mTargetSize );
+    actor.AddRenderer( renderer );
+    mPyramidRoot.Add( actor );
+
+    RenderTask task = taskList.CreateTask();
+    task.SetSourceActor( actor );
+    task.SetExclusive( true );
+    task.SetInputEnabled( false );
+    task.SetClearEnabled( true );
+    task.SetClearColor( Color::BLACK );
+    task.SetCameraActor( camera );
+    task.SetFrameBuffer( output );
+    task.SetRefreshRate( RenderTask::REFRESH_ONCE );
+    if( level == mBlurLevels-1 )
+    {
+      task.FinishedSignal().Connect( this, &SuperBlurView::OnPyramidFinished );
+    }
+    mPyramidTasks.push_back( task );
+  }
+}
+
 void SuperBlurView::OnBlurViewFinished( Toolkit::GaussianBlurView blurView )
 {
   ClearBlurResource();
@@ -258,15 +346,37 @@ void SuperBlurView::OnBlurViewFinished( Toolkit::GaussianBlurView blurView )
   mBlurFinishedSignal.Emit( handle );
 }
 
+void SuperBlurView::OnPyramidFinished( RenderTask& renderTask )
+{
+  ClearBlurResource();
+  Toolkit::SuperBlurView handle( GetOwner() );
+  mBlurFinishedSignal.Emit( handle );
+}
+
 void SuperBlurView::ClearBlurResource()
 {
   if( !mResourcesCleared )
   {
-    DALI_ASSERT_ALWAYS( mGaussianBlurView.size() == mBlurLevels && "must synchronize the GaussianBlurView group if blur levels got changed " );
-    for(unsigned int i=0; i<mBlurLevels;i++)
+    if( mPyramidRoot )
     {
-      Stage::GetCurrent().Remove( mGaussianBlurView[i] );
-      mGaussianBlurView[i].Deactivate();
+      RenderTaskList taskList = Stage::GetCurrent().GetRenderTaskList();
+      for( auto&& task : mPyramidTasks )
+      {
+        taskList.RemoveTask( task );
+      }
+      mPyramidTasks.clear();
+
+      mPyramidRoot.Unparent();
+      mPyramidRoot.Reset();
+    }
+    else
+    {
+      DALI_ASSERT_ALWAYS( mGaussianBlurView.size() == mBlurLevels && "must synchronize the GaussianBlurView group if blur levels got changed " );
+      for(unsigned int i=0; i<mBlurLevels;i++)
+      {
+        Stage::GetCurrent().Remove( mGaussianBlurView[i] );
+        mGaussianBlurView[i].Deactivate();
+      }
     }
     mResourcesCleared = true;
   }
@@ -286,9 +396,7 @@ void SuperBlurView::OnSizeSet( const Vector3& targetSize )
       unsigned int width = mTargetSize.width/std::pow(2.f,exponent);
       unsigned int height = mTargetSize.height/std::pow(2.f,exponent);
 
-      mBlurredImage[i-1] = FrameBuffer::New( width, height, FrameBuffer::Attachment::NONE );
-      Texture texture = Texture::New( TextureType::TEXTURE_2D, GAUSSIAN_BLUR_RENDER_TARGET_PIXEL_FORMAT, unsigned(width), unsigned(height) );
-      mBlurredImage[i-1].AttachColorTexture( texture );
+      mBlurredImage[i-1] = RenderTargetPool::Get()->Acquire( width, height, GAUSSIAN_BLUR_RENDER_TARGET_PIXEL_FORMAT );
     }
 
     if( mInputTexture )
@@ -386,6 +494,19 @@ void SuperBlurView::SetProperty( BaseObject* object, Property::Index propertyInd
         DALI_LOG_ERROR( "Cannot create image from property value\n" );
       }
     }
+    else if( propertyIndex == Toolkit::SuperBlurView::Property::PYRAMID )
+    {
+      bool pyramid = false;
+      if( value.Get( pyramid ) && ( pyramid != superBlurViewImpl.mPyramid ) )
+      {
+        superBlurViewImpl.mPyramid = pyramid;
+
+        if( superBlurViewImpl.mInputTexture )
+        {
+          superBlurViewImpl.SetTexture( superBlurViewImpl.mInputTexture );
+        }
+      }
+    }
   }
 }
 
@@ -403,6 +524,10 @@ Property::Value SuperBlurView::GetProperty( BaseObject* object, Property::Index
     {
       value = superBlurViewImpl.mUrl;
     }
+    else if( propertyIndex == Toolkit::SuperBlurView::Property::PYRAMID )
+    {
+      value = superBlurViewImpl.mPyramid;
+    }
   }
 
   return value;
@@ -19,6 +19,8 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/public-api/actors/camera-actor.h>
+#include <dali/public-api/render-tasks/render-task.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
 
@@ -148,12 +150,23 @@ private:
    */
   void BlurTexture( unsigned int idx, Texture texture );
 
+  /**
+   * Create every blurred texture by downsampling and blurring the previous one, with one render task per level
+   */
+  void BlurPyramid();
+
   /**
    * Signal handler to tell when the last blur view completes
    * @param[in] blurView The blur view that just completed
    */
   void OnBlurViewFinished( Toolkit::GaussianBlurView blurView );
 
+  /**
+   * Signal handler to tell when the render task of the last pyramid level completes
+   * @param[in] renderTask The render task that just completed
+   */
+  void OnPyramidFinished( RenderTask& renderTask );
+
   /**
    * Clear the resources used to create the blurred image
    */
@@ -163,6 +176,8 @@ private:
   std::vector<Toolkit::GaussianBlurView> mGaussianBlurView;
   std::vector<FrameBuffer>               mBlurredImage;
   std::vector<Renderer>                  mRenderers;
+  std::vector<RenderTask>                mPyramidTasks;      ///< The render tasks of the pyramid levels
+  Actor                                  mPyramidRoot;       ///< Parents the camera and the actors rendering the pyramid levels
   Texture                                mInputTexture;
   Vector2                                mTargetSize;
 
@@ -172,6 +187,7 @@ private:
   Property::Index                        mBlurStrengthPropertyIndex;
   unsigned int                           mBlurLevels;
   bool                                   mResourcesCleared;
+  bool                                   mPyramid;           ///< Whether the levels are blurred as a pyramid
 };
 
 }
@@ -28,6 +28,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace Dali
 {
@@ -147,9 +148,9 @@ void BlurTwoPassFilter::Enable()
   mActorForInput.AddRenderer( rendererForInput );
 
   // create internal offscreen for result of horizontal pass
-  mFrameBufferForHorz = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-  Texture textureForHorz = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-  mFrameBufferForHorz.AttachColorTexture( textureForHorz );
+  RenderTargetPoolPtr renderTargetPool = RenderTargetPool::Get();
+  mFrameBufferForHorz = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
+  Texture textureForHorz = mFrameBufferForHorz.GetColorTexture();
 
   // create an actor to render mImageForHorz for vertical blur pass
   mActorForHorz = Actor::New();
@@ -160,9 +161,8 @@ void BlurTwoPassFilter::Enable()
   mActorForHorz.AddRenderer( rendererForHorz );
 
   // create internal offscreen for result of the two pass blurred image
-  mBlurredFrameBuffer = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-  Texture blurredTexture = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-  mBlurredFrameBuffer.AttachColorTexture( blurredTexture );
+  mBlurredFrameBuffer = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
+  Texture blurredTexture = mBlurredFrameBuffer.GetColorTexture();
 
   // create an actor to blend the blurred image and the input image with the given blur strength
   Renderer rendererForBlending = CreateRenderer( BASIC_VERTEX_SOURCE, BLEND_TWO_IMAGES_FRAGMENT_SOURCE );
@@ -28,6 +28,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace Dali
 {
@@ -87,13 +88,10 @@ EmbossFilter::~EmbossFilter()
 
 void EmbossFilter::Enable()
 {
-  mFrameBufferForEmboss1 = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-  Texture texture1 = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-  mFrameBufferForEmboss1.AttachColorTexture( texture1 );
+  RenderTargetPoolPtr renderTargetPool = RenderTargetPool::Get();
+  mFrameBufferForEmboss1 = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
-  mFrameBufferForEmboss2 = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-  Texture texture2 = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-  mFrameBufferForEmboss2.AttachColorTexture( texture2 );
+  mFrameBufferForEmboss2 = renderTargetPool->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
 
   // create actor to render input with applied emboss effect
   mActorForInput1 = Actor::New();
@@ -26,6 +26,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/controls/control/control-renderers.h>
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
 
 namespace Dali
 {
@@ -95,9 +96,8 @@ void SpreadFilter::Enable()
   mActorForInput.AddRenderer( rendererForInput );
 
   // create internal offscreen for result of horizontal pass
-  mFrameBufferForHorz = FrameBuffer::New( mTargetSize.width, mTargetSize.height, FrameBuffer::Attachment::NONE );
-  Texture textureForHorz = Texture::New( TextureType::TEXTURE_2D, mPixelFormat, unsigned(mTargetSize.width), unsigned(mTargetSize.height) );
-  mFrameBufferForHorz.AttachColorTexture( textureForHorz );
+  mFrameBufferForHorz = RenderTargetPool::Get()->Acquire( unsigned(mTargetSize.width), unsigned(mTargetSize.height), mPixelFormat );
+  Texture textureForHorz = mFrameBufferForHorz.GetColorTexture();
 
   // create an actor to render mImageForHorz for vertical blur pass
   mActorForHorz = Actor::New();
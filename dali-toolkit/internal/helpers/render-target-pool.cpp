@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/helpers/render-target-pool.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/singleton-service.h>
+#include <dali/public-api/rendering/texture.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const uint64_t DEFAULT_MEMORY_BUDGET = 64u * 1024u * 1024u;
+const uint32_t DEFAULT_IDLE_TIMEOUT = 5000u;           ///< In milliseconds.
+const uint32_t IDLE_CHECK_INTERVAL = 1000u;            ///< In milliseconds.
+const uint32_t DEPTH_STENCIL_BYTES_PER_PIXEL = 4u;     ///< Estimated, the render buffers are allocated by the driver.
+const int POOLED_TEXTURE_REFERENCE_COUNT = 2;          ///< The references to an idle color texture, i.e. the pool's handle and its render target's.
+
+} // namespace
+
+RenderTargetPoolPtr RenderTargetPool::Get()
+{
+  RenderTargetPoolPtr pool;
+
+  SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( RenderTargetPool ) );
+    if( handle )
+    {
+      pool = dynamic_cast< RenderTargetPool* >( handle.GetObjectPtr() );
+    }
+    else // create and register the object
+    {
+      pool = new RenderTargetPool();
+      service.Register( typeid( RenderTargetPool ), Dali::BaseHandle( pool.Get() ) );
+    }
+  }
+  else
+  {
+    pool = new RenderTargetPool();
+  }
+
+  return pool;
+}
+
+RenderTargetPool::RenderTargetPool()
+: mEntries(),
+  mTimer(),
+  mStatistics(),
+  mMemoryBudget( DEFAULT_MEMORY_BUDGET ),
+  mIdleTimeout( DEFAULT_IDLE_TIMEOUT )
+{
+}
+
+RenderTargetPool::~RenderTargetPool()
+{
+  if( mTimer )
+  {
+    mTimer.Stop();
+  }
+}
+
+FrameBuffer RenderTargetPool::Acquire( uint32_t width, uint32_t height, Pixel::Format pixelFormat, FrameBuffer::Attachment::Mask attachments )
+{
+  for( EntryList::iterator it = mEntries.begin(), endIt = mEntries.end(); it != endIt; ++it )
+  {
+    if( ( it->width == width ) &&
+        ( it->height == height ) &&
+        ( it->pixelFormat == pixelFormat ) &&
+        ( it->attachments == attachments ) &&
+        !IsLeased( *it ) )
+    {
+      ++mStatistics.reuseCount;
+      it->isIdle = false;
+
+      // Move the render target to the front as it's the most recently leased.
+      mEntries.splice( mEntries.begin(), mEntries, it );
+      return mEntries.front().frameBuffer;
+    }
+  }
+
+  FrameBuffer frameBuffer = FrameBuffer::New( width, height, attachments );
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, pixelFormat, width, height );
+  frameBuffer.AttachColorTexture( texture );
+  ++mStatistics.allocationCount;
+
+  uint64_t size = static_cast< uint64_t >( width ) * height * Pixel::GetBytesPerPixel( pixelFormat );
+  if( attachments != FrameBuffer::Attachment::NONE )
+  {
+    size += static_cast< uint64_t >( width ) * height * DEPTH_STENCIL_BYTES_PER_PIXEL;
+  }
+
+  // Make room for the new render target, or leave it out of the pool if the leased ones already take the budget.
+  Trim( size );
+  if( mStatistics.pooledMemory + size <= mMemoryBudget )
+  {
+    Entry entry;
+    entry.frameBuffer = frameBuffer;
+    entry.colorTexture = texture;
+    entry.width = width;
+    entry.height = height;
+    entry.pixelFormat = pixelFormat;
+    entry.attachments = attachments;
+    entry.size = size;
+    entry.isIdle = false;
+    mEntries.push_front( entry );
+    mStatistics.pooledMemory += size;
+
+    if( !mTimer )
+    {
+      mTimer = Timer::New( IDLE_CHECK_INTERVAL );
+      mTimer.TickSignal().Connect( this, &RenderTargetPool::OnTimeout );
+    }
+    if( !mTimer.IsRunning() )
+    {
+      mTimer.Start();
+    }
+  }
+
+  return frameBuffer;
+}
+
+void RenderTargetPool::SetMemoryBudget( uint64_t bytes )
+{
+  mMemoryBudget = bytes;
+  Trim( 0u );
+}
+
+void RenderTargetPool::SetIdleTimeout( uint32_t milliseconds )
+{
+  mIdleTimeout = milliseconds;
+  Trim( 0u );
+}
+
+Toolkit::RenderTargetPool::Statistics RenderTargetPool::GetStatistics()
+{
+  Toolkit::RenderTargetPool::Statistics statistics = mStatistics;
+  statistics.pooledCount = 0u;
+  statistics.leasedCount = 0u;
+  for( auto&& entry : mEntries )
+  {
+    ++statistics.pooledCount;
+    if( IsLeased( entry ) )
+    {
+      ++statistics.leasedCount;
+    }
+  }
+
+  return statistics;
+}
+
+bool RenderTargetPool::IsLeased( Entry& entry )
+{
+  // The color texture may still be rendered from, e.g. through a TextureSet, after the render target is released.
+  return ( entry.frameBuffer.GetBaseObject().ReferenceCount() > 1 ) ||
+         ( entry.colorTexture.GetBaseObject().ReferenceCount() > POOLED_TEXTURE_REFERENCE_COUNT );
+}
+
+void RenderTargetPool::Trim( uint64_t requiredSize )
+{
+  const Clock::time_point now = Clock::now();
+  const Clock::duration idleTimeout = std::chrono::milliseconds( mIdleTimeout );
+
+  for( EntryList::iterator it = mEntries.begin(); it != mEntries.end(); )
+  {
+    if( IsLeased( *it ) )
+    {
+      it->isIdle = false;
+    }
+    else if( !it->isIdle )
+    {
+      it->isIdle = true;
+      it->idleSince = now;
+    }
+
+    if( it->isIdle && ( now - it->idleSince >= idleTimeout ) )
+    {
+      mStatistics.pooledMemory -= it->size;
+      ++mStatistics.evictionCount;
+      it = mEntries.erase( it );
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  // Destroy the least recently leased of the idle render targets until within the budget.
+  EntryList::iterator it = mEntries.end();
+  while( ( it != mEntries.begin() ) && ( mStatistics.pooledMemory + requiredSize > mMemoryBudget ) )
+  {
+    --it;
+    if( it->isIdle )
+    {
+      mStatistics.pooledMemory -= it->size;
+      ++mStatistics.evictionCount;
+      it = mEntries.erase( it );
+    }
+  }
+}
+
+bool RenderTargetPool::OnTimeout()
+{
+  Trim( 0u );
+
+  // Stop the timer until a render target is pooled again.
+  return !mEntries.empty();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
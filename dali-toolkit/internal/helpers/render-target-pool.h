@@ -0,0 +1,161 @@
+#ifndef DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
+#define DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <list>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/object/base-object.h>
+#include <dali/public-api/rendering/frame-buffer.h>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/signals/connection-tracker.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/utility/render-target-pool.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class RenderTargetPool;
+typedef IntrusivePtr< RenderTargetPool > RenderTargetPoolPtr;
+
+/**
+ * @brief The render targets shared by the effect controls.
+ *
+ * A render target is leased for as long as a handle to it or to its color texture exists besides the ones held by the
+ * pool, i.e. a control releases a render target by resetting its handles and the texture sets rendering from its color
+ * texture, as it would without the pool.
+ *
+ * There is one pool per process.
+ */
+class RenderTargetPool : public BaseObject, public ConnectionTracker
+{
+public:
+
+  /**
+   * @brief Retrieves the pool.
+   *
+   * @return The pool, which is not shared if there is no singleton service.
+   */
+  static RenderTargetPoolPtr Get();
+
+  /**
+   * @brief Constructor.
+   */
+  RenderTargetPool();
+
+  /**
+   * @brief Leases a render target with a color texture, reusing an idle one of the same size and format if any.
+   *
+   * @param[in] width The width of the render target.
+   * @param[in] height The height of the render target.
+   * @param[in] pixelFormat The pixel format of the color texture.
+   * @param[in] attachments The depth and stencil attachments.
+   * @return The render target.
+   */
+  FrameBuffer Acquire( uint32_t width, uint32_t height, Pixel::Format pixelFormat, FrameBuffer::Attachment::Mask attachments = FrameBuffer::Attachment::NONE );
+
+  /**
+   * @copydoc Dali::Toolkit::RenderTargetPool::SetMemoryBudget
+   */
+  void SetMemoryBudget( uint64_t bytes );
+
+  /**
+   * @copydoc Dali::Toolkit::RenderTargetPool::SetIdleTimeout
+   */
+  void SetIdleTimeout( uint32_t milliseconds );
+
+  /**
+   * @copydoc Dali::Toolkit::RenderTargetPool::GetStatistics
+   */
+  Toolkit::RenderTargetPool::Statistics GetStatistics();
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~RenderTargetPool();
+
+private:
+
+  // Undefined copy constructor.
+  RenderTargetPool( const RenderTargetPool& );
+
+  // Undefined assignment constructor.
+  RenderTargetPool& operator=( const RenderTargetPool& );
+
+  typedef std::chrono::steady_clock Clock;
+
+  struct Entry
+  {
+    FrameBuffer frameBuffer;                   ///< The pooled render target.
+    Texture colorTexture;                      ///< Its color texture.
+    uint32_t width;                            ///< The width of the render target.
+    uint32_t height;                           ///< The height of the render target.
+    Pixel::Format pixelFormat;                 ///< The pixel format of its color texture.
+    FrameBuffer::Attachment::Mask attachments; ///< Its depth and stencil attachments.
+    uint64_t size;                             ///< Its estimated size in bytes.
+    Clock::time_point idleSince;               ///< When it was found idle.
+    bool isIdle;                               ///< Whether it was idle when last checked.
+  };
+
+  typedef std::list< Entry > EntryList;
+
+  /**
+   * @brief Whether a render target is leased, i.e. whether the pool doesn't hold the only handles to it and its color texture.
+   */
+  static bool IsLeased( Entry& entry );
+
+  /**
+   * @brief Updates which render targets are idle and destroys the ones idle for too long or over the budget.
+   *
+   * @param[in] requiredSize The size in bytes to make room for within the budget.
+   */
+  void Trim( uint64_t requiredSize );
+
+  /**
+   * @brief Called by the timer to destroy the render targets idle for too long.
+   *
+   * @return @e true while there are pooled render targets to check.
+   */
+  bool OnTimeout();
+
+  EntryList mEntries;                                ///< The pooled render targets, the most recently leased first.
+  Timer mTimer;                                      ///< Checks the idle render targets while there are any.
+  Toolkit::RenderTargetPool::Statistics mStatistics; ///< The work done by the pool.
+  uint64_t mMemoryBudget;                            ///< The maximum size in bytes of the pooled render targets.
+  uint32_t mIdleTimeout;                             ///< How long in milliseconds an idle render target is kept.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_RENDER_TARGET_POOL_H
@@ -77,6 +77,18 @@ public:
     return mElements.begin() + mNextIndex++;
   }
 
+  /**
+   * @brief Returns the iterator to the first element of the container.
+   *
+   * Together with End() it visits all the elements, without changing the next element returned by GetNext().
+   *
+   * @return The container begin() element
+   */
+  typename ContainerType::iterator Begin()
+  {
+    return mElements.begin();
+  }
+
   /**
    * @brief Returns the iterator to the end of the container.
    *
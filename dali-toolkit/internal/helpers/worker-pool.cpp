@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/helpers/worker-pool.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/devel-api/common/singleton-service.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const char* const NUMBER_OF_THREADS_ENV = "DALI_TOOLKIT_WORKER_THREADS";
+const uint32_t MINIMUM_NUMBER_OF_THREADS = 2u;
+const uint32_t MAXIMUM_NUMBER_OF_THREADS = 100u;
+const uint32_t MAXIMUM_DEFAULT_NUMBER_OF_THREADS = 8u;
+
+/**
+ * The number of threads set in the environment, or one thread per core except the one left for
+ * the event and render threads.
+ */
+uint32_t GetNumberOfThreadsFromEnvironment()
+{
+  const char* numberString = EnvironmentVariable::GetEnvironmentVariable( NUMBER_OF_THREADS_ENV );
+  const unsigned long numberOfThreads = numberString ? std::strtoul( numberString, NULL, 10 ) : 0u;
+  if( ( numberOfThreads > 0u ) && ( numberOfThreads < MAXIMUM_NUMBER_OF_THREADS ) )
+  {
+    return static_cast< uint32_t >( numberOfThreads );
+  }
+
+  const uint32_t numberOfCores = std::thread::hardware_concurrency();
+  return std::min( std::max( numberOfCores, MINIMUM_NUMBER_OF_THREADS + 1u ) - 1u, MAXIMUM_DEFAULT_NUMBER_OF_THREADS );
+}
+
+} // namespace
+
+/**
+ * A thread of the pool.
+ */
+class WorkerPool::Worker : public Thread
+{
+public:
+
+  /**
+   * Constructor.
+   *
+   * @param[in] pool The pool the thread belongs to.
+   */
+  explicit Worker( WorkerPool& pool )
+  : mPool( pool ),
+    mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
+  {
+  }
+
+protected:
+
+  /**
+   * The entry function of the worker thread.
+   */
+  void Run() override
+  {
+    SetThreadName( "ToolkitWorker" );
+    mLogFactory.InstallLogFunction();
+
+    mPool.Run();
+  }
+
+private:
+
+  WorkerPool& mPool;
+  const Dali::LogFactoryInterface& mLogFactory; ///< The log factory
+};
+
+WorkerPoolPtr WorkerPool::Get()
+{
+  WorkerPoolPtr pool;
+
+  SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( WorkerPool ) );
+    if( handle )
+    {
+      pool = dynamic_cast< WorkerPool* >( handle.GetObjectPtr() );
+    }
+    else // create and register the object
+    {
+      pool = new WorkerPool( GetNumberOfThreadsFromEnvironment() );
+      service.Register( typeid( WorkerPool ), Dali::BaseHandle( pool.Get() ) );
+    }
+  }
+  else
+  {
+    pool = new WorkerPool( GetNumberOfThreadsFromEnvironment() );
+  }
+
+  return pool;
+}
+
+WorkerPool::WorkerPool( uint32_t numberOfThreads )
+: mQueues(),
+  mStatistics(),
+  mWorkers(),
+  mConditionalWait(),
+  mNumberOfThreads( numberOfThreads ),
+  mTerminate( false )
+{
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    ConditionalWait::ScopedLock lock( mConditionalWait );
+    mTerminate = true;
+    mConditionalWait.Notify( lock );
+  }
+
+  for( auto&& worker : mWorkers )
+  {
+    worker->Join();
+  }
+}
+
+void WorkerPool::Register( Queue& queue, Toolkit::WorkerPool::Subsystem subsystem )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  Entry entry;
+  entry.queue = &queue;
+  entry.subsystem = subsystem;
+  entry.isProcessing = false;
+  entry.isUnregistering = false;
+  mQueues.push_back( entry );
+}
+
+void WorkerPool::Unregister( Queue& queue )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  for( EntryList::iterator it = mQueues.begin(), endIt = mQueues.end(); it != endIt; ++it )
+  {
+    if( it->queue == &queue )
+    {
+      // Wait for the task being processed, as it still uses the queue.
+      it->isUnregistering = true;
+      while( it->isProcessing )
+      {
+        mConditionalWait.Wait( lock );
+      }
+
+      mQueues.erase( it );
+      break;
+    }
+  }
+}
+
+void WorkerPool::Notify()
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  if( mWorkers.empty() )
+  {
+    for( uint32_t i = 0u; i < mNumberOfThreads; ++i )
+    {
+      mWorkers.push_back( std::unique_ptr< Worker >( new Worker( *this ) ) );
+      mWorkers.back()->Start();
+    }
+  }
+
+  mConditionalWait.Notify( lock );
+}
+
+Toolkit::WorkerPool::Statistics WorkerPool::GetStatistics( Toolkit::WorkerPool::Subsystem subsystem )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  Toolkit::WorkerPool::Statistics statistics = mStatistics[subsystem];
+  statistics.queueDepth = 0u;
+  for( auto&& entry : mQueues )
+  {
+    if( entry.subsystem == subsystem )
+    {
+      Priority priority = Priority::LOW;
+      statistics.queueDepth += entry.queue->GetNumberOfTasks( priority );
+    }
+  }
+
+  return statistics;
+}
+
+void WorkerPool::Run()
+{
+  EntryList::iterator entry;
+  while( NextTaskToProcess( entry ) )
+  {
+    uint64_t latency = 0u;
+    const bool processed = entry->queue->ProcessNextTask( latency );
+
+    TaskProcessed( entry, processed, latency );
+  }
+}
+
+bool WorkerPool::NextTaskToProcess( EntryList::iterator& entry )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  while( !mTerminate )
+  {
+    entry = NextQueueToProcess();
+    if( entry != mQueues.end() )
+    {
+      entry->isProcessing = true;
+      return true;
+    }
+
+    mConditionalWait.Wait( lock );
+  }
+
+  return false;
+}
+
+void WorkerPool::TaskProcessed( EntryList::iterator entry, bool processed, uint64_t latency )
+{
+  ConditionalWait::ScopedLock lock( mConditionalWait );
+
+  entry->isProcessing = false;
+
+  if( processed )
+  {
+    Toolkit::WorkerPool::Statistics& statistics = mStatistics[entry->subsystem];
+    ++statistics.processedCount;
+    statistics.totalLatency += latency;
+    statistics.maxLatency = std::max( statistics.maxLatency, latency );
+  }
+
+  if( entry->isUnregistering )
+  {
+    mConditionalWait.Notify( lock );
+  }
+}
+
+WorkerPool::EntryList::iterator WorkerPool::NextQueueToProcess()
+{
+  EntryList::iterator next = mQueues.end();
+
+  for( EntryList::iterator it = mQueues.begin(), endIt = mQueues.end(); it != endIt; ++it )
+  {
+    if( it->isProcessing || it->isUnregistering )
+    {
+      continue;
+    }
+
+    Priority priority = Priority::LOW;
+    if( it->queue->GetNumberOfTasks( priority ) > 0u )
+    {
+      if( Priority::HIGH == priority )
+      {
+        next = it;
+        break;
+      }
+
+      if( next == mQueues.end() )
+      {
+        next = it;
+      }
+    }
+  }
+
+  if( next != mQueues.end() )
+  {
+    // Move the queue to the back, so the other queues are processed before it again.
+    mQueues.splice( mQueues.end(), mQueues, next );
+  }
+
+  return next;
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
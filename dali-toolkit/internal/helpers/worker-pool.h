@@ -0,0 +1,232 @@
+#ifndef DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
+#define DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/public-api/object/base-object.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/devel-api/utility/worker-pool.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class WorkerPool;
+typedef IntrusivePtr< WorkerPool > WorkerPoolPtr;
+
+/**
+ * @brief The worker threads shared by the background work of the toolkit.
+ *
+ * Each subsystem keeps its tasks in its own queues, so it can still cancel or reorder them, and
+ * registers the queues with the pool. An idle worker takes the next task from whichever queue has
+ * one, queues with a task of high priority first, and rotates between the queues otherwise.
+ * A queue is processed by at most one worker at a time, so its tasks are processed in order,
+ * as they were by the dedicated thread each queue used to have.
+ *
+ * There is one pool per process, started when the first task is added.
+ */
+class WorkerPool : public BaseObject
+{
+public:
+
+  /**
+   * @brief The priority of the next task of a queue.
+   */
+  enum class Priority
+  {
+    LOW = 0,
+    HIGH
+  };
+
+  /**
+   * @brief A queue of tasks processed by the pool.
+   *
+   * The pool calls the queue with its own lock held, so the queue must not call the pool
+   * while holding the lock of its tasks.
+   *
+   * A queue has no thread of its own that sleeps while it is empty. ProcessNextTask() is only called
+   * while the queue has tasks, so the calls don't tell the queue when no task is being processed.
+   */
+  class Queue
+  {
+  public:
+
+    /**
+     * @brief Retrieves the number of tasks waiting in the queue. Called by the workers.
+     *
+     * @param[out] priority The priority of the next task, if any.
+     * @return The number of tasks.
+     */
+    virtual uint32_t GetNumberOfTasks( Priority& priority ) = 0;
+
+    /**
+     * @brief Processes the next task of the queue. Called by one worker at a time.
+     *
+     * @param[out] latency The time in microseconds the task waited in the queue.
+     * @return @e false if there was no task to process, i.e. it has been cancelled meanwhile.
+     */
+    virtual bool ProcessNextTask( uint64_t& latency ) = 0;
+
+  protected:
+
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~Queue()
+    {
+    }
+  };
+
+  /**
+   * @brief Retrieves the pool.
+   *
+   * @return The pool, which is not shared if there is no singleton service.
+   */
+  static WorkerPoolPtr Get();
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] numberOfThreads The number of worker threads.
+   */
+  explicit WorkerPool( uint32_t numberOfThreads );
+
+  /**
+   * @brief Adds a queue to be processed by the workers.
+   *
+   * @param[in] queue The queue.
+   * @param[in] subsystem The subsystem the tasks of the queue are accounted to.
+   */
+  void Register( Queue& queue, Toolkit::WorkerPool::Subsystem subsystem );
+
+  /**
+   * @brief Removes a queue, waiting for the task being processed from it if any.
+   *
+   * @param[in] queue The queue.
+   */
+  void Unregister( Queue& queue );
+
+  /**
+   * @brief Wakes up a worker to process a task added to a queue.
+   *
+   * Must be called once the task can be retrieved from the queue, without holding its lock.
+   */
+  void Notify();
+
+  /**
+   * @brief Retrieves the number of worker threads.
+   *
+   * @return The number of threads.
+   */
+  uint32_t GetNumberOfThreads() const
+  {
+    return mNumberOfThreads;
+  }
+
+  /**
+   * @brief Retrieves the work done for a subsystem.
+   *
+   * @param[in] subsystem The subsystem.
+   * @return The statistics of the subsystem.
+   */
+  Toolkit::WorkerPool::Statistics GetStatistics( Toolkit::WorkerPool::Subsystem subsystem );
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~WorkerPool();
+
+private:
+
+  // Undefined copy constructor.
+  WorkerPool( const WorkerPool& );
+
+  // Undefined assignment constructor.
+  WorkerPool& operator=( const WorkerPool& );
+
+  class Worker;
+  friend class Worker;
+
+  struct Entry
+  {
+    Queue* queue;                             ///< The registered queue.
+    Toolkit::WorkerPool::Subsystem subsystem; ///< The subsystem of the queue.
+    bool isProcessing:1;                      ///< Whether a worker is processing a task of the queue.
+    bool isUnregistering:1;                   ///< Whether the queue is waiting to be removed.
+  };
+
+  typedef std::list< Entry > EntryList;
+
+  /**
+   * @brief The loop of the worker threads.
+   */
+  void Run();
+
+  /**
+   * @brief Waits for a task to process and marks its queue as being processed.
+   *
+   * @param[out] entry The entry of the queue to take the task from.
+   * @return @e false if the workers have to stop.
+   */
+  bool NextTaskToProcess( EntryList::iterator& entry );
+
+  /**
+   * @brief Releases the queue of a processed task and records the latency of the task.
+   *
+   * @param[in] entry The entry of the queue.
+   * @param[in] processed Whether a task was processed.
+   * @param[in] latency The time in microseconds the task waited in the queue.
+   */
+  void TaskProcessed( EntryList::iterator entry, bool processed, uint64_t latency );
+
+  /**
+   * @brief Finds the queue to take the next task from. Called with the lock held.
+   *
+   * @return The entry of the queue or the end of the list if there are no tasks.
+   */
+  EntryList::iterator NextQueueToProcess();
+
+  EntryList mQueues;                                                                  ///< The registered queues, the next one to process first.
+  std::map< Toolkit::WorkerPool::Subsystem, Toolkit::WorkerPool::Statistics > mStatistics; ///< The work done for each subsystem.
+  std::vector< std::unique_ptr< Worker > > mWorkers;                                  ///< The worker threads, once started.
+  ConditionalWait mConditionalWait;                                                   ///< Guards all of the above.
+  uint32_t mNumberOfThreads;                                                          ///< The number of worker threads.
+  bool mTerminate;                                                                    ///< Whether the workers have to stop.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_WORKER_POOL_H
@@ -33,8 +33,7 @@ namespace Internal
 AsyncImageLoader::AsyncImageLoader()
 : mLoadedSignal(),
   mLoadThread( new EventThreadCallback( MakeCallback( this, &AsyncImageLoader::ProcessLoadedImage ) ) ),
-  mLoadTaskId( 0u ),
-  mIsLoadThreadStarted( false )
+  mLoadTaskId( 0u )
 {
 }
 
@@ -52,11 +51,6 @@ IntrusivePtr<AsyncImageLoader> AsyncImageLoader::New()
 uint32_t AsyncImageLoader::LoadAnimatedImage( Dali::AnimatedImageLoading animatedImageLoading,
                                               uint32_t frameIndex )
 {
-  if( !mIsLoadThreadStarted )
-  {
-    mLoadThread.Start();
-    mIsLoadThreadStarted = true;
-  }
   mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, animatedImageLoading, frameIndex ) );
 
   return mLoadTaskId;
@@ -69,11 +63,6 @@ uint32_t AsyncImageLoader::Load( const VisualUrl& url,
                                  bool orientationCorrection,
                                  DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
 {
-  if( !mIsLoadThreadStarted )
-  {
-    mLoadThread.Start();
-    mIsLoadThreadStarted = true;
-  }
   mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, url, dimensions, fittingMode, samplingMode, orientationCorrection, preMultiplyOnLoad ) );
 
   return mLoadTaskId;
@@ -85,11 +74,6 @@ uint32_t AsyncImageLoader::ApplyMask( Devel::PixelBuffer pixelBuffer,
                                       bool cropToMask,
                                       DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad)
 {
-  if( !mIsLoadThreadStarted )
-  {
-    mLoadThread.Start();
-    mIsLoadThreadStarted = true;
-  }
   mLoadThread.AddTask( new LoadingTask( ++mLoadTaskId, pixelBuffer, maskPixelBuffer, contentScale, cropToMask, preMultiplyOnLoad ) );
 
   return mLoadTaskId;
@@ -115,6 +99,11 @@ void AsyncImageLoader::CancelAll()
   mLoadThread.CancelAll();
 }
 
+bool AsyncImageLoader::SetLoadPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  return mLoadThread.SetTaskPriority( loadingTaskId, priority );
+}
+
 void AsyncImageLoader::ProcessLoadedImage()
 {
   while( LoadingTask *next = mLoadThread.NextCompletedTask() )
@@ -100,6 +100,11 @@ public:
    */
   void CancelAll();
 
+  /**
+   * @copydoc Toolkit::DevelAsyncImageLoader::SetLoadPriority
+   */
+  bool SetLoadPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority );
+
   /**
    * Process the completed loading task from the worker thread.
    */
@@ -118,7 +123,6 @@ private:
 
   ImageLoadThread mLoadThread;
   uint32_t        mLoadTaskId;
-  bool            mIsLoadThreadStarted;
 };
 
 } // namespace Internal
@@ -20,8 +20,6 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/image-loading.h>
-#include <dali/devel-api/adaptor-framework/thread-settings.h>
-#include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -47,7 +45,9 @@ LoadingTask::LoadingTask( uint32_t id, Dali::AnimatedImageLoading animatedImageL
   contentScale( 1.0f ),
   cropToMask( false ),
   animatedImageLoading( animatedImageLoading ),
-  frameIndex( frameIndex )
+  frameIndex( frameIndex ),
+  priority( DevelAsyncImageLoader::LoadPriority::HIGH ),
+  queuedTime()
 {
 }
 
@@ -66,7 +66,9 @@ LoadingTask::LoadingTask( uint32_t id, const VisualUrl& url, ImageDimensions dim
   contentScale( 1.0f ),
   cropToMask( false ),
   animatedImageLoading(),
-  frameIndex( 0u )
+  frameIndex( 0u ),
+  priority( DevelAsyncImageLoader::LoadPriority::HIGH ),
+  queuedTime()
 {
 }
 
@@ -85,7 +87,9 @@ LoadingTask::LoadingTask( uint32_t id, Devel::PixelBuffer pixelBuffer, Devel::Pi
   contentScale( contentScale ),
   cropToMask( cropToMask ),
   animatedImageLoading(),
-  frameIndex( 0u )
+  frameIndex( 0u ),
+  priority( DevelAsyncImageLoader::LoadPriority::HIGH ),
+  queuedTime()
 {
 }
 
@@ -128,16 +132,15 @@ void LoadingTask::MultiplyAlpha()
 
 ImageLoadThread::ImageLoadThread( EventThreadCallback* trigger )
 : mTrigger( trigger ),
-  mLogFactory( Dali::Adaptor::Get().GetLogFactory() )
+  mWorkerPool( WorkerPool::Get() )
 {
+  mWorkerPool->Register( *this, Toolkit::WorkerPool::Subsystem::IMAGE_LOADING );
 }
 
 ImageLoadThread::~ImageLoadThread()
 {
-  // add an empty task would stop the thread from conditional wait.
-  AddTask( NULL );
-  // stop the thread
-  Join();
+  // wait for the task being processed, if any.
+  mWorkerPool->Unregister( *this );
 
   delete mTrigger;
 
@@ -154,42 +157,60 @@ ImageLoadThread::~ImageLoadThread()
   mCompleteQueue.Clear();
 }
 
-void ImageLoadThread::Run()
+uint32_t ImageLoadThread::GetNumberOfTasks( WorkerPool::Priority& priority )
 {
-  SetThreadName( "ImageLoadThread" );
-  mLogFactory.InstallLogFunction();
+  Mutex::ScopedLock lock( mLoadMutex );
 
-  while( LoadingTask* task = NextTaskToProcess() )
+  priority = WorkerPool::Priority::LOW;
+  for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
   {
-    if( !task->isMaskTask )
-    {
-      task->Load();
-    }
-    else
+    if( (*iter)->priority == DevelAsyncImageLoader::LoadPriority::HIGH )
     {
-      task->ApplyMask();
+      priority = WorkerPool::Priority::HIGH;
+      break;
     }
-    task->MultiplyAlpha();
+  }
+
+  return mLoadQueue.Count();
+}
+
+bool ImageLoadThread::ProcessNextTask( uint64_t& latency )
+{
+  LoadingTask* task = NextTaskToProcess();
+  if( !task )
+  {
+    return false;
+  }
 
-    AddCompletedTask( task );
+  latency = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - task->queuedTime ).count();
+
+  if( !task->isMaskTask )
+  {
+    task->Load();
+  }
+  else
+  {
+    task->ApplyMask();
   }
+  task->MultiplyAlpha();
+
+  AddCompletedTask( task );
+
+  return true;
 }
 
 void ImageLoadThread::AddTask( LoadingTask* task )
 {
-  bool wasEmpty = false;
+  task->queuedTime = std::chrono::steady_clock::now();
+
   {
     // Lock while adding task to the queue
-    ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mLoadQueue.Empty();
+    Mutex::ScopedLock lock( mLoadMutex );
     mLoadQueue.PushBack( task );
   }
 
-  if( wasEmpty )
-  {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
-  }
+  // wake up a worker thread
+  mWorkerPool->Notify();
 }
 
 LoadingTask* ImageLoadThread::NextCompletedTask()
@@ -212,7 +233,7 @@ LoadingTask* ImageLoadThread::NextCompletedTask()
 bool ImageLoadThread::CancelTask( uint32_t loadingTaskId )
 {
   // Lock while remove task from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
+  Mutex::ScopedLock lock( mLoadMutex );
 
   for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
   {
@@ -231,7 +252,7 @@ bool ImageLoadThread::CancelTask( uint32_t loadingTaskId )
 void ImageLoadThread::CancelAll()
 {
   // Lock while remove task from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
+  Mutex::ScopedLock lock( mLoadMutex );
 
   for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
   {
@@ -240,17 +261,43 @@ void ImageLoadThread::CancelAll()
   mLoadQueue.Clear();
 }
 
+bool ImageLoadThread::SetTaskPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  // Lock while changing the task in the queue
+  Mutex::ScopedLock lock( mLoadMutex );
+
+  for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
+  {
+    if( (*iter)->id == loadingTaskId )
+    {
+      (*iter)->priority = priority;
+      return true;
+    }
+  }
+
+  return false;
+}
+
 LoadingTask* ImageLoadThread::NextTaskToProcess()
 {
   // Lock while popping task out from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
+  Mutex::ScopedLock lock( mLoadMutex );
 
-  while( mLoadQueue.Empty() )
+  if( mLoadQueue.Empty() )
   {
-    mConditionalWait.Wait( lock );
+    return NULL;
   }
 
   Vector< LoadingTask* >::Iterator next = mLoadQueue.Begin();
+  for( Vector< LoadingTask* >::Iterator iter = mLoadQueue.Begin(); iter != mLoadQueue.End(); ++iter )
+  {
+    if( (*iter)->priority == DevelAsyncImageLoader::LoadPriority::HIGH )
+    {
+      next = iter;
+      break;
+    }
+  }
+
   LoadingTask* nextTask = *next;
   mLoadQueue.Erase( next );
 
@@ -18,17 +18,16 @@
  */
 
 // EXTERNAL INCLUDES
+#include <chrono>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/images/image-operations.h>
-#include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/mutex.h>
-#include <dali/devel-api/threading/thread.h>
 #include <dali/devel-api/adaptor-framework/event-thread-callback.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali-toolkit/internal/helpers/worker-pool.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
-#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
 
 namespace Dali
 {
@@ -129,13 +128,15 @@ public:
   bool cropToMask;                  ///< Whether to crop the content to the mask size
   Dali::AnimatedImageLoading animatedImageLoading;
   uint32_t frameIndex;
+  DevelAsyncImageLoader::LoadPriority priority; ///< Tasks of high priority are processed before the others
+  std::chrono::steady_clock::time_point queuedTime; ///< When the task was added to the loading queue
 };
 
 
 /**
- * The worker thread for image loading.
+ * The queue of image loading tasks, processed by the worker threads of the toolkit.
  */
-class ImageLoadThread : public Thread
+class ImageLoadThread : public WorkerPool::Queue
 {
 public:
 
@@ -177,12 +178,33 @@ public:
    */
   void CancelAll();
 
+  /**
+   * Change the priority of a loading task in the waiting queue.
+   *
+   * @param[in] loadingTaskId The id of the task.
+   * @param[in] priority The new priority.
+   * @return true if the task is still waiting.
+   */
+  bool SetTaskPriority( uint32_t loadingTaskId, DevelAsyncImageLoader::LoadPriority priority );
+
+  /**
+   * @copydoc WorkerPool::Queue::GetNumberOfTasks()
+   */
+  uint32_t GetNumberOfTasks( WorkerPool::Priority& priority ) override;
+
+  /**
+   * @copydoc WorkerPool::Queue::ProcessNextTask()
+   * It fetches the next loading task from the loadQueue, loads the image and adds it to the completeQueue.
+   */
+  bool ProcessNextTask( uint64_t& latency ) override;
+
 private:
 
   /**
    * Pop the next loading task out from the queue to process.
+   * The oldest task of high priority is processed first, the oldest task otherwise.
    *
-   * @return The next task to be processed.
+   * @return The next task to be processed or NULL if the queue is empty.
    */
   LoadingTask* NextTaskToProcess();
 
@@ -193,14 +215,6 @@ private:
    */
   void AddCompletedTask( LoadingTask* task );
 
-protected:
-
-  /**
-   * The entry function of the worker thread.
-   * It fetches loading task from the loadQueue, loads the image and adds to the completeQueue.
-   */
-  void Run() override;
-
 private:
 
   // Undefined
@@ -214,10 +228,10 @@ private:
   Vector< LoadingTask* > mLoadQueue;     ///<The task queue with images for loading.
   Vector< LoadingTask* > mCompleteQueue; ///<The task queue with images loaded.
   EventThreadCallback*   mTrigger;
-  const Dali::LogFactoryInterface& mLogFactory; ///< The log factory
+  WorkerPoolPtr          mWorkerPool;    ///<The pool processing the tasks.
 
-  ConditionalWait        mConditionalWait;
-  Dali::Mutex            mMutex;
+  Dali::Mutex            mLoadMutex;     ///<Guards the loadQueue.
+  Dali::Mutex            mMutex;         ///<Guards the completeQueue.
 };
 
 } // namespace Internal
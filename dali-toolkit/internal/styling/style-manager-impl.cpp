@@ -27,6 +27,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/asset-manager/asset-manager.h>
 #include <dali-toolkit/internal/builder/builder-impl.h>
+#include <dali-toolkit/internal/builder/json-snapshot.h>
 #include <dali-toolkit/public-api/controls/control.h>
 #include <dali-toolkit/public-api/controls/control-impl.h>
 #include <dali-toolkit/public-api/styling/style-manager.h>
@@ -338,10 +339,36 @@ Toolkit::Builder StyleManager::CreateBuilder( const Property::Map& constants )
 
 bool StyleManager::LoadJSON( Toolkit::Builder builder, const std::string& jsonFilePath )
 {
+  // Load the snapshot without reading the file if the file is unchanged
+  std::vector<char> snapshot;
+  if( mThemeCache.Read( jsonFilePath, NULL, snapshot ) && GetImpl( builder ).LoadFromSnapshot( snapshot ) )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "LoadJSON() loaded snapshot of '%s'\n", jsonFilePath.c_str() );
+    return true;
+  }
+
   std::string fileString;
   if( LoadFile( jsonFilePath, fileString ) )
   {
-    builder.LoadFromString( fileString );
+    bool statusChanged = false;
+    if( mThemeCache.Read( jsonFilePath, &fileString, snapshot, &statusChanged ) && GetImpl( builder ).LoadFromSnapshot( snapshot ) )
+    {
+      // The file is unchanged, but its status is unknown or it was touched, in which case the status is stored for the next run
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "LoadJSON() loaded snapshot of '%s'\n", jsonFilePath.c_str() );
+      if( statusChanged )
+      {
+        mThemeCache.Write( jsonFilePath, fileString, snapshot );
+      }
+    }
+    else
+    {
+      builder.LoadFromString( fileString );
+
+      if( mThemeCache.IsEnabled() && RecordJsonSnapshot( fileString, snapshot ) )
+      {
+        mThemeCache.Write( jsonFilePath, fileString, snapshot );
+      }
+    }
     return true;
   }
   else
@@ -30,6 +30,7 @@
 #include <dali-toolkit/public-api/styling/style-manager.h>
 #include <dali-toolkit/devel-api/builder/builder.h>
 #include <dali-toolkit/internal/builder/style.h>
+#include <dali-toolkit/internal/styling/theme-cache.h>
 
 namespace Dali
 {
@@ -236,6 +237,7 @@ private:
   Property::Map mStyleBuilderConstants;   ///< Constants specific to building styles
 
   BuilderMap mBuilderCache;           ///< Cache of builders keyed by JSON file name
+  ThemeCache mThemeCache;             ///< Snapshots of the parsed JSON files, kept between runs
 
   Toolkit::Internal::FeedbackStyle* mFeedbackStyle; ///< Feedback style
 
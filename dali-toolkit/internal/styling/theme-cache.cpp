@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/styling/theme-cache.h>
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace
+{
+
+const char* THEME_CACHE_DIR_ENV = "DALI_THEME_CACHE_DIR";
+
+const char SNAPSHOT_MAGIC[8] = { 'D', 'A', 'L', 'I', 'T', 'H', 'M', '\0' };
+const uint32_t SNAPSHOT_VERSION = 1u; ///< To be increased when the snapshot or this header changes.
+
+/**
+ * The header of a snapshot file, followed by the path of the theme file and the snapshot.
+ * The snapshots are only read on the machine which wrote them.
+ */
+struct SnapshotHeader
+{
+  char     magic[8];
+  uint32_t version;
+  uint32_t pathSize;
+  uint64_t sourceSize;
+  int64_t  sourceModifiedTime; ///< In nanoseconds, 0 if unknown.
+  uint64_t sourceHash;
+  uint64_t snapshotSize;
+};
+
+/**
+ * Get the modification time of a file in nanoseconds, and its size.
+ */
+bool GetFileStatus( const std::string& path, int64_t& modifiedTime, uint64_t& size )
+{
+  struct stat status;
+  if( stat( path.c_str(), &status ) != 0 )
+  {
+    return false;
+  }
+
+  modifiedTime = static_cast<int64_t>( status.st_mtim.tv_sec ) * 1000000000 + status.st_mtim.tv_nsec;
+  size = static_cast<uint64_t>( status.st_size );
+  return true;
+}
+
+} // unnamed namespace
+
+ThemeCache::ThemeCache()
+: mDirectory()
+{
+  // Only an absolute path, as the working directory of the application is arbitrary
+  const char* directory = EnvironmentVariable::GetEnvironmentVariable( THEME_CACHE_DIR_ENV );
+  if( directory && ( *directory == '/' ) )
+  {
+    mDirectory = directory;
+  }
+}
+
+bool ThemeCache::IsEnabled() const
+{
+  return !mDirectory.empty();
+}
+
+bool ThemeCache::Read( const std::string& jsonFilePath, const std::string* source, std::vector<char>& snapshot, bool* statusChanged ) const
+{
+  if( !IsEnabled() )
+  {
+    return false;
+  }
+
+  std::ifstream stream( GetSnapshotPath( jsonFilePath ), std::ios::binary );
+  SnapshotHeader header;
+  if( !stream.read( reinterpret_cast<char*>( &header ), sizeof( header ) ) ||
+      ( std::memcmp( header.magic, SNAPSHOT_MAGIC, sizeof( SNAPSHOT_MAGIC ) ) != 0 ) ||
+      ( header.version != SNAPSHOT_VERSION ) ||
+      ( header.pathSize != jsonFilePath.size() ) )
+  {
+    return false;
+  }
+
+  // The snapshots are named by the hash of the path, so check it is this theme file's
+  std::string path( header.pathSize, '\0' );
+  if( !stream.read( &path[0], header.pathSize ) || ( path != jsonFilePath ) )
+  {
+    return false;
+  }
+
+  int64_t modifiedTime;
+  uint64_t size;
+  const bool hasStatus = GetFileStatus( jsonFilePath, modifiedTime, size );
+  const bool statusMatches = hasStatus && ( header.sourceModifiedTime == modifiedTime ) && ( header.sourceSize == size );
+
+  if( source )
+  {
+    if( ( header.sourceSize != source->size() ) || ( header.sourceHash != Dali::CalculateHash( *source ) ) )
+    {
+      return false;
+    }
+    if( statusChanged )
+    {
+      *statusChanged = hasStatus && !statusMatches;
+    }
+  }
+  else if( !statusMatches )
+  {
+    return false;
+  }
+
+  // A truncated file is rejected before allocating for it
+  const std::streampos position = stream.tellg();
+  stream.seekg( 0, std::ios::end );
+  if( static_cast<uint64_t>( stream.tellg() - position ) != header.snapshotSize )
+  {
+    return false;
+  }
+  stream.seekg( position );
+
+  snapshot.resize( header.snapshotSize );
+  if( !stream.read( snapshot.data(), header.snapshotSize ) )
+  {
+    snapshot.clear();
+    return false;
+  }
+
+  return true;
+}
+
+void ThemeCache::Write( const std::string& jsonFilePath, const std::string& source, const std::vector<char>& snapshot ) const
+{
+  if( !IsEnabled() )
+  {
+    return;
+  }
+
+  SnapshotHeader header;
+  std::memcpy( header.magic, SNAPSHOT_MAGIC, sizeof( SNAPSHOT_MAGIC ) );
+  header.version = SNAPSHOT_VERSION;
+  header.pathSize = static_cast<uint32_t>( jsonFilePath.size() );
+  header.sourceSize = source.size();
+  header.sourceHash = Dali::CalculateHash( source );
+  header.snapshotSize = snapshot.size();
+
+  // Without the status of the file, the snapshot is checked against its content only
+  uint64_t size;
+  if( !GetFileStatus( jsonFilePath, header.sourceModifiedTime, size ) || ( size != source.size() ) )
+  {
+    header.sourceModifiedTime = 0;
+  }
+
+  mkdir( mDirectory.c_str(), 0755 );
+
+  // Written aside then renamed, so another process never reads a partial snapshot
+  const std::string snapshotPath = GetSnapshotPath( jsonFilePath );
+  const std::string temporaryPath = snapshotPath + ".tmp";
+  {
+    std::ofstream stream( temporaryPath, std::ios::binary | std::ios::trunc );
+    stream.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    stream.write( jsonFilePath.data(), jsonFilePath.size() );
+    stream.write( snapshot.data(), snapshot.size() );
+    if( !stream.flush() )
+    {
+      DALI_LOG_WARNING( "Cannot write theme snapshot '%s'\n", temporaryPath.c_str() );
+      stream.close();
+      std::remove( temporaryPath.c_str() );
+      return;
+    }
+  }
+
+  if( std::rename( temporaryPath.c_str(), snapshotPath.c_str() ) != 0 )
+  {
+    std::remove( temporaryPath.c_str() );
+  }
+}
+
+std::string ThemeCache::GetSnapshotPath( const std::string& jsonFilePath ) const
+{
+  std::ostringstream path;
+  path << mDirectory << "/theme-" << std::hex << Dali::CalculateHash( jsonFilePath ) << ".snapshot";
+  return path.str();
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,93 @@
+#ifndef DALI_TOOLKIT_INTERNAL_THEME_CACHE_H
+#define DALI_TOOLKIT_INTERNAL_THEME_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+/**
+ * @brief The snapshots of the parsed theme files, kept between runs for the themes to be loaded without parsing json.
+ *
+ * The cache is enabled by setting DALI_THEME_CACHE_DIR to the absolute path of the directory to keep the snapshots in.
+ * A snapshot is valid while the modification time and size of its theme file are unchanged,
+ * or when they can't be found, while the content of the theme file is unchanged.
+ */
+class ThemeCache
+{
+public:
+
+  /**
+   * @brief Constructor, reading the cache directory from the environment.
+   */
+  ThemeCache();
+
+  /**
+   * @brief Whether a cache directory is given.
+   */
+  bool IsEnabled() const;
+
+  /**
+   * @brief Reads the snapshot of a theme file, if valid.
+   *
+   * @param[in] jsonFilePath The path of the theme file.
+   * @param[in] source The content of the theme file to check the snapshot against,
+   *                   or NULL to check the modification time and size of the file instead.
+   * @param[out] snapshot The snapshot.
+   * @param[out] statusChanged If given with the content, set to whether the modification time or size of the file
+   *                           differ from the snapshot's, i.e. whether to write the snapshot again for the next run.
+   * @return true if the snapshot is read and valid.
+   */
+  bool Read( const std::string& jsonFilePath, const std::string* source, std::vector<char>& snapshot, bool* statusChanged = NULL ) const;
+
+  /**
+   * @brief Writes the snapshot of a theme file, replacing any previous one.
+   *
+   * @param[in] jsonFilePath The path of the theme file.
+   * @param[in] source The content of the theme file.
+   * @param[in] snapshot The snapshot of the content.
+   */
+  void Write( const std::string& jsonFilePath, const std::string& source, const std::vector<char>& snapshot ) const;
+
+private:
+
+  /**
+   * @brief Gets the path of the snapshot of a theme file.
+   */
+  std::string GetSnapshotPath( const std::string& jsonFilePath ) const;
+
+  std::string mDirectory; ///< The cache directory, empty if disabled.
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_INTERNAL_THEME_CACHE_H
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/text/layouts/layout-engine.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <limits>
 #include <cmath>
 #include <dali/integration-api/debug.h>
@@ -1009,12 +1010,14 @@ struct Engine::Impl
    * @brief Updates the text's layout size adding the size of the previously laid-out lines.
    *
    * @param[in] lines The vector of lines (before the new laid-out lines are inserted).
+   * @param[in] startLineIndex The index to the first line to add.
    * @param[in,out] layoutSize The text's layout size.
    */
   void UpdateLayoutSize( const Vector<LineRun>& lines,
+                         LineIndex startLineIndex,
                          Size& layoutSize )
   {
-    for( Vector<LineRun>::ConstIterator it = lines.Begin(),
+    for( Vector<LineRun>::ConstIterator it = lines.Begin() + startLineIndex,
            endIt = lines.End();
          it != endIt;
          ++it )
@@ -1030,6 +1033,70 @@ struct Engine::Impl
     }
   }
 
+  /**
+   * @brief Updates the text's layout size adding the extent of the previously laid-out lines.
+   *
+   * @param[in] extent The extent of the lines.
+   * @param[in,out] layoutSize The text's layout size.
+   */
+  void UpdateLayoutSize( const LinesExtent& extent,
+                         Size& layoutSize )
+  {
+    if( extent.width > layoutSize.width )
+    {
+      layoutSize.width = extent.width;
+    }
+
+    layoutSize.height += extent.height;
+  }
+
+  /**
+   * @brief Retrieves the extent of the first lines.
+   *
+   * The extents of the lines are cached in the visual model, so the lines before the ones being laid-out are traversed only once.
+   *
+   * @param[in] lines The vector of lines.
+   * @param[in,out] linesExtents The cached extents, which are extended up to the given line.
+   * @param[in] numberOfLines The number of lines.
+   *
+   * @return The extent of the first @p numberOfLines lines.
+   */
+  LinesExtent GetLinesExtent( const Vector<LineRun>& lines,
+                              Vector<LinesExtent>& linesExtents,
+                              Length numberOfLines )
+  {
+    LinesExtent extent = { 0.f, 0.f, 0.f };
+    if( 0u == numberOfLines )
+    {
+      return extent;
+    }
+
+    Length index = linesExtents.Count();
+    if( index >= numberOfLines )
+    {
+      return *( linesExtents.Begin() + numberOfLines - 1u );
+    }
+
+    if( 0u != index )
+    {
+      extent = *( linesExtents.End() - 1u );
+    }
+
+    linesExtents.Reserve( numberOfLines );
+    for( ; index < numberOfLines; ++index )
+    {
+      const LineRun& line = *( lines.Begin() + index );
+
+      extent.width = std::max( extent.width, line.width );
+      extent.height += ( line.ascender + -line.descender ) + line.lineSpacing;
+      extent.offset += line.ascender - line.descender;
+
+      linesExtents.PushBack( extent );
+    }
+
+    return extent;
+  }
+
   /**
    * @brief Updates the indices of the character and glyph runs of the lines before the new lines are inserted.
    *
@@ -1068,9 +1135,13 @@ struct Engine::Impl
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  box size %f, %f\n", layoutParameters.boundingBox.width, layoutParameters.boundingBox.height );
 
     Vector<LineRun>& lines = layoutParameters.textModel->mVisualModel->mLines;
+    Vector<LinesExtent>& linesExtents = layoutParameters.textModel->mVisualModel->mLinesExtents;
 
     if( 0u == layoutParameters.numberOfGlyphs )
     {
+      // The lines before the start line are the ones previously laid-out.
+      linesExtents.Resize( std::min<Length>( linesExtents.Count(), std::min<Length>( layoutParameters.startLineIndex, lines.Count() ) ) );
+
       // Add an extra line if the last character is a new paragraph character and the last line doesn't have zero characters.
       if( layoutParameters.isLastNewParagraph )
       {
@@ -1097,7 +1168,7 @@ struct Engine::Impl
       }
 
       // Calculates the layout size.
-      UpdateLayoutSize( lines,
+      UpdateLayoutSize( GetLinesExtent( lines, linesExtents, lines.Count() ),
                         layoutSize );
 
       // Rounds upward to avoid a non integer size.
@@ -1137,14 +1208,31 @@ struct Engine::Impl
     // Whether the layout is being updated or set from scratch.
     const bool updateCurrentBuffer = layoutParameters.numberOfGlyphs < totalNumberOfGlyphs;
 
+    // When the layout is updated, the lines before the start line are the ones previously laid-out.
+    // Their extent gives the position of the new lines and their contribution to the layout size without traversing them.
+    LinesExtent previousLinesExtent = { 0.f, 0.f, 0.f };
+    if( updateCurrentBuffer )
+    {
+      linesExtents.Resize( std::min<Length>( linesExtents.Count(), std::min<Length>( layoutParameters.startLineIndex, lines.Count() ) ) );
+      previousLinesExtent = GetLinesExtent( lines,
+                                            linesExtents,
+                                            layoutParameters.startLineIndex );
+    }
+    else
+    {
+      linesExtents.Clear();
+    }
+
     Vector2* glyphPositionsBuffer = nullptr;
     Vector<Vector2> newGlyphPositions;
 
     LineRun* linesBuffer = nullptr;
     Vector<LineRun> newLines;
 
-    // Estimate the number of lines.
-    Length linesCapacity = std::max( 1u, layoutParameters.estimatedNumberOfLines );
+    // Estimate the number of lines. When the layout is updated only the lines after the start line are laid-out again.
+    const Length estimatedNumberOfLines = updateCurrentBuffer ? layoutParameters.estimatedNumberOfLines - std::min( layoutParameters.estimatedNumberOfLines, layoutParameters.startLineIndex ) :
+                                                                layoutParameters.estimatedNumberOfLines;
+    Length linesCapacity = std::max( 1u, estimatedNumberOfLines );
     Length numberOfLines = 0u;
 
     if( updateCurrentBuffer )
@@ -1163,8 +1251,8 @@ struct Engine::Impl
       linesBuffer = lines.Begin();
     }
 
-    float penY = CalculateLineOffset( lines,
-                                      layoutParameters.startLineIndex );
+    float penY = updateCurrentBuffer ? previousLinesExtent.offset : CalculateLineOffset( lines,
+                                                                                         layoutParameters.startLineIndex );
     for( GlyphIndex index = layoutParameters.startGlyphIndex; index < lastGlyphPlusOne; )
     {
       layoutBidiParameters.Clear();
@@ -1383,8 +1471,11 @@ struct Engine::Impl
       newLines.Resize( numberOfLines );
 
       // Current text's layout size adds only the newly laid-out lines.
-      // Updates the layout size with the previously laid-out lines.
+      // Updates the layout size with the previously laid-out lines, the ones before and after the new ones.
+      UpdateLayoutSize( previousLinesExtent,
+                        layoutSize );
       UpdateLayoutSize( lines,
+                        layoutParameters.startLineIndex,
                         layoutSize );
 
       if( 0u != newLines.Count() )
@@ -1431,19 +1522,24 @@ struct Engine::Impl
     const CharacterIndex lastCharacterPlusOne = startIndex + numberOfCharacters;
 
     alignmentOffset = MAX_FLOAT;
-    // Traverse all lines and align the glyphs.
-    for( Vector<LineRun>::Iterator it = lines.Begin(), endIt = lines.End();
+
+    // Do not align lines which have already been aligned.
+    // The lines are sorted by character index, so the first line to align is searched instead of traversing the previous ones.
+    Vector<LineRun>::Iterator firstLine = std::lower_bound( lines.Begin(),
+                                                            lines.End(),
+                                                            startIndex,
+                                                            []( const LineRun& line, CharacterIndex index )
+                                                            {
+                                                              return line.characterRun.characterIndex < index;
+                                                            } );
+
+    // Traverse the lines from the first one to align and align the glyphs.
+    for( Vector<LineRun>::Iterator it = firstLine, endIt = lines.End();
          it != endIt;
          ++it )
     {
       LineRun& line = *it;
 
-      if( line.characterRun.characterIndex < startIndex )
-      {
-        // Do not align lines which have already been aligned.
-        continue;
-      }
-
       if( line.characterRun.characterIndex > lastCharacterPlusOne )
       {
         // Do not align lines beyond the last laid-out character.
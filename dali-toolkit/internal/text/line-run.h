@@ -48,6 +48,16 @@ struct LineRun
   bool               ellipsis  : 1;   ///< Wheter ellipsis is added to the line.
 };
 
+/**
+ * @brief The extent of the lines from the first one up to a given line.
+ */
+struct LinesExtent
+{
+  float width;  ///< The width of the widest line.
+  float height; ///< The height of the lines including their line spacing.
+  float offset; ///< The height of the lines without their line spacing, i.e. the vertical offset of the next line given by CalculateLineOffset().
+};
+
 } // namespace Text
 
 } // namespace Toolkit
@@ -62,6 +62,18 @@ public:
     mGlyphType = glyphType;
   }
 
+  /**
+   * @brief Sets a factor to scale the font metrics with.
+   *
+   * Used to lay out the text at a different point size without shaping it again.
+   *
+   * @param[in] scale The scale factor. By default is 1.
+   */
+  void SetFontMetricsScale( float scale )
+  {
+    mFontMetricsScale = scale;
+  }
+
   /**
    * @brief Query the metrics for a font.
    *
@@ -71,6 +83,15 @@ public:
   void GetFontMetrics( FontId fontId, FontMetrics& metrics )
   {
     mFontClient.GetFontMetrics( fontId, metrics ); // inline for performance
+
+    if( 1.f != mFontMetricsScale )
+    {
+      metrics.ascender *= mFontMetricsScale;
+      metrics.descender *= mFontMetricsScale;
+      metrics.height *= mFontMetricsScale;
+      metrics.underlinePosition *= mFontMetricsScale;
+      metrics.underlineThickness *= mFontMetricsScale;
+    }
   }
 
   /**
@@ -113,7 +134,8 @@ private:
    */
   Metrics( TextAbstraction::FontClient& fontClient )
   : mFontClient( fontClient ),
-    mGlyphType( TextAbstraction::BITMAP_GLYPH )
+    mGlyphType( TextAbstraction::BITMAP_GLYPH ),
+    mFontMetricsScale( 1.f )
   {}
 
   // Undefined
@@ -126,6 +148,7 @@ private:
 
   TextAbstraction::FontClient mFontClient;
   TextAbstraction::GlyphType mGlyphType;
+  float mFontMetricsScale;
 };
 
 } // namespace Text
@@ -39,6 +39,8 @@ Debug::Filter* gLogFilter = Debug::Filter::New(Debug::NoLogging, true, "LOG_MULT
 #endif
 
 const Dali::Toolkit::Text::Character UTF32_A = 0x0041;
+
+const std::size_t MAX_NUMBER_OF_SUPPORTED_CHARACTERS = 65536u; ///< The validated characters are forgotten when there are more.
 }
 
 namespace Text
@@ -63,10 +65,31 @@ bool ValidateFontsPerScript::IsValidFont( FontId fontId ) const
   return false;
 }
 
+std::size_t DefaultFonts::SearchKeyHash::operator()( const SearchKey& key ) const
+{
+  std::size_t hash = std::hash<std::string>()( key.family );
+
+  hash = hash * 31u + static_cast<std::size_t>( key.weight );
+  hash = hash * 31u + static_cast<std::size_t>( key.width );
+  hash = hash * 31u + static_cast<std::size_t>( key.slant );
+  hash = hash * 31u + static_cast<std::size_t>( key.size );
+
+  return hash;
+}
+
 FontId DefaultFonts::FindFont( TextAbstraction::FontClient& fontClient,
                                const TextAbstraction::FontDescription& description,
-                               PointSize26Dot6 size ) const
+                               PointSize26Dot6 size )
 {
+  const SearchKey key( description, size );
+
+  std::unordered_map<SearchKey, FontId, SearchKeyHash>::const_iterator searchIt = mSearches.find( key );
+  if( searchIt != mSearches.end() )
+  {
+    return searchIt->second;
+  }
+
+  FontId fontId = 0u;
   for( std::vector<CacheItem>::const_iterator it = mFonts.begin(),
          endIt = mFonts.end();
        it != endIt;
@@ -80,11 +103,14 @@ FontId DefaultFonts::FindFont( TextAbstraction::FontClient& fontClient,
         ( size == fontClient.GetPointSize( item.fontId ) ) &&
         ( description.family.empty() || ( description.family == item.description.family ) ) )
     {
-      return item.fontId;
+      fontId = item.fontId;
+      break;
     }
   }
 
-  return 0u;
+  mSearches[key] = fontId;
+
+  return fontId;
 }
 
 void DefaultFonts::Cache( const TextAbstraction::FontDescription& description, FontId fontId )
@@ -93,11 +119,15 @@ void DefaultFonts::Cache( const TextAbstraction::FontDescription& description, F
   item.description = description;
   item.fontId = fontId;
   mFonts.push_back( item );
+
+  // The new font may be found by the searches which didn't find any.
+  mSearches.clear();
 }
 
 MultilanguageSupport::MultilanguageSupport()
 : mDefaultFontPerScriptCache(),
-  mValidFontsPerScriptCache()
+  mValidFontsPerScriptCache(),
+  mSupportedCharacters()
 {
   // Initializes the default font cache to zero (invalid font).
   // Reserves space to cache the default fonts and access them with the script as an index.
@@ -493,30 +523,39 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
 #endif
 
     // Validate whether the current character is supported by the given font.
-    bool isValidFont = false;
 
-    // Check first in the cache of default fonts per script and size.
+    // Check first whether the character has already been validated for the font.
+    // i.e. when a paragraph is updated, most of its characters have been validated before.
+    const uint64_t supportedCharacterKey = ( static_cast<uint64_t>( fontId ) << 32u ) | character;
+    const bool isSupportedCharacter = mSupportedCharacters.end() != mSupportedCharacters.find( supportedCharacterKey );
+    bool isValidFont = isSupportedCharacter;
+
+    // Then in the cache of default fonts per script and size.
 
     FontId cachedDefaultFontId = 0u;
-    DefaultFonts* defaultFonts = *( defaultFontPerScriptCacheBuffer + script );
-    if( NULL != defaultFonts )
+    bool isValidCachedDefaultFont = false;
+    if( !isValidFont )
     {
-      // This cache stores fall-back fonts.
-      cachedDefaultFontId = defaultFonts->FindFont( fontClient,
-                                                    currentFontDescription,
-                                                    currentFontPointSize );
-    }
+      DefaultFonts* defaultFonts = *( defaultFontPerScriptCacheBuffer + script );
+      if( NULL != defaultFonts )
+      {
+        // This cache stores fall-back fonts.
+        cachedDefaultFontId = defaultFonts->FindFont( fontClient,
+                                                      currentFontDescription,
+                                                      currentFontPointSize );
+      }
 
-    // Whether the cached default font is valid.
-    const bool isValidCachedDefaultFont = 0u != cachedDefaultFontId;
+      // Whether the cached default font is valid.
+      isValidCachedDefaultFont = 0u != cachedDefaultFontId;
 
-    // The font is valid if it matches with the default one for the current script and size and it's different than zero.
-    isValidFont = isValidCachedDefaultFont && ( fontId == cachedDefaultFontId );
+      // The font is valid if it matches with the default one for the current script and size and it's different than zero.
+      isValidFont = isValidCachedDefaultFont && ( fontId == cachedDefaultFontId );
 
-    if( isValidFont )
-    {
-      // Check if the font supports the character.
-      isValidFont = fontClient.IsCharacterSupportedByFont( fontId, character );
+      if( isValidFont )
+      {
+        // Check if the font supports the character.
+        isValidFont = fontClient.IsCharacterSupportedByFont( fontId, character );
+      }
     }
 
     bool isCommonScript = false;
@@ -651,6 +690,16 @@ void MultilanguageSupport::ValidateFonts( const Vector<Character>& text,
       } // !isValidFont (2)
     } // !isValidFont (1)
 
+    if( isValidFont && !isSupportedCharacter )
+    {
+      // The given font supports the character, it doesn't need to be validated again.
+      if( mSupportedCharacters.size() >= MAX_NUMBER_OF_SUPPORTED_CHARACTERS )
+      {
+        mSupportedCharacters.clear();
+      }
+      mSupportedCharacters.insert( supportedCharacterKey );
+    }
+
 #ifdef DEBUG_ENABLED
     {
       Dali::TextAbstraction::FontDescription description;
@@ -19,6 +19,8 @@
  */
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
+#include <unordered_set>
 #include <dali/public-api/object/base-object.h>
 
 // INTERNAL INCLUDES
@@ -83,11 +85,49 @@ struct DefaultFonts
     FontId fontId;
   };
 
+  /**
+   * @brief The description and size of a FindFont() search.
+   *
+   * Empty or NONE fields are wildcards.
+   */
+  struct SearchKey
+  {
+    SearchKey( const TextAbstraction::FontDescription& description,
+               PointSize26Dot6 pointSize )
+    : family( description.family ),
+      weight( description.weight ),
+      width( description.width ),
+      slant( description.slant ),
+      size( pointSize )
+    {}
+
+    bool operator==( const SearchKey& rhs ) const
+    {
+      return ( size == rhs.size ) &&
+             ( weight == rhs.weight ) &&
+             ( width == rhs.width ) &&
+             ( slant == rhs.slant ) &&
+             ( family == rhs.family );
+    }
+
+    std::string family;
+    TextAbstraction::FontWeight::Type weight;
+    TextAbstraction::FontWidth::Type width;
+    TextAbstraction::FontSlant::Type slant;
+    PointSize26Dot6 size;
+  };
+
+  struct SearchKeyHash
+  {
+    std::size_t operator()( const SearchKey& key ) const;
+  };
+
   /**
    * Default constructor.
    */
   DefaultFonts()
-  : mFonts()
+  : mFonts(),
+    mSearches()
   {}
 
   /**
@@ -99,6 +139,9 @@ struct DefaultFonts
   /**
    * @brief Finds a default font for the given @p size.
    *
+   * The result of each search is kept, so the cached fonts are only traversed the first time
+   * a description and size are searched.
+   *
    * @param[in] fontClient The font client.
    * @param[in] description The font's description.
    * @param[in] size The given size.
@@ -107,11 +150,12 @@ struct DefaultFonts
    */
   FontId FindFont( TextAbstraction::FontClient& fontClient,
                    const TextAbstraction::FontDescription& description,
-                   PointSize26Dot6 size ) const;
+                   PointSize26Dot6 size );
 
   void Cache( const TextAbstraction::FontDescription& description, FontId fontId );
 
   std::vector<CacheItem> mFonts;
+  std::unordered_map<SearchKey, FontId, SearchKeyHash> mSearches; ///< The font found for a description and size, with the wildcards resolved.
 };
 
 /**
@@ -161,6 +205,7 @@ public:
 private:
   Vector<DefaultFonts*>           mDefaultFontPerScriptCache; ///< Caches default fonts for a script.
   Vector<ValidateFontsPerScript*> mValidFontsPerScriptCache;  ///< Caches valid fonts for a script.
+  std::unordered_set<uint64_t>    mSupportedCharacters;       ///< The characters already validated for a font, as ( font id << 32 ) | character.
 };
 
 } // namespace Internal
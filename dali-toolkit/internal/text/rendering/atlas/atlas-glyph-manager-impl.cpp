@@ -38,6 +38,18 @@ namespace Toolkit
 namespace Internal
 {
 
+std::size_t AtlasGlyphManager::GlyphRecordKeyHash::operator()( const GlyphRecordKey& key ) const
+{
+  uint64_t hash = ( static_cast< uint64_t >( key.mFontId ) << 32u ) | key.mIndex;
+  hash ^= ( ( static_cast< uint64_t >( key.mOutlineWidth ) << 2u ) | ( key.isItalic << 1u ) | key.isBold ) * 0x9e3779b97f4a7c15ull;
+
+  // Mix the bits so that nearby glyph indices of the same font spread across the buckets
+  hash ^= hash >> 33u;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33u;
+  return static_cast< std::size_t >( hash );
+}
+
 AtlasGlyphManager::AtlasGlyphManager()
 {
   mAtlasManager = Dali::Toolkit::AtlasManager::New();
@@ -47,7 +59,7 @@ AtlasGlyphManager::AtlasGlyphManager()
 
 void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
                              const Toolkit::AtlasGlyphManager::GlyphStyle& style,
-                             const PixelData& bitmap,
+                             const Devel::PixelBuffer& bitmap,
                              Dali::Toolkit::AtlasManager::AtlasSlot& slot )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "Added glyph, font: %d index: %d\n", glyph.fontId, glyph.index );
@@ -65,34 +77,10 @@ void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
   }
 
   GlyphRecordEntry record;
-  record.mIndex = glyph.index;
   record.mImageId = slot.mImageId;
   record.mCount = 1;
-  record.mOutlineWidth = style.outline;
-  record.isItalic = style.isItalic;
-  record.isBold = style.isBold;
-
-  // Have glyph records been created for this fontId ?
-  bool foundGlyph = false;
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end(); ++fontGlyphRecordIt )
-  {
-    if ( fontGlyphRecordIt->mFontId == glyph.fontId )
-    {
-      fontGlyphRecordIt->mGlyphRecords.PushBack( record );
-      foundGlyph = true;
-      break;
-    }
-  }
 
-  if ( !foundGlyph )
-  {
-    // We need to add a new font entry
-    FontGlyphRecord fontGlyphRecord;
-    fontGlyphRecord.mFontId = glyph.fontId;
-    fontGlyphRecord.mGlyphRecords.PushBack( record );
-    mFontGlyphRecords.push_back( fontGlyphRecord );
-  }
+  mGlyphRecords[ GlyphRecordKey( glyph.fontId, glyph.index, style ) ] = record;
 }
 
 void AtlasGlyphManager::GenerateMeshData( uint32_t imageId,
@@ -108,27 +96,12 @@ bool AtlasGlyphManager::IsCached( Text::FontId fontId,
                                   const Toolkit::AtlasGlyphManager::GlyphStyle& style,
                                   Dali::Toolkit::AtlasManager::AtlasSlot& slot )
 {
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end();
-        ++fontGlyphRecordIt )
+  GlyphRecordContainer::const_iterator glyphRecordIt = mGlyphRecords.find( GlyphRecordKey( fontId, index, style ) );
+  if ( glyphRecordIt != mGlyphRecords.end() )
   {
-    if ( fontGlyphRecordIt->mFontId == fontId )
-    {
-      for ( Vector< GlyphRecordEntry >::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-            glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-            ++glyphRecordIt )
-      {
-        if ( ( glyphRecordIt->mIndex == index ) &&
-             ( glyphRecordIt->mOutlineWidth == style.outline ) &&
-             ( glyphRecordIt->isItalic == style.isItalic ) &&
-             ( glyphRecordIt->isBold == style.isBold ) )
-        {
-          slot.mImageId = glyphRecordIt->mImageId;
-          slot.mAtlasId = mAtlasManager.GetAtlas( slot.mImageId );
-          return true;
-        }
-      }
-    }
+    slot.mImageId = glyphRecordIt->second.mImageId;
+    slot.mAtlasId = mAtlasManager.GetAtlas( slot.mImageId );
+    return true;
   }
   slot.mImageId = 0;
   return false;
@@ -140,13 +113,11 @@ Vector2 AtlasGlyphManager::GetAtlasSize( uint32_t atlasId )
   return Vector2( static_cast< float >( size.mWidth ), static_cast< float >( size.mHeight ) );
 }
 
-void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight )
+void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height )
 {
   Toolkit::AtlasManager::AtlasSize size;
   size.mWidth = width;
   size.mHeight = height;
-  size.mBlockWidth = blockWidth;
-  size.mBlockHeight = blockHeight;
   mAtlasManager.SetNewAtlasSize( size );
 }
 
@@ -159,21 +130,12 @@ const Toolkit::AtlasGlyphManager::Metrics& AtlasGlyphManager::GetMetrics()
 {
   std::ostringstream verboseMetrics;
 
-  mMetrics.mGlyphCount = 0u;
-  for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-        fontGlyphRecordIt != mFontGlyphRecords.end();
-        ++fontGlyphRecordIt )
+  mMetrics.mGlyphCount = mGlyphRecords.size();
+  for ( GlyphRecordContainer::const_iterator glyphRecordIt = mGlyphRecords.begin();
+        glyphRecordIt != mGlyphRecords.end();
+        ++glyphRecordIt )
   {
-    mMetrics.mGlyphCount += fontGlyphRecordIt->mGlyphRecords.Size();
-
-    verboseMetrics << "[FontId " << fontGlyphRecordIt->mFontId << " Glyph ";
-    for ( Vector< GlyphRecordEntry >::Iterator glyphRecordEntryIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-          glyphRecordEntryIt != fontGlyphRecordIt->mGlyphRecords.End();
-          ++glyphRecordEntryIt )
-    {
-      verboseMetrics << glyphRecordEntryIt->mIndex << "(" << glyphRecordEntryIt->mCount << ") ";
-    }
-    verboseMetrics << "] ";
+    verboseMetrics << "[FontId " << glyphRecordIt->first.mFontId << " Glyph " << glyphRecordIt->first.mIndex << "(" << glyphRecordIt->second.mCount << ")] ";
   }
   mMetrics.mVerboseGlyphCounts = verboseMetrics.str();
 
@@ -188,33 +150,18 @@ void AtlasGlyphManager::AdjustReferenceCount( Text::FontId fontId, Text::GlyphIn
   {
     DALI_LOG_INFO( gLogFilter, Debug::General, "AdjustReferenceCount %d, font: %d index: %d\n", delta, fontId, index );
 
-    for ( std::vector< FontGlyphRecord >::iterator fontGlyphRecordIt = mFontGlyphRecords.begin();
-          fontGlyphRecordIt != mFontGlyphRecords.end();
-          ++fontGlyphRecordIt )
+    GlyphRecordContainer::iterator glyphRecordIt = mGlyphRecords.find( GlyphRecordKey( fontId, index, style ) );
+    if ( glyphRecordIt != mGlyphRecords.end() )
     {
-      if ( fontGlyphRecordIt->mFontId == fontId )
+      glyphRecordIt->second.mCount += delta;
+      DALI_ASSERT_DEBUG( glyphRecordIt->second.mCount >= 0 && "Glyph ref-count should not be negative" );
+
+      if ( !glyphRecordIt->second.mCount )
       {
-        for ( Vector< GlyphRecordEntry >::Iterator glyphRecordIt = fontGlyphRecordIt->mGlyphRecords.Begin();
-              glyphRecordIt != fontGlyphRecordIt->mGlyphRecords.End();
-              ++glyphRecordIt )
-        {
-          if ( ( glyphRecordIt->mIndex == index ) &&
-               ( glyphRecordIt->mOutlineWidth == style.outline ) &&
-               ( glyphRecordIt->isItalic == style.isItalic ) &&
-               ( glyphRecordIt->isBold == style.isBold ) )
-          {
-            glyphRecordIt->mCount += delta;
-            DALI_ASSERT_DEBUG( glyphRecordIt->mCount >= 0 && "Glyph ref-count should not be negative" );
-
-            if ( !glyphRecordIt->mCount )
-            {
-              mAtlasManager.Remove( glyphRecordIt->mImageId );
-              fontGlyphRecordIt->mGlyphRecords.Remove( glyphRecordIt );
-            }
-            return;
-          }
-        }
+        mAtlasManager.Remove( glyphRecordIt->second.mImageId );
+        mGlyphRecords.erase( glyphRecordIt );
       }
+      return;
     }
 
     // Should not arrive here
@@ -227,6 +174,11 @@ TextureSet AtlasGlyphManager::GetTextures( uint32_t atlasId ) const
   return mAtlasManager.GetTextures( atlasId );
 }
 
+void AtlasGlyphManager::UploadAtlases()
+{
+  mAtlasManager.UploadAtlases();
+}
+
 AtlasGlyphManager::~AtlasGlyphManager()
 {
   // mAtlasManager handle is automatically released here
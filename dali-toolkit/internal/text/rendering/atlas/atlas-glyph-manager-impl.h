@@ -19,6 +19,7 @@
 
 
 // EXTERNAL INCLUDES
+#include <unordered_map>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/base-object.h>
 
@@ -48,22 +49,49 @@ class AtlasGlyphManager : public Dali::BaseObject
 {
 public:
 
-  struct GlyphRecordEntry
+  /**
+   * @brief Identifies a glyph bitmap by its font, index and style
+   */
+  struct GlyphRecordKey
   {
+    GlyphRecordKey( Text::FontId fontId, Text::GlyphIndex index, const Toolkit::AtlasGlyphManager::GlyphStyle& style )
+    : mFontId( fontId ),
+      mIndex( index ),
+      mOutlineWidth( style.outline ),
+      isItalic( style.isItalic ),
+      isBold( style.isBold )
+    {
+    }
+
+    bool operator==( const GlyphRecordKey& other ) const
+    {
+      return ( mFontId == other.mFontId ) &&
+             ( mIndex == other.mIndex ) &&
+             ( mOutlineWidth == other.mOutlineWidth ) &&
+             ( isItalic == other.isItalic ) &&
+             ( isBold == other.isBold );
+    }
+
+    Text::FontId mFontId;
     Text::GlyphIndex mIndex;
-    uint32_t mImageId;
-    int32_t mCount;
     uint16_t mOutlineWidth;
     bool isItalic:1;
     bool isBold:1;
   };
 
-  struct FontGlyphRecord
+  struct GlyphRecordKeyHash
   {
-    Text::FontId mFontId;
-    Vector< GlyphRecordEntry > mGlyphRecords;
+    std::size_t operator()( const GlyphRecordKey& key ) const;
+  };
+
+  struct GlyphRecordEntry
+  {
+    uint32_t mImageId;
+    int32_t mCount;
   };
 
+  typedef std::unordered_map< GlyphRecordKey, GlyphRecordEntry, GlyphRecordKeyHash > GlyphRecordContainer;
+
   /**
    * @brief Constructor
    */
@@ -74,7 +102,7 @@ public:
    */
   void Add( const Text::GlyphInfo& glyph,
             const Toolkit::AtlasGlyphManager::GlyphStyle& style,
-            const PixelData& bitmap,
+            const Devel::PixelBuffer& bitmap,
             Dali::Toolkit::AtlasManager::AtlasSlot& slot );
 
   /**
@@ -100,7 +128,7 @@ public:
   /**
    * @copydoc Toolkit::AtlasGlyphManager::SetNewAtlasSize
    */
-  void SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight );
+  void SetNewAtlasSize( uint32_t width, uint32_t height );
 
   /**
    * @copydoc Toolkit::AtlasGlyphManager::GetPixelFormat
@@ -122,6 +150,11 @@ public:
    */
   const Toolkit::AtlasGlyphManager::Metrics& GetMetrics();
 
+  /**
+   * @copydoc Toolkit::AtlasGlyphManager::UploadAtlases
+   */
+  void UploadAtlases();
+
 protected:
 
   /**
@@ -132,7 +165,7 @@ protected:
 private:
 
   Dali::Toolkit::AtlasManager mAtlasManager;          ///> Atlas Manager created by GlyphManager
-  std::vector< FontGlyphRecord > mFontGlyphRecords;
+  GlyphRecordContainer mGlyphRecords;                 ///> The glyphs in the atlases, with their reference counts
   Toolkit::AtlasGlyphManager::Metrics mMetrics;       ///> Metrics to pass back on GlyphManager status
   Sampler mSampler;
 };
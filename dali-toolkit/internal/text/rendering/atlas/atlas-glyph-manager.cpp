@@ -70,7 +70,7 @@ AtlasGlyphManager::AtlasGlyphManager(Internal::AtlasGlyphManager *impl)
 
 void AtlasGlyphManager::Add( const Text::GlyphInfo& glyph,
                              const GlyphStyle& style,
-                             const PixelData& bitmap,
+                             const Devel::PixelBuffer& bitmap,
                              AtlasManager::AtlasSlot& slot )
 {
   GetImplementation(*this).Add( glyph, style, bitmap, slot );
@@ -93,9 +93,9 @@ bool AtlasGlyphManager::IsCached( Text::FontId fontId,
   return GetImplementation(*this).IsCached( fontId, index, style, slot );
 }
 
-void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight )
+void AtlasGlyphManager::SetNewAtlasSize( uint32_t width, uint32_t height )
 {
-  GetImplementation(*this).SetNewAtlasSize( width, height, blockWidth, blockHeight );
+  GetImplementation(*this).SetNewAtlasSize( width, height );
 }
 
 Vector2 AtlasGlyphManager::GetAtlasSize( uint32_t atlasId )
@@ -123,6 +123,11 @@ void AtlasGlyphManager::AdjustReferenceCount( Text::FontId fontId, Text::GlyphIn
   GetImplementation(*this).AdjustReferenceCount( fontId, index, style, delta );
 }
 
+void AtlasGlyphManager::UploadAtlases()
+{
+  GetImplementation(*this).UploadAtlases();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
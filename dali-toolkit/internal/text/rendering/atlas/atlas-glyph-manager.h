@@ -99,7 +99,7 @@ public:
    */
   void Add( const Text::GlyphInfo& glyph,
             const GlyphStyle& style,
-            const PixelData& bitmap,
+            const Devel::PixelBuffer& bitmap,
             AtlasManager::AtlasSlot& slot );
 
   /**
@@ -138,14 +138,12 @@ public:
   Vector2 GetAtlasSize( uint32_t atlasId );
 
    /**
-    * @brief Set the atlas size and block size for subsequent Atlas generation
+    * @brief Set the atlas size for subsequent Atlas generation
     *
     * @param[in] width width of atlas in pixels
     * @param[in] height height of atlas in pixels
-    * @param[in] blockWidth width of a block in pixels
-    * @param[in] blockHeight height of a block in pixels
     */
-  void SetNewAtlasSize( uint32_t width, uint32_t height, uint32_t blockWidth, uint32_t blockHeight );
+  void SetNewAtlasSize( uint32_t width, uint32_t height );
 
   /**
    * @brief Get the Pixel Format used by an atlas
@@ -182,6 +180,11 @@ public:
    */
   void AdjustReferenceCount( Text::FontId fontId, Text::GlyphIndex index, const GlyphStyle& style, int32_t delta );
 
+  /**
+   * @brief Uploads the glyphs added since the last upload to the atlas textures
+   */
+  void UploadAtlases();
+
 private:
 
   explicit DALI_INTERNAL AtlasGlyphManager(Internal::AtlasGlyphManager *impl);
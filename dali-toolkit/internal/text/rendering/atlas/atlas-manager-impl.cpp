@@ -19,7 +19,9 @@
 
 // EXTERNAL INCLUDES
 #include <string.h>
+#include <algorithm>
 #include <dali/integration-api/debug.h>
+#include <dali/integration-api/adaptor-framework/adaptor.h>
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-mesh-factory.h>
@@ -37,25 +39,41 @@ namespace
 {
   const uint32_t DEFAULT_ATLAS_WIDTH( 512u );
   const uint32_t DEFAULT_ATLAS_HEIGHT( 512u );
-  const uint32_t DEFAULT_BLOCK_WIDTH( 16u );
-  const uint32_t DEFAULT_BLOCK_HEIGHT( 16u );
+  const uint32_t FILLED_PIXEL( 1u );
   const uint32_t SINGLE_PIXEL_PADDING( 1u );
   const uint32_t DOUBLE_PIXEL_PADDING( SINGLE_PIXEL_PADDING << 1 );
   Toolkit::AtlasManager::AtlasSize EMPTY_SIZE;
 
-  bool IsBlockSizeSufficient( uint32_t width, uint32_t height, uint32_t requiredBlockWidth, uint32_t requiredBlockHeight )
+  bool IsAtlasSizeSufficient( uint32_t width, uint32_t height, const Toolkit::AtlasManager::AtlasSize& atlasSize )
   {
-    return ( width + DOUBLE_PIXEL_PADDING <= requiredBlockWidth ) && ( height + DOUBLE_PIXEL_PADDING <= requiredBlockHeight );
+    // The filled pixel takes the top row and the left column of every atlas
+    return ( width + DOUBLE_PIXEL_PADDING + FILLED_PIXEL <= atlasSize.mWidth ) && ( height + DOUBLE_PIXEL_PADDING + FILLED_PIXEL <= atlasSize.mHeight );
+  }
+
+  void MergeRect( Rect< uint32_t >& rect, uint32_t x, uint32_t y, uint32_t width, uint32_t height )
+  {
+    if ( rect.IsEmpty() )
+    {
+      rect = Rect< uint32_t >( x, y, width, height );
+    }
+    else
+    {
+      const uint32_t right = std::max( rect.x + rect.width, x + width );
+      const uint32_t bottom = std::max( rect.y + rect.height, y + height );
+      rect.x = std::min( rect.x, x );
+      rect.y = std::min( rect.y, y );
+      rect.width = right - rect.x;
+      rect.height = bottom - rect.y;
+    }
   }
 }
 
 AtlasManager::AtlasManager()
-: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES )
+: mAddFailPolicy( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES ),
+  mProcessorRegistered( false )
 {
   mNewAtlasSize.mWidth = DEFAULT_ATLAS_WIDTH;
   mNewAtlasSize.mHeight = DEFAULT_ATLAS_HEIGHT;
-  mNewAtlasSize.mBlockWidth = DEFAULT_BLOCK_WIDTH;
-  mNewAtlasSize.mBlockHeight = DEFAULT_BLOCK_HEIGHT;
 }
 
 AtlasManagerPtr AtlasManager::New()
@@ -66,55 +84,42 @@ AtlasManagerPtr AtlasManager::New()
 
 AtlasManager::~AtlasManager()
 {
+  if ( mProcessorRegistered && Adaptor::IsAvailable() )
+  {
+    Adaptor::Get().UnregisterProcessor( *this );
+  }
 }
 
 Toolkit::AtlasManager::AtlasId AtlasManager::CreateAtlas( const Toolkit::AtlasManager::AtlasSize& size, Pixel::Format pixelformat )
 {
   SizeType width = size.mWidth;
   SizeType height = size.mHeight;
-  SizeType blockWidth = size.mBlockWidth;
-  SizeType blockHeight = size.mBlockHeight;
 
-  // Check to see if the atlas is large enough to hold a single block even ?
-  if ( blockWidth + DOUBLE_PIXEL_PADDING + 1u > width || blockHeight + DOUBLE_PIXEL_PADDING + 1u > height )
+  // Check to see if the atlas is large enough to hold a single pixel image even ?
+  if ( !IsAtlasSizeSufficient( 1u, 1u, size ) )
   {
     DALI_LOG_ERROR("Atlas %i x %i too small. Dimensions need to be at least %ix%i\n",
-                    width, height, blockWidth + DOUBLE_PIXEL_PADDING + 1u, blockHeight + DOUBLE_PIXEL_PADDING + 1u );
+                    width, height, DOUBLE_PIXEL_PADDING + FILLED_PIXEL + 1u, DOUBLE_PIXEL_PADDING + FILLED_PIXEL + 1u );
     return 0;
   }
 
-  Dali::Texture atlas = Dali::Texture::New( TextureType::TEXTURE_2D, pixelformat, width, height );
-
-  // Clear the background
-  unsigned int bufferSize(  width * height * Dali::Pixel::GetBytesPerPixel( pixelformat ) );
-  unsigned char* background = new unsigned char[bufferSize];
-  memset( background, 0, bufferSize );
-  PixelData backgroundPixels = PixelData::New( background, bufferSize, width, height, pixelformat, PixelData::DELETE_ARRAY );
-  atlas.Upload( backgroundPixels, 0u, 0u, 0u, 0u, width, height );
-
   AtlasDescriptor atlasDescriptor;
-  atlasDescriptor.mAtlas = atlas;
+  atlasDescriptor.mAtlas = Dali::Texture::New( TextureType::TEXTURE_2D, pixelformat, width, height );
   atlasDescriptor.mSize = size;
   atlasDescriptor.mPixelFormat = pixelformat;
-  atlasDescriptor.mTotalBlocks = ( ( width - 1u ) / blockWidth ) * ( ( height - 1u ) / blockHeight );
-  atlasDescriptor.mAvailableBlocks = atlasDescriptor.mTotalBlocks;
-
-  bufferSize = blockWidth * SINGLE_PIXEL_PADDING * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferHorizontalStrip = new unsigned char[bufferSize];
-  memset( bufferHorizontalStrip, 0, bufferSize );
-  atlasDescriptor.mHorizontalStrip = PixelData::New( bufferHorizontalStrip, bufferSize, blockWidth, SINGLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
-
-  bufferSize = SINGLE_PIXEL_PADDING * (blockHeight - DOUBLE_PIXEL_PADDING) * Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* bufferVerticalStrip = new unsigned char[bufferSize];
-  memset( bufferVerticalStrip, 0, bufferSize );
-  atlasDescriptor.mVerticalStrip = PixelData::New( bufferVerticalStrip, bufferSize, SINGLE_PIXEL_PADDING, blockHeight - DOUBLE_PIXEL_PADDING, pixelformat, PixelData::DELETE_ARRAY );
-
-  bufferSize = Dali::Pixel::GetBytesPerPixel(pixelformat);
-  unsigned char* buffer = new unsigned char[bufferSize];
-  memset( buffer, 0xFF, bufferSize );
-  PixelData filledPixelImage = PixelData::New( buffer, bufferSize, 1u, 1u, pixelformat, PixelData::DELETE_ARRAY );
-  atlas.Upload( filledPixelImage, 0u, 0u, 0u, 0u, 1u, 1u );
-  mAtlasList.push_back( atlasDescriptor );
+  atlasDescriptor.mPacker.reset( new AtlasPacker( width - FILLED_PIXEL, height - FILLED_PIXEL ) );
+  atlasDescriptor.mImageCount = 0u;
+
+  // Clear the background, and fill the pixel in the top left corner
+  const uint32_t bytesPerPixel = Dali::Pixel::GetBytesPerPixel( pixelformat );
+  atlasDescriptor.mPixels.Resize( width * height * bytesPerPixel, 0u );
+  memset( atlasDescriptor.mPixels.Begin(), 0xFF, bytesPerPixel );
+
+  // The whole atlas is uploaded with the first images added to it
+  atlasDescriptor.mDirtyRect = Rect< SizeType >( 0u, 0u, width, height );
+
+  mAtlasList.push_back( std::move( atlasDescriptor ) );
+  ScheduleUpload();
   return mAtlasList.size();
 }
 
@@ -123,7 +128,7 @@ void AtlasManager::SetAddPolicy( Toolkit::AtlasManager::AddFailPolicy policy )
   mAddFailPolicy = policy;
 }
 
-bool AtlasManager::Add( const PixelData& image,
+bool AtlasManager::Add( const Devel::PixelBuffer& image,
                         Toolkit::AtlasManager::AtlasSlot& slot,
                         Toolkit::AtlasManager::AtlasId atlas )
 {
@@ -140,13 +145,13 @@ bool AtlasManager::Add( const PixelData& image,
   // If there is a preferred atlas then check for room in that first
   if ( atlas-- )
   {
-    foundAtlas = CheckAtlas( atlas, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( atlas, width, height, pixelFormat, desc );
   }
 
-  // Search current atlases to see if there is a good match
+  // Search current atlases to see if there is room for the image
   while( ( 0u == foundAtlas ) && ( index < mAtlasList.size() ) )
   {
-    foundAtlas = CheckAtlas( index, width, height, pixelFormat );
+    foundAtlas = CheckAtlas( index, width, height, pixelFormat, desc );
     ++index;
   }
 
@@ -155,21 +160,20 @@ bool AtlasManager::Add( const PixelData& image,
   {
     if ( Toolkit::AtlasManager::FAIL_ON_ADD_CREATES == mAddFailPolicy )
     {
-      if ( IsBlockSizeSufficient( width, height, mNewAtlasSize.mBlockWidth, mNewAtlasSize.mBlockHeight ) ) // Checks if image fits within the atlas blocks
+      if ( IsAtlasSizeSufficient( width, height, mNewAtlasSize ) ) // Checks if image fits within an empty atlas
       {
-        foundAtlas = CreateAtlas( mNewAtlasSize, pixelFormat ); // Creating atlas with mNewAtlasSize, may not be the needed size!
+        foundAtlas = CreateAtlas( mNewAtlasSize, pixelFormat );
         if (  0u == foundAtlas )
         {
-          DALI_LOG_ERROR("Failed to create an atlas of %i x %i blocksize: %i x %i.\n",
+          DALI_LOG_ERROR("Failed to create an atlas of %i x %i.\n",
                          mNewAtlasSize.mWidth,
-                         mNewAtlasSize.mHeight,
-                         mNewAtlasSize.mBlockWidth,
-                         mNewAtlasSize.mBlockHeight );
+                         mNewAtlasSize.mHeight );
           return false;
         }
         else
         {
           created = true;
+          foundAtlas = CheckAtlas( foundAtlas - 1u, width, height, pixelFormat, desc );
         }
       }
     }
@@ -182,44 +186,24 @@ bool AtlasManager::Add( const PixelData& image,
     }
   }
 
-  foundAtlas--; // Atlas created successfully, decrement by 1 to get <vector> index (starts at 0 not 1)
-
-  // Work out which the block we're going to use
-  // Is there currently a next free block available ?
-  if ( mAtlasList[ foundAtlas ].mAvailableBlocks )
-  {
-    // Yes, so select our next block
-    desc.mBlock = mAtlasList[ foundAtlas ].mTotalBlocks - mAtlasList[ foundAtlas ].mAvailableBlocks--;
-  }
-  else
-  {
-    // Our next block must be from the free list, fetch from the start of the list
-    desc.mBlock = mAtlasList[ foundAtlas ].mFreeBlocksList[ 0 ];
-    mAtlasList[ foundAtlas ].mFreeBlocksList.Remove( mAtlasList[ foundAtlas ].mFreeBlocksList.Begin() );
-  }
+  foundAtlas--; // Image packed successfully, decrement by 1 to get <vector> index (starts at 0 not 1)
 
   desc.mImageWidth = width;
   desc.mImageHeight = height;
   desc.mAtlasId = foundAtlas + 1u;  // Ids start from 1 not the 0 index
   desc.mCount = 1u;
+  ++mAtlasList[ foundAtlas ].mImageCount;
 
   // See if there's a previously freed image ID that we can assign to this new image
-  uint32_t imageId = 0u;
-  for ( uint32_t i = 0u; i < mImageList.Size(); ++i )
-  {
-    if ( !mImageList[ i ].mCount )
-    {
-      imageId = i + 1u;
-      break;
-    }
-  }
-  if ( !imageId )
+  if ( mFreeImageIds.Empty() )
   {
     mImageList.PushBack( desc );
     slot.mImageId = mImageList.Size();
   }
   else
   {
+    const ImageId imageId = mFreeImageIds[ mFreeImageIds.Count() - 1u ];
+    mFreeImageIds.Resize( mFreeImageIds.Count() - 1u );
     mImageList[ imageId - 1u ] = desc;
     slot.mImageId = imageId;
   }
@@ -233,16 +217,17 @@ bool AtlasManager::Add( const PixelData& image,
 AtlasManager::SizeType AtlasManager::CheckAtlas( SizeType atlas,
                                                  SizeType width,
                                                  SizeType height,
-                                                 Pixel::Format pixelFormat )
+                                                 Pixel::Format pixelFormat,
+                                                 AtlasSlotDescriptor& desc )
 {
   AtlasManager::SizeType result = 0u;
   if ( pixelFormat == mAtlasList[ atlas ].mPixelFormat )
   {
-    // Check to see if the image will fit in these blocks
-
-    const SizeType availableBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
-
-    if ( availableBlocks && IsBlockSizeSufficient( width, height,mAtlasList[ atlas ].mSize.mBlockWidth, mAtlasList[ atlas ].mSize.mBlockHeight ) )
+    // Check to see if the image and its padding will fit in the free space of the atlas
+    if ( mAtlasList[ atlas ].mPacker->Pack( width + DOUBLE_PIXEL_PADDING,
+                                            height + DOUBLE_PIXEL_PADDING,
+                                            desc.mPackPositionX,
+                                            desc.mPackPositionY ) )
     {
       result = atlas + 1u; // Atlas ids start from 1 not 0
     }
@@ -250,87 +235,117 @@ AtlasManager::SizeType AtlasManager::CheckAtlas( SizeType atlas,
   return result;
 }
 
-void AtlasManager::UploadImage( const PixelData& image,
+void AtlasManager::UploadImage( const Devel::PixelBuffer& image,
                                 const AtlasSlotDescriptor& desc )
 {
   // Get the atlas to upload the image to
   SizeType atlas = desc.mAtlasId - 1u;
+  AtlasDescriptor& atlasDescriptor = mAtlasList[ atlas ];
 
   // Check to see that the pixel formats are compatible
-  if ( image.GetPixelFormat() != mAtlasList[ atlas ].mPixelFormat )
+  if ( image.GetPixelFormat() != atlasDescriptor.mPixelFormat )
   {
     DALI_LOG_ERROR("Cannot upload an image with a different PixelFormat to the Atlas.\n");
     return;
   }
 
-  SizeType atlasBlockWidth = mAtlasList[ atlas ].mSize.mBlockWidth;
-  SizeType atlasBlockHeight = mAtlasList[ atlas ].mSize.mBlockHeight;
-  SizeType atlasWidthInBlocks = ( mAtlasList[ atlas ].mSize.mWidth - 1u ) / mAtlasList[ atlas ].mSize.mBlockWidth;
-
-  SizeType blockX = desc.mBlock % atlasWidthInBlocks;
-  SizeType blockY = desc.mBlock / atlasWidthInBlocks;
-  SizeType blockOffsetX = ( blockX * atlasBlockWidth ) + 1u;
-  SizeType blockOffsetY = ( blockY * atlasBlockHeight) + 1u;
+  SizeType blockOffsetX = desc.mPackPositionX + FILLED_PIXEL;
+  SizeType blockOffsetY = desc.mPackPositionY + FILLED_PIXEL;
 
   SizeType width = image.GetWidth();
   SizeType height = image.GetHeight();
 
-  // Blit image 1 pixel to the right and down into the block to compensate for texture filtering
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( image, 0u, 0u,
-                                           blockOffsetX + SINGLE_PIXEL_PADDING,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           width, height) )
+  const SizeType bytesPerPixel = Dali::Pixel::GetBytesPerPixel( atlasDescriptor.mPixelFormat );
+  const SizeType atlasStride = atlasDescriptor.mSize.mWidth * bytesPerPixel;
+  const SizeType paddedRowSize = ( width + DOUBLE_PIXEL_PADDING ) * bytesPerPixel;
+  const SizeType rowSize = width * bytesPerPixel;
+
+  unsigned char* destination = atlasDescriptor.mPixels.Begin() + blockOffsetY * atlasStride + blockOffsetX * bytesPerPixel;
+  const unsigned char* source = image.GetBuffer();
+
+  // Clear the top strip, as the space may have held another image before
+  memset( destination, 0, paddedRowSize );
+  destination += atlasStride;
+
+  // Copy the image 1 pixel to the right and down into the block to compensate for texture filtering, clearing the left and right strips
+  for ( SizeType y = 0u; y < height; ++y )
   {
-    DALI_LOG_ERROR("Uploading image to Atlas Failed!.\n");
+    memset( destination, 0, bytesPerPixel );
+    memcpy( destination + bytesPerPixel, source, rowSize );
+    memset( destination + bytesPerPixel + rowSize, 0, bytesPerPixel );
+    destination += atlasStride;
+    source += rowSize;
   }
 
-  // Blit top strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY,
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mHorizontalStrip.GetHeight()) )
+  // Clear the bottom strip
+  memset( destination, 0, paddedRowSize );
+
+  MergeRect( atlasDescriptor.mDirtyRect, blockOffsetX, blockOffsetY, width + DOUBLE_PIXEL_PADDING, height + DOUBLE_PIXEL_PADDING );
+  ScheduleUpload();
+}
+
+void AtlasManager::ScheduleUpload()
+{
+  if ( !mProcessorRegistered )
   {
-    DALI_LOG_ERROR("Uploading top strip to Atlas Failed!\n");
+    if ( Adaptor::IsAvailable() )
+    {
+      // Upload the images added until then together, if not uploaded by UploadAtlases() before
+      Adaptor::Get().RegisterProcessor( *this );
+      mProcessorRegistered = true;
+    }
+    else
+    {
+      UploadAtlases();
+    }
   }
+}
 
-  // Blit left strip
-  if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                           blockOffsetX,
-                                           blockOffsetY + SINGLE_PIXEL_PADDING,
-                                           mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                           mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
+void AtlasManager::UploadAtlases()
+{
+  if ( mProcessorRegistered )
   {
-    DALI_LOG_ERROR("Uploading left strip to Atlas Failed!\n");
+    Adaptor::Get().UnregisterProcessor( *this );
+    mProcessorRegistered = false;
   }
 
-  // Blit bottom strip
-  if ( blockOffsetY + height + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mHeight )
+  for ( auto&& atlasDescriptor : mAtlasList )
   {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mHorizontalStrip, 0u, 0u,
-                                             blockOffsetX,
-                                             blockOffsetY + height + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mHorizontalStrip.GetHeight() ) )
+    Rect< SizeType >& dirtyRect = atlasDescriptor.mDirtyRect;
+    if ( dirtyRect.IsEmpty() )
     {
-      DALI_LOG_ERROR("Uploading bottom strip to Atlas Failed!.\n");
+      continue;
     }
-  }
 
-  // Blit right strip
-  if ( blockOffsetX + width + DOUBLE_PIXEL_PADDING <= mAtlasList[ atlas ].mSize.mWidth )
-  {
-    if ( !mAtlasList[ atlas ].mAtlas.Upload( mAtlasList[ atlas ].mVerticalStrip, 0u, 0u,
-                                             blockOffsetX + width + SINGLE_PIXEL_PADDING,
-                                             blockOffsetY + SINGLE_PIXEL_PADDING,
-                                             mAtlasList[ atlas ].mVerticalStrip.GetWidth(),
-                                             mAtlasList[ atlas ].mVerticalStrip.GetHeight() ) )
+    // Copy the rows of the changed area into a buffer of its own
+    const SizeType bytesPerPixel = Dali::Pixel::GetBytesPerPixel( atlasDescriptor.mPixelFormat );
+    const SizeType atlasStride = atlasDescriptor.mSize.mWidth * bytesPerPixel;
+    const SizeType rowSize = dirtyRect.width * bytesPerPixel;
+    const SizeType bufferSize = rowSize * dirtyRect.height;
+
+    unsigned char* buffer = new unsigned char[bufferSize];
+    const unsigned char* source = atlasDescriptor.mPixels.Begin() + dirtyRect.y * atlasStride + dirtyRect.x * bytesPerPixel;
+    for ( SizeType y = 0u; y < dirtyRect.height; ++y )
+    {
+      memcpy( buffer + y * rowSize, source, rowSize );
+      source += atlasStride;
+    }
+
+    PixelData pixelData = PixelData::New( buffer, bufferSize, dirtyRect.width, dirtyRect.height, atlasDescriptor.mPixelFormat, PixelData::DELETE_ARRAY );
+    if ( !atlasDescriptor.mAtlas.Upload( pixelData, 0u, 0u, dirtyRect.x, dirtyRect.y, dirtyRect.width, dirtyRect.height ) )
     {
-      DALI_LOG_ERROR("Uploading right strip to Atlas Failed!.\n");
+      DALI_LOG_ERROR("Uploading images to Atlas Failed!\n");
     }
+
+    dirtyRect = Rect< SizeType >();
   }
 }
 
+void AtlasManager::Process()
+{
+  UploadAtlases();
+}
+
 void AtlasManager::GenerateMeshData( ImageId id,
                                      const Vector2& position,
                                      Toolkit::AtlasManager::Mesh2D& meshData,
@@ -344,9 +359,14 @@ void AtlasManager::GenerateMeshData( ImageId id,
     SizeType width = mImageList[ imageId ].mImageWidth;
     SizeType height = mImageList[ imageId ].mImageHeight;
 
+    // The image is inside its padding, which is after the filled pixel
+    SizeType imageX = mImageList[ imageId ].mPackPositionX + FILLED_PIXEL + SINGLE_PIXEL_PADDING;
+    SizeType imageY = mImageList[ imageId ].mPackPositionY + FILLED_PIXEL + SINGLE_PIXEL_PADDING;
+
     AtlasMeshFactory::CreateQuad( width,
                                   height,
-                                  mImageList[ imageId ].mBlock,
+                                  imageX,
+                                  imageY,
                                   mAtlasList[ atlas ].mSize,
                                   position,
                                   meshData );
@@ -376,12 +396,12 @@ Dali::Texture AtlasManager::GetAtlasContainer( AtlasId atlas ) const
 
 bool AtlasManager::Remove( ImageId id )
 {
-  // Decrements the reference count of this image, and removes the blocks if zero.
+  // Decrements the reference count of this image, and frees its space in the atlas if zero.
   SizeType imageId = id - 1u;
   bool removed = false;
 
-  if ( id > mImageList.Size() )
-     {
+  if ( !id || id > mImageList.Size() )
+  {
     DALI_LOG_ERROR("Atlas was asked to free an invalid imageID: %i\n", id );
     return false;
   }
@@ -395,11 +415,18 @@ bool AtlasManager::Remove( ImageId id )
 
   if ( 2u > --mImageList[ imageId ].mCount )
   {
-    // 'Remove the blocks' from this image and add to the atlas' freelist
+    // Return the space of this image and its padding to the atlas' packer, which merges it with any free neighbours
     removed = true;
+    const AtlasSlotDescriptor& desc = mImageList[ imageId ];
+    AtlasDescriptor& atlasDescriptor = mAtlasList[ desc.mAtlasId - 1u ];
+    atlasDescriptor.mPacker->DeleteBlock( desc.mPackPositionX,
+                                          desc.mPackPositionY,
+                                          desc.mImageWidth + DOUBLE_PIXEL_PADDING,
+                                          desc.mImageHeight + DOUBLE_PIXEL_PADDING );
+    --atlasDescriptor.mImageCount;
+
     mImageList[ imageId ].mCount = 0;
-    SizeType atlas = mImageList[ imageId ].mAtlasId - 1u;
-    mAtlasList[ atlas ].mFreeBlocksList.PushBack( mImageList[ imageId ].mBlock );
+    mFreeImageIds.PushBack( id );
   }
   return removed;
 }
@@ -418,10 +445,6 @@ AtlasManager::AtlasId AtlasManager::GetAtlas( ImageId id ) const
 void AtlasManager::SetNewAtlasSize( const Toolkit::AtlasManager::AtlasSize& size )
 {
   mNewAtlasSize = size;
-
-  // Add on padding for borders around atlas entries
-  mNewAtlasSize.mBlockWidth += DOUBLE_PIXEL_PADDING;
-  mNewAtlasSize.mBlockHeight += DOUBLE_PIXEL_PADDING;
 }
 
 const Toolkit::AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atlas )
@@ -434,15 +457,15 @@ const Toolkit::AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atla
   return EMPTY_SIZE;
 }
 
-AtlasManager::SizeType AtlasManager::GetFreeBlocks( AtlasId atlas ) const
+AtlasManager::SizeType AtlasManager::GetFreeArea( AtlasId atlas ) const
 {
   DALI_ASSERT_DEBUG( atlas && atlas <= mAtlasList.size() );
-  AtlasManager::SizeType freeBlocks = 0u;
+  AtlasManager::SizeType freeArea = 0u;
   if ( atlas && atlas-- <= mAtlasList.size() )
   {
-    freeBlocks = mAtlasList[ atlas ].mAvailableBlocks + mAtlasList[ atlas ].mFreeBlocksList.Size();
+    freeArea = mAtlasList[ atlas ].mPacker->GetAvailableArea();
   }
-  return freeBlocks;
+  return freeArea;
 }
 
 AtlasManager::SizeType AtlasManager::GetAtlasCount() const
@@ -472,8 +495,9 @@ void AtlasManager::GetMetrics( Toolkit::AtlasManager::Metrics& metrics )
   for ( uint32_t i = 0; i < atlasCount; ++i )
   {
     entry.mSize = mAtlasList[ i ].mSize;
-    entry.mTotalBlocks = mAtlasList[ i ].mTotalBlocks;
-    entry.mBlocksUsed = entry.mTotalBlocks - mAtlasList[ i ].mAvailableBlocks + mAtlasList[ i ].mFreeBlocksList.Size();
+    entry.mImageCount = mAtlasList[ i ].mImageCount;
+    entry.mTotalArea = ( entry.mSize.mWidth - FILLED_PIXEL ) * ( entry.mSize.mHeight - FILLED_PIXEL );
+    entry.mAreaUsed = entry.mTotalArea - mAtlasList[ i ].mPacker->GetAvailableArea();
     entry.mPixelFormat = GetPixelFormat( i + 1 );
 
     metrics.mAtlasMetrics.PushBack( entry );
@@ -19,10 +19,15 @@
 
 
 // EXTERNAL INCLUDES
+#include <memory>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/public-api/object/base-object.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/image-loader/atlas-packer.h>
 #include <dali-toolkit/internal/text/rendering/atlas/atlas-manager.h>
 
 namespace Dali
@@ -46,7 +51,14 @@ typedef Dali::Vector< Toolkit::AtlasManager::AtlasSlot > slotContainer;
 class AtlasManager;
 typedef IntrusivePtr<AtlasManager> AtlasManagerPtr;
 
-class AtlasManager : public Dali::BaseObject
+/**
+ * Packs images into atlas textures.
+ *
+ * The images are written to a copy of each atlas in memory, and the area they change is uploaded
+ * once per atlas by UploadAtlases(), rather than with an upload per image. Images added outside
+ * of a text render are uploaded at the next event processing.
+ */
+class AtlasManager : public Dali::BaseObject, public Integration::Processor
 {
 public:
 
@@ -62,12 +74,11 @@ public:
     Dali::Texture mAtlas;                                                 // atlas image
     Toolkit::AtlasManager::AtlasSize mSize;                             // size of atlas
     Pixel::Format mPixelFormat;                                         // pixel format used by atlas
-    PixelData mHorizontalStrip;                                       // Image used to pad upload
-    PixelData mVerticalStrip;                                         // Image used to pad upload
     TextureSet mTextureSet;                                             // Texture set used for atlas texture
-    SizeType mTotalBlocks;                                              // total number of blocks in atlas
-    SizeType mAvailableBlocks;                                          // number of blocks available in atlas
-    Dali::Vector< SizeType > mFreeBlocksList;                           // unless there are any previously freed blocks
+    std::unique_ptr< AtlasPacker > mPacker;                             // Packs the padded images into the atlas, less the filled pixel row and column
+    SizeType mImageCount;                                               // number of images stored in atlas
+    Dali::Vector< unsigned char > mPixels;                              // Copy of the atlas in memory, which the images are written to
+    Rect< SizeType > mDirtyRect;                                        // Area of mPixels changed since the last upload, empty if none
   };
 
   struct AtlasSlotDescriptor
@@ -76,7 +87,8 @@ public:
     SizeType mImageWidth;                                               // Width of image stored
     SizeType mImageHeight;                                              // Height of image stored
     AtlasId mAtlasId;                                                   // Image is stored in this Atlas
-    SizeType mBlock;                                                    // Block within atlas used for image
+    SizeType mPackPositionX;                                            // X position of the padded image given by the atlas' packer
+    SizeType mPackPositionY;                                            // Y position of the padded image given by the atlas' packer
   };
 
   AtlasManager();
@@ -101,7 +113,7 @@ public:
   /**
    * @copydoc Toolkit::AtlasManager::Add
    */
-  bool Add( const PixelData& image,
+  bool Add( const Devel::PixelBuffer& image,
             Toolkit::AtlasManager::AtlasSlot& slot,
             Toolkit::AtlasManager::AtlasId atlas );
 
@@ -139,14 +151,9 @@ public:
   const Toolkit::AtlasManager::AtlasSize& GetAtlasSize( AtlasId atlas );
 
   /**
-   * @copydoc Toolkit::AtlasManager::GetBlockSize
-   */
-  Vector2 GetBlockSize( AtlasId atlas );
-
-  /**
-   * @copydoc Toolkit::AtlasManager::GetFreeBlocks
+   * @copydoc Toolkit::AtlasManager::GetFreeArea
    */
-  SizeType GetFreeBlocks( AtlasId atlas ) const;
+  SizeType GetFreeArea( AtlasId atlas ) const;
 
   /*
    * @copydoc Toolkit::AtlasManager::GetAtlasCount
@@ -173,21 +180,58 @@ public:
    */
   void SetTextures( AtlasId atlas, TextureSet& textureSet );
 
+  /**
+   * @copydoc Toolkit::AtlasManager::UploadAtlases
+   */
+  void UploadAtlases();
+
+protected: // Implementation of Processor
+
+  /**
+   * @copydoc Dali::Integration::Processor::Process()
+   */
+  void Process() override;
+
 private:
 
   std::vector< AtlasDescriptor > mAtlasList;            // List of atlases created
   Vector< AtlasSlotDescriptor > mImageList;             // List of bitmaps stored in atlases
+  Vector< ImageId > mFreeImageIds;                      // Ids of the removed bitmaps, to be reused by the next adds
   Toolkit::AtlasManager::AtlasSize mNewAtlasSize;       // Atlas size to use in next creation
   Toolkit::AtlasManager::AddFailPolicy mAddFailPolicy;  // Policy for failing to add an Image
+  bool mProcessorRegistered;                            // Whether the atlases are waiting to be uploaded
 
+  /**
+   * Packs the padded image into the atlas if it has room, and its pixel format matches.
+   *
+   * @param[in] atlas Index of the atlas
+   * @param[in] width Width of the image
+   * @param[in] height Height of the image
+   * @param[in] pixelFormat Pixel format of the image
+   * @param[out] desc Receives the pack position of the image
+   * @return The atlas id, or zero if the image was not packed
+   */
   SizeType CheckAtlas( SizeType atlas,
                        SizeType width,
                        SizeType height,
-                       Pixel::Format pixelFormat );
+                       Pixel::Format pixelFormat,
+                       AtlasSlotDescriptor& desc );
 
-  void UploadImage( const PixelData& image,
+  /**
+   * Writes the image and its padding to the copy of the atlas, to be uploaded later.
+   *
+   * @param[in] image The image
+   * @param[in] desc The slot of the image
+   */
+  void UploadImage( const Devel::PixelBuffer& image,
                     const AtlasSlotDescriptor& desc );
 
+  /**
+   * Uploads the atlases at the next event processing, unless UploadAtlases() is called first,
+   * or straight away if there is no adaptor.
+   */
+  void ScheduleUpload();
+
 };
 
 } // namespace Internal
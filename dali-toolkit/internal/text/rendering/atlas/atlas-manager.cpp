@@ -55,7 +55,7 @@ void AtlasManager::SetAddPolicy( AddFailPolicy policy )
   GetImplementation(*this).SetAddPolicy( policy );
 }
 
-bool AtlasManager::Add( const PixelData& image,
+bool AtlasManager::Add( const Devel::PixelBuffer& image,
                         AtlasManager::AtlasSlot& slot,
                         AtlasManager::AtlasId atlas )
 {
@@ -93,9 +93,9 @@ const AtlasManager::AtlasSize& AtlasManager::GetAtlasSize( AtlasId atlas )
   return GetImplementation(*this).GetAtlasSize( atlas );
 }
 
-AtlasManager::SizeType AtlasManager::GetFreeBlocks( AtlasId atlas )
+AtlasManager::SizeType AtlasManager::GetFreeArea( AtlasId atlas )
 {
-  return GetImplementation(*this).GetFreeBlocks( atlas );
+  return GetImplementation(*this).GetFreeArea( atlas );
 }
 
 void AtlasManager::SetNewAtlasSize( const AtlasSize& size )
@@ -128,6 +128,11 @@ void AtlasManager::SetTextures( AtlasId atlas, TextureSet& textureSet )
   GetImplementation(*this).SetTextures( atlas, textureSet );
 }
 
+void AtlasManager::UploadAtlases()
+{
+  GetImplementation(*this).UploadAtlases();
+}
+
 } // namespace Toolkit
 
 } // namespace Dali
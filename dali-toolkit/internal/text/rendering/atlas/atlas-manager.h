@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <stdint.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/rendering/texture-set.h>
 
@@ -47,8 +48,6 @@ public:
   {
     SizeType mWidth;              ///< width of the atlas in pixels
     SizeType mHeight;             ///< height of the atlas in pixels
-    SizeType mBlockWidth;         ///< width of a block in pixels
-    SizeType mBlockHeight;        ///< height of a block in pixels
   };
 
   /**
@@ -57,9 +56,10 @@ public:
    */
   struct AtlasMetricsEntry
   {
-    AtlasSize mSize;                 ///< size of atlas and blocks
-    SizeType mBlocksUsed;            ///< number of blocks used in the atlas
-    SizeType mTotalBlocks;           ///< total blocks used by atlas
+    AtlasSize mSize;                 ///< size of atlas
+    SizeType mImageCount;            ///< number of images stored in the atlas
+    SizeType mAreaUsed;              ///< pixel area used by the images and their padding
+    SizeType mTotalArea;             ///< total pixel area available to images in the atlas
     Pixel::Format mPixelFormat;      ///< pixel format of the atlas
   };
 
@@ -132,7 +132,9 @@ public:
   typedef Dali::Vector< AtlasManager::AtlasSlot > slotContainer;
 
   /**
-   * @brief Create a blank atlas of specific dimensions and pixel format with a certain block size
+   * @brief Create a blank atlas of specific dimensions and pixel format
+   *
+   * @details Images of any size that fits are packed into the atlas, each with a single pixel border.
    *
    * @param[in] size desired atlas dimensions
    * @param[in] pixelformat format of a pixel in atlas
@@ -155,13 +157,15 @@ public:
    *          If an add is made before an atlas is created under this policy,
    *          then a default size atlas will be created
    *
-   * @param[in] image PixelData object containing the image data
+   * @param[in] image PixelBuffer object containing the image data
    * @param[out] slot result of add operation
    * @param[in] atlas optional preferred atlas
    *
    * @return true if a new atlas was created
+   *
+   * @note The image is uploaded to the atlas texture by UploadAtlases(), or at the next event processing.
    */
-  bool Add( const PixelData& image,
+  bool Add( const Devel::PixelBuffer& image,
             AtlasSlot& slot,
             AtlasId atlas = 0 );
 
@@ -214,20 +218,20 @@ public:
   const AtlasSize& GetAtlasSize( AtlasId atlas );
 
   /**
-   * @brief Get the number of blocks available in an atlas
+   * @brief Get the pixel area available in an atlas
+   *
+   * @details The area may be fragmented, so an image of this area is not guaranteed to fit.
    *
    * @param[in] atlas AtlasId
    *
-   * @return Number of blocks free in this atlas
+   * @return Number of pixels free in this atlas
    */
-  SizeType GetFreeBlocks( AtlasId atlas );
+  SizeType GetFreeArea( AtlasId atlas );
 
   /**
-   * @brief Sets the pixel area of any new atlas and also the individual block size
+   * @brief Sets the pixel area of any new atlas
    *
    * @param[in] size Atlas size structure
-   *
-   * @param blockSize pixel area in atlas for a block
    */
   void SetNewAtlasSize( const AtlasSize& size );
 
@@ -271,6 +275,11 @@ public:
    */
   void SetTextures( AtlasId atlas, TextureSet& textureSet );
 
+  /**
+   * @brief Uploads the area of each atlas changed by the images added since the last upload
+   */
+  void UploadAtlases();
+
 private:
 
   explicit DALI_INTERNAL AtlasManager(Internal::AtlasManager *impl);
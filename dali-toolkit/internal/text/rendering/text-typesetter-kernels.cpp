@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/rendering/text-typesetter-kernels.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#endif
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+namespace
+{
+
+/**
+ * @brief Blends a single premultiplied RGBA8888 pixel under another one.
+ */
+inline void BlendPixelUnder( uint8_t* destination, const uint8_t* source )
+{
+  const uint32_t inverseAlpha = 255u - destination[3];
+  destination[0] = destination[0] + ( source[0] * inverseAlpha / 255u );
+  destination[1] = destination[1] + ( source[1] * inverseAlpha / 255u );
+  destination[2] = destination[2] + ( source[2] * inverseAlpha / 255u );
+  destination[3] = destination[3] + ( source[3] * inverseAlpha / 255u );
+}
+
+/**
+ * @brief Writes the given color, premultiplied with the highest of the glyph's and the pixel's alpha.
+ */
+inline void TintPixel( uint8_t* destination, uint8_t alpha, const Vector4& color )
+{
+  // Copy non-transparent pixels only
+  if( alpha > 0u )
+  {
+    const uint8_t currentAlpha = std::max( destination[3], alpha );
+    destination[0] = static_cast<uint8_t>( color.r * currentAlpha );
+    destination[1] = static_cast<uint8_t>( color.g * currentAlpha );
+    destination[2] = static_cast<uint8_t>( color.b * currentAlpha );
+    destination[3] = static_cast<uint8_t>( color.a * currentAlpha );
+  }
+}
+
+/**
+ * @brief Writes a single pixel of a color glyph.
+ */
+inline void CompositeColorGlyphPixel( uint8_t* destination, const uint8_t* glyph, const Vector4& color, bool isShadow, bool swapChannelsBR, bool isColorBitmap )
+{
+  const uint8_t colorAlpha = static_cast<uint8_t>( color.a * static_cast<float>( glyph[3] ) );
+
+  if( isShadow )
+  {
+    // The shadow of color glyph needs to have the shadow color.
+    destination[0] = static_cast<uint8_t>( color.r * colorAlpha );
+    destination[1] = static_cast<uint8_t>( color.g * colorAlpha );
+    destination[2] = static_cast<uint8_t>( color.b * colorAlpha );
+  }
+  else
+  {
+    const uint32_t redIndex = swapChannelsBR ? 2u : 0u;
+    const uint32_t blueIndex = 2u - redIndex;
+
+    uint8_t red = static_cast<uint8_t>( glyph[redIndex] * colorAlpha / 255u );
+    uint8_t green = static_cast<uint8_t>( glyph[1] * colorAlpha / 255u );
+    uint8_t blue = static_cast<uint8_t>( glyph[blueIndex] * colorAlpha / 255u );
+
+    if( isColorBitmap )
+    {
+      red = static_cast<uint8_t>( red * color.r );
+      green = static_cast<uint8_t>( green * color.g );
+      blue = static_cast<uint8_t>( blue * color.b );
+    }
+
+    destination[0] = red;
+    destination[1] = green;
+    destination[2] = blue;
+  }
+
+  destination[3] = colorAlpha;
+}
+
+#if defined( __SSE2__ )
+
+/**
+ * @brief Multiplies the alpha of each of four pixels by a color and truncates the result to bytes.
+ *
+ * @param[in] alpha Four alpha values as floats.
+ * @param[in] color The factors for the R, G, B and A channels.
+ * @return The four RGBA8888 pixels.
+ */
+inline __m128i ScalePixels( __m128 alpha, __m128 color )
+{
+  const __m128i pixel0 = _mm_cvttps_epi32( _mm_mul_ps( _mm_shuffle_ps( alpha, alpha, _MM_SHUFFLE( 0, 0, 0, 0 ) ), color ) );
+  const __m128i pixel1 = _mm_cvttps_epi32( _mm_mul_ps( _mm_shuffle_ps( alpha, alpha, _MM_SHUFFLE( 1, 1, 1, 1 ) ), color ) );
+  const __m128i pixel2 = _mm_cvttps_epi32( _mm_mul_ps( _mm_shuffle_ps( alpha, alpha, _MM_SHUFFLE( 2, 2, 2, 2 ) ), color ) );
+  const __m128i pixel3 = _mm_cvttps_epi32( _mm_mul_ps( _mm_shuffle_ps( alpha, alpha, _MM_SHUFFLE( 3, 3, 3, 3 ) ), color ) );
+
+  return _mm_packus_epi16( _mm_packs_epi32( pixel0, pixel1 ), _mm_packs_epi32( pixel2, pixel3 ) );
+}
+
+/**
+ * @brief Divides eight 16 bit values by 255 exactly, computed as ( t + ( t >> 8 ) ) >> 8, with t = x + 1.
+ */
+inline __m128i Divide255( __m128i value )
+{
+  value = _mm_add_epi16( value, _mm_set1_epi16( 1 ) );
+  return _mm_srli_epi16( _mm_add_epi16( value, _mm_srli_epi16( value, 8 ) ), 8 );
+}
+
+/**
+ * @brief Multiplies the channels of two pixels, unpacked to 16 bits per channel, by a color and truncates the result.
+ */
+inline __m128i ScaleChannels( __m128i pixels, __m128 color )
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( pixels, zero ) ), color ) );
+  const __m128i high = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( pixels, zero ) ), color ) );
+  return _mm_packs_epi32( low, high );
+}
+
+/**
+ * @brief Blends two premultiplied RGBA8888 pixels over two others, unpacked to 16 bits per channel.
+ *
+ * The division by 255 is computed exactly as ( t + ( t >> 8 ) ) >> 8, with t = x + 1.
+ */
+inline __m128i BlendOver16( __m128i top, __m128i bottom )
+{
+  const __m128i one = _mm_set1_epi16( 1 );
+  const __m128i full = _mm_set1_epi16( 255 );
+
+  __m128i alpha = _mm_shufflelo_epi16( top, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+  alpha = _mm_shufflehi_epi16( alpha, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+
+  __m128i value = _mm_add_epi16( _mm_mullo_epi16( bottom, _mm_sub_epi16( full, alpha ) ), one );
+  value = _mm_srli_epi16( _mm_add_epi16( value, _mm_srli_epi16( value, 8 ) ), 8 );
+
+  // Keep the low byte so the result wraps exactly as the scalar path does.
+  return _mm_and_si128( _mm_add_epi16( top, value ), full );
+}
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+/**
+ * @brief Converts eight bytes to floats.
+ */
+inline void ToFloat( uint8x8_t value, float32x4_t& low, float32x4_t& high )
+{
+  const uint16x8_t value16 = vmovl_u8( value );
+  low = vcvtq_f32_u32( vmovl_u16( vget_low_u16( value16 ) ) );
+  high = vcvtq_f32_u32( vmovl_u16( vget_high_u16( value16 ) ) );
+}
+
+/**
+ * @brief Multiplies eight floats by a factor and truncates the result to bytes.
+ */
+inline uint8x8_t ScaleToByte( float32x4_t low, float32x4_t high, float factor )
+{
+  const uint16x4_t scaledLow = vmovn_u32( vcvtq_u32_f32( vmulq_n_f32( low, factor ) ) );
+  const uint16x4_t scaledHigh = vmovn_u32( vcvtq_u32_f32( vmulq_n_f32( high, factor ) ) );
+  return vmovn_u16( vcombine_u16( scaledLow, scaledHigh ) );
+}
+
+/**
+ * @brief Multiplies eight bytes by eight factors and divides by 255 exactly, computed as ( t + ( t >> 8 ) ) >> 8, with t = x + 1.
+ */
+inline uint8x8_t MultiplyDivide255( uint8x8_t value, uint8x8_t factor )
+{
+  const uint16x8_t product = vaddq_u16( vmull_u8( value, factor ), vdupq_n_u16( 1u ) );
+  return vshrn_n_u16( vaddq_u16( product, vshrq_n_u16( product, 8 ) ), 8 );
+}
+
+#endif
+
+} // namespace
+
+void BlendUnder( uint8_t* destination, const uint8_t* source, uint32_t numberOfPixels )
+{
+  uint32_t pixelIndex = 0u;
+
+#if defined( __SSE2__ )
+
+  const __m128i zero = _mm_setzero_si128();
+  for( ; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u )
+  {
+    const __m128i bottom = _mm_loadu_si128( reinterpret_cast<const __m128i*>( source + 4u * pixelIndex ) );
+    if( 0xFFFF == _mm_movemask_epi8( _mm_cmpeq_epi8( bottom, zero ) ) )
+    {
+      // Fully transparent source pixels leave the destination unchanged.
+      continue;
+    }
+
+    __m128i* destinationPixels = reinterpret_cast<__m128i*>( destination + 4u * pixelIndex );
+    const __m128i top = _mm_loadu_si128( destinationPixels );
+
+    const __m128i low = BlendOver16( _mm_unpacklo_epi8( top, zero ), _mm_unpacklo_epi8( bottom, zero ) );
+    const __m128i high = BlendOver16( _mm_unpackhi_epi8( top, zero ), _mm_unpackhi_epi8( bottom, zero ) );
+
+    _mm_storeu_si128( destinationPixels, _mm_packus_epi16( low, high ) );
+  }
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+  const uint16x8_t one = vdupq_n_u16( 1u );
+  for( ; pixelIndex + 8u <= numberOfPixels; pixelIndex += 8u )
+  {
+    uint8x8x4_t top = vld4_u8( destination + 4u * pixelIndex );
+    const uint8x8x4_t bottom = vld4_u8( source + 4u * pixelIndex );
+
+    const uint8x8_t inverseAlpha = vmvn_u8( top.val[3] );
+    for( uint32_t channel = 0u; channel < 4u; ++channel )
+    {
+      // The division by 255 is computed exactly as ( t + ( t >> 8 ) ) >> 8, with t = x + 1.
+      const uint16x8_t value = vaddq_u16( vmull_u8( bottom.val[channel], inverseAlpha ), one );
+      top.val[channel] = vadd_u8( top.val[channel], vshrn_n_u16( vaddq_u16( value, vshrq_n_u16( value, 8 ) ), 8 ) );
+    }
+
+    vst4_u8( destination + 4u * pixelIndex, top );
+  }
+
+#endif
+
+  // Blend the remaining pixels (or all of them if there is no SIMD support).
+  for( ; pixelIndex < numberOfPixels; ++pixelIndex )
+  {
+    BlendPixelUnder( destination + 4u * pixelIndex, source + 4u * pixelIndex );
+  }
+}
+
+void TintGlyphRow( uint8_t* destination, const uint8_t* glyphAlpha, uint32_t glyphPixelSize, const Vector4& color, uint32_t numberOfPixels )
+{
+  uint32_t pixelIndex = 0u;
+
+  if( 1u == glyphPixelSize )
+  {
+#if defined( __SSE2__ )
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 colorFactors = _mm_setr_ps( color.r, color.g, color.b, color.a );
+    for( ; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u )
+    {
+      uint32_t packedAlpha;
+      memcpy( &packedAlpha, glyphAlpha + pixelIndex, sizeof( uint32_t ) );
+      if( 0u == packedAlpha )
+      {
+        continue;
+      }
+
+      const __m128i alpha = _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( packedAlpha ), zero ), zero );
+
+      __m128i* destinationPixels = reinterpret_cast<__m128i*>( destination + 4u * pixelIndex );
+      const __m128i currentPixels = _mm_loadu_si128( destinationPixels );
+      const __m128i currentAlpha = _mm_max_epi16( alpha, _mm_srli_epi32( currentPixels, 24 ) );
+      const __m128i tintedPixels = ScalePixels( _mm_cvtepi32_ps( currentAlpha ), colorFactors );
+
+      // Keep the pixels the glyph doesn't cover.
+      const __m128i transparent = _mm_cmpeq_epi32( alpha, zero );
+      _mm_storeu_si128( destinationPixels, _mm_or_si128( _mm_and_si128( transparent, currentPixels ), _mm_andnot_si128( transparent, tintedPixels ) ) );
+    }
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+    const float colorFactors[4] = { color.r, color.g, color.b, color.a };
+    for( ; pixelIndex + 8u <= numberOfPixels; pixelIndex += 8u )
+    {
+      const uint8x8_t alpha = vld1_u8( glyphAlpha + pixelIndex );
+      if( 0u == vget_lane_u64( vreinterpret_u64_u8( alpha ), 0 ) )
+      {
+        continue;
+      }
+
+      uint8x8x4_t currentPixels = vld4_u8( destination + 4u * pixelIndex );
+
+      float32x4_t currentAlphaLow;
+      float32x4_t currentAlphaHigh;
+      ToFloat( vmax_u8( alpha, currentPixels.val[3] ), currentAlphaLow, currentAlphaHigh );
+
+      // Keep the pixels the glyph doesn't cover.
+      const uint8x8_t transparent = vceq_u8( alpha, vdup_n_u8( 0u ) );
+      for( uint32_t channel = 0u; channel < 4u; ++channel )
+      {
+        currentPixels.val[channel] = vbsl_u8( transparent, currentPixels.val[channel], ScaleToByte( currentAlphaLow, currentAlphaHigh, colorFactors[channel] ) );
+      }
+
+      vst4_u8( destination + 4u * pixelIndex, currentPixels );
+    }
+
+#endif
+  }
+
+  for( ; pixelIndex < numberOfPixels; ++pixelIndex )
+  {
+    TintPixel( destination + 4u * pixelIndex, glyphAlpha[glyphPixelSize * pixelIndex], color );
+  }
+}
+
+void CompositeColorGlyphRow( uint8_t* destination, const uint8_t* glyph, const Vector4& color, bool isShadow, bool swapChannelsBR, bool isColorBitmap, uint32_t numberOfPixels )
+{
+  uint32_t pixelIndex = 0u;
+
+#if defined( __SSE2__ )
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alphaChannels = _mm_set_epi16( -1, 0, 0, 0, -1, 0, 0, 0 );
+  const __m128 colorAlphaFactor = _mm_set1_ps( color.a );
+  const __m128 colorFactors = _mm_setr_ps( color.r, color.g, color.b, 1.f );
+  for( ; pixelIndex + 4u <= numberOfPixels; pixelIndex += 4u )
+  {
+    const __m128i glyphPixels = _mm_loadu_si128( reinterpret_cast<const __m128i*>( glyph + 4u * pixelIndex ) );
+    const __m128i colorAlpha = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( glyphPixels, 24 ) ), colorAlphaFactor ) );
+
+    __m128i pixels;
+    if( isShadow )
+    {
+      // The alpha is multiplied by one, so it stays unchanged.
+      pixels = ScalePixels( _mm_cvtepi32_ps( colorAlpha ), colorFactors );
+    }
+    else
+    {
+      __m128i low = _mm_unpacklo_epi8( glyphPixels, zero );
+      __m128i high = _mm_unpackhi_epi8( glyphPixels, zero );
+      if( swapChannelsBR )
+      {
+        low = _mm_shufflehi_epi16( _mm_shufflelo_epi16( low, _MM_SHUFFLE( 3, 0, 1, 2 ) ), _MM_SHUFFLE( 3, 0, 1, 2 ) );
+        high = _mm_shufflehi_epi16( _mm_shufflelo_epi16( high, _MM_SHUFFLE( 3, 0, 1, 2 ) ), _MM_SHUFFLE( 3, 0, 1, 2 ) );
+      }
+
+      // Spread the alpha of each pixel over its four channels.
+      const __m128i colorAlpha16 = _mm_packs_epi32( colorAlpha, colorAlpha );
+      const __m128i colorAlphaPairs = _mm_unpacklo_epi16( colorAlpha16, colorAlpha16 );
+      const __m128i colorAlphaLow = _mm_unpacklo_epi32( colorAlphaPairs, colorAlphaPairs );
+      const __m128i colorAlphaHigh = _mm_unpackhi_epi32( colorAlphaPairs, colorAlphaPairs );
+
+      low = Divide255( _mm_mullo_epi16( low, colorAlphaLow ) );
+      high = Divide255( _mm_mullo_epi16( high, colorAlphaHigh ) );
+
+      if( isColorBitmap )
+      {
+        low = ScaleChannels( low, colorFactors );
+        high = ScaleChannels( high, colorFactors );
+      }
+
+      low = _mm_or_si128( _mm_andnot_si128( alphaChannels, low ), _mm_and_si128( alphaChannels, colorAlphaLow ) );
+      high = _mm_or_si128( _mm_andnot_si128( alphaChannels, high ), _mm_and_si128( alphaChannels, colorAlphaHigh ) );
+      pixels = _mm_packus_epi16( low, high );
+    }
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( destination + 4u * pixelIndex ), pixels );
+  }
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+  const float colorFactors[3] = { color.r, color.g, color.b };
+  for( ; pixelIndex + 8u <= numberOfPixels; pixelIndex += 8u )
+  {
+    uint8x8x4_t pixels = vld4_u8( glyph + 4u * pixelIndex );
+
+    float32x4_t low;
+    float32x4_t high;
+    ToFloat( pixels.val[3], low, high );
+    const uint8x8_t colorAlpha = ScaleToByte( low, high, color.a );
+
+    if( isShadow )
+    {
+      ToFloat( colorAlpha, low, high );
+      for( uint32_t channel = 0u; channel < 3u; ++channel )
+      {
+        pixels.val[channel] = ScaleToByte( low, high, colorFactors[channel] );
+      }
+    }
+    else
+    {
+      if( swapChannelsBR )
+      {
+        std::swap( pixels.val[0], pixels.val[2] );
+      }
+
+      for( uint32_t channel = 0u; channel < 3u; ++channel )
+      {
+        pixels.val[channel] = MultiplyDivide255( pixels.val[channel], colorAlpha );
+        if( isColorBitmap )
+        {
+          ToFloat( pixels.val[channel], low, high );
+          pixels.val[channel] = ScaleToByte( low, high, colorFactors[channel] );
+        }
+      }
+    }
+
+    pixels.val[3] = colorAlpha;
+    vst4_u8( destination + 4u * pixelIndex, pixels );
+  }
+
+#endif
+
+  for( ; pixelIndex < numberOfPixels; ++pixelIndex )
+  {
+    CompositeColorGlyphPixel( destination + 4u * pixelIndex, glyph + 4u * pixelIndex, color, isShadow, swapChannelsBR, isColorBitmap );
+  }
+}
+
+void MaxBlendGlyphRow( uint8_t* destination, const uint8_t* glyphAlpha, uint32_t glyphPixelSize, uint32_t numberOfPixels )
+{
+  uint32_t pixelIndex = 0u;
+
+  if( 1u == glyphPixelSize )
+  {
+#if defined( __SSE2__ )
+
+    for( ; pixelIndex + 16u <= numberOfPixels; pixelIndex += 16u )
+    {
+      __m128i* destinationPixels = reinterpret_cast<__m128i*>( destination + pixelIndex );
+      const __m128i alpha = _mm_loadu_si128( reinterpret_cast<const __m128i*>( glyphAlpha + pixelIndex ) );
+      _mm_storeu_si128( destinationPixels, _mm_max_epu8( _mm_loadu_si128( destinationPixels ), alpha ) );
+    }
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+    for( ; pixelIndex + 16u <= numberOfPixels; pixelIndex += 16u )
+    {
+      vst1q_u8( destination + pixelIndex, vmaxq_u8( vld1q_u8( destination + pixelIndex ), vld1q_u8( glyphAlpha + pixelIndex ) ) );
+    }
+
+#endif
+  }
+
+  for( ; pixelIndex < numberOfPixels; ++pixelIndex )
+  {
+    // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
+    // overwrite a previous bigger alpha with a smaller alpha.
+    destination[pixelIndex] = std::max( destination[pixelIndex], glyphAlpha[glyphPixelSize * pixelIndex] );
+  }
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,92 @@
+#ifndef DALI_TOOLKIT_TEXT_TYPESETTER_KERNELS_H
+#define DALI_TOOLKIT_TEXT_TYPESETTER_KERNELS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <dali/public-api/math/vector4.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+/**
+ * @brief Blends a premultiplied RGBA8888 buffer under another one, in place.
+ *
+ * For each channel: destination = destination + source * ( 255 - destinationAlpha ) / 255.
+ * Uses SSE2 or NEON when the target supports them, and a scalar loop otherwise.
+ * All paths produce identical results. The same applies to the glyph row functions below.
+ *
+ * @param[in,out] destination The top layer, which receives the result.
+ * @param[in] source The bottom layer.
+ * @param[in] numberOfPixels The number of pixels in both buffers.
+ */
+void BlendUnder( uint8_t* destination, const uint8_t* source, uint32_t numberOfPixels );
+
+/**
+ * @brief Writes a row of a glyph's coverage into a premultiplied RGBA8888 row, tinted with the given color.
+ *
+ * Where glyphs overlap, the highest alpha is kept. Pixels with no coverage leave the destination unchanged.
+ *
+ * @param[in,out] destination The first pixel of the row in the image buffer.
+ * @param[in] glyphAlpha The alpha value of the first pixel of the glyph's row.
+ * @param[in] glyphPixelSize The number of bytes between consecutive alpha values of the glyph.
+ * @param[in] color The color of the glyph.
+ * @param[in] numberOfPixels The number of pixels in the row.
+ */
+void TintGlyphRow( uint8_t* destination, const uint8_t* glyphAlpha, uint32_t glyphPixelSize, const Vector4& color, uint32_t numberOfPixels );
+
+/**
+ * @brief Writes a row of a color glyph into a premultiplied RGBA8888 row.
+ *
+ * The glyph's alpha is multiplied by the color's alpha. A shadow is filled with the color,
+ * otherwise the glyph's channels are premultiplied and, for color bitmaps, tinted with the color.
+ *
+ * @param[out] destination The first pixel of the row in the image buffer.
+ * @param[in] glyph The first pixel of the glyph's row. The format is RGBA8888 or BGRA8888.
+ * @param[in] color The color of the glyph or of the shadow.
+ * @param[in] isShadow Whether the row is part of the glyph's shadow.
+ * @param[in] swapChannelsBR Whether the glyph's format is BGRA8888.
+ * @param[in] isColorBitmap Whether the glyph is a color bitmap which has to be tinted.
+ * @param[in] numberOfPixels The number of pixels in the row.
+ */
+void CompositeColorGlyphRow( uint8_t* destination, const uint8_t* glyph, const Vector4& color, bool isShadow, bool swapChannelsBR, bool isColorBitmap, uint32_t numberOfPixels );
+
+/**
+ * @brief Writes a row of a glyph's coverage into an L8 row, keeping the highest alpha where glyphs overlap.
+ *
+ * @param[in,out] destination The first pixel of the row in the image buffer.
+ * @param[in] glyphAlpha The alpha value of the first pixel of the glyph's row.
+ * @param[in] glyphPixelSize The number of bytes between consecutive alpha values of the glyph.
+ * @param[in] numberOfPixels The number of pixels in the row.
+ */
+void MaxBlendGlyphRow( uint8_t* destination, const uint8_t* glyphAlpha, uint32_t glyphPixelSize, uint32_t numberOfPixels );
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_TYPESETTER_KERNELS_H
@@ -24,6 +24,7 @@
 #include <dali/public-api/common/constants.h>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/rendering/text-typesetter-kernels.h>
 #include <dali-toolkit/internal/text/rendering/view-model.h>
 #include <dali-toolkit/devel-api/controls/text-controls/text-label-devel.h>
 
@@ -74,187 +75,86 @@ void TypesetGlyph( GlyphData& data,
     return;
   }
 
-  const int widthMinusOne = static_cast<int>( data.width - 1u );
-  const int heightMinusOne = static_cast<int>( data.height - 1u );
+  // Initial vertical and horizontal offsets.
+  const int yOffset = data.verticalOffset + position->y;
+  const int xOffset = data.horizontalOffset + position->x;
 
-  if ( Pixel::RGBA8888 == pixelFormat )
+  // Clip the glyph against the bitmap once, so the rows can be copied without bounds checks.
+  const int firstLine = std::max( 0, -yOffset );
+  const int lastLine = std::min( static_cast<int>( data.glyphBitmap.height ), static_cast<int>( data.height ) - yOffset );
+  const int firstColumn = std::max( 0, -xOffset );
+  const int lastColumn = std::min( static_cast<int>( data.glyphBitmap.width ), static_cast<int>( data.width ) - xOffset );
+
+  if( ( firstLine >= lastLine ) || ( firstColumn >= lastColumn ) )
   {
-    // Whether the given glyph is a color one.
-    const bool isColorGlyph = data.glyphBitmap.isColorEmoji || data.glyphBitmap.isColorBitmap;
-    const uint32_t glyphPixelSize = Pixel::GetBytesPerPixel( data.glyphBitmap.format );
-    const uint32_t alphaIndex = glyphPixelSize - 1u;
-    const bool swapChannelsBR = Pixel::BGRA8888 == data.glyphBitmap.format;
+    // Do not write out of bounds.
+    return;
+  }
 
-    // Pointer to the color glyph if there is one.
-    const uint32_t* const colorGlyphBuffer = isColorGlyph ? reinterpret_cast<uint32_t*>( data.glyphBitmap.buffer ) : NULL;
+  const uint32_t numberOfPixels = static_cast<uint32_t>( lastColumn - firstColumn );
 
-    // Initial vertical offset.
-    const int yOffset = data.verticalOffset + position->y;
+  // Whether the given glyph is a color one.
+  const bool isColorGlyph = data.glyphBitmap.isColorEmoji || data.glyphBitmap.isColorBitmap;
+  const uint32_t glyphPixelSize = Pixel::GetBytesPerPixel( data.glyphBitmap.format );
+  const uint32_t alphaIndex = glyphPixelSize - 1u;
+
+  if ( Pixel::RGBA8888 == pixelFormat )
+  {
+    const bool swapChannelsBR = Pixel::BGRA8888 == data.glyphBitmap.format;
 
-    uint32_t* bitmapBuffer = reinterpret_cast< uint32_t* >( data.bitmapBuffer.GetBuffer() );
+    uint8_t* bitmapBuffer = data.bitmapBuffer.GetBuffer();
 
     // Traverse the pixels of the glyph line per line.
-    for( int lineIndex = 0, glyphHeight = static_cast<int>( data.glyphBitmap.height ); lineIndex < glyphHeight; ++lineIndex )
+    for( int lineIndex = firstLine; lineIndex < lastLine; ++lineIndex )
     {
-      const int yOffsetIndex = yOffset + lineIndex;
-      if( ( 0 > yOffsetIndex ) || ( yOffsetIndex > heightMinusOne ) )
-      {
-        // Do not write out of bounds.
-        continue;
-      }
+      uint8_t* bitmapRow = bitmapBuffer + 4u * ( static_cast<uint32_t>( yOffset + lineIndex ) * data.width + static_cast<uint32_t>( xOffset + firstColumn ) );
+      const uint32_t glyphBufferOffset = static_cast<uint32_t>( lineIndex ) * data.glyphBitmap.width + static_cast<uint32_t>( firstColumn );
 
-      const int verticalOffset = yOffsetIndex * data.width;
-      const int xOffset = data.horizontalOffset + position->x;
-      const int glyphBufferOffset = lineIndex * static_cast<int>( data.glyphBitmap.width );
-      for( int index = 0, glyphWidth = static_cast<int>( data.glyphBitmap.width ); index < glyphWidth; ++index )
+      if( isColorGlyph )
       {
-        const int xOffsetIndex = xOffset + index;
-        if( ( 0 > xOffsetIndex ) || ( xOffsetIndex > widthMinusOne ) )
+        if( Typesetter::STYLE_MASK == style || Typesetter::STYLE_OUTLINE == style ) // Outline not shown for color glyph
         {
-          // Don't write out of bounds.
-          continue;
-        }
-
-        if( isColorGlyph )
-        {
-          // Retrieves the color from the color glyph.
-          uint32_t packedColorGlyph = *( colorGlyphBuffer + glyphBufferOffset + index );
-          uint8_t* packedColorGlyphBuffer = reinterpret_cast<uint8_t*>( &packedColorGlyph );
-
-          // Update the alpha channel.
-          if( Typesetter::STYLE_MASK == style || Typesetter::STYLE_OUTLINE == style ) // Outline not shown for color glyph
-          {
-            // Create an alpha mask for color glyph.
-            *( packedColorGlyphBuffer + 3u ) = 0u;
-            *( packedColorGlyphBuffer + 2u ) = 0u;
-            *( packedColorGlyphBuffer + 1u ) = 0u;
-              *packedColorGlyphBuffer        = 0u;
-          }
-          else
-          {
-            const uint8_t colorAlpha = static_cast<uint8_t>( color->a * static_cast<float>( *( packedColorGlyphBuffer + 3u ) ) );
-            *( packedColorGlyphBuffer + 3u ) = colorAlpha;
-
-            if( Typesetter::STYLE_SHADOW == style )
-            {
-              // The shadow of color glyph needs to have the shadow color.
-              *( packedColorGlyphBuffer + 2u ) = static_cast<uint8_t>( color->b * colorAlpha );
-              *( packedColorGlyphBuffer + 1u ) = static_cast<uint8_t>( color->g * colorAlpha );
-                *packedColorGlyphBuffer        = static_cast<uint8_t>( color->r * colorAlpha );
-            }
-            else
-            {
-              if( swapChannelsBR )
-              {
-                std::swap( *packedColorGlyphBuffer, *( packedColorGlyphBuffer + 2u ) ); // Swap B and R.
-              }
-
-              *( packedColorGlyphBuffer + 2u ) = ( *( packedColorGlyphBuffer + 2u ) * colorAlpha / 255 );
-              *( packedColorGlyphBuffer + 1u ) = ( *( packedColorGlyphBuffer + 1u ) * colorAlpha / 255 );
-                *packedColorGlyphBuffer        = ( *( packedColorGlyphBuffer      ) * colorAlpha / 255 );
-
-              if( data.glyphBitmap.isColorBitmap )
-              {
-                *( packedColorGlyphBuffer + 2u ) = static_cast<uint8_t>( *( packedColorGlyphBuffer + 2u ) * color->b );
-                *( packedColorGlyphBuffer + 1u ) = static_cast<uint8_t>( *( packedColorGlyphBuffer + 1u ) * color->g );
-                  *packedColorGlyphBuffer        = static_cast<uint8_t>(   *packedColorGlyphBuffer * color->r );
-              }
-            }
-          }
-
-          // Set the color into the final pixel buffer.
-          *( bitmapBuffer + verticalOffset + xOffsetIndex ) = packedColorGlyph;
+          // Create an alpha mask for color glyph.
+          memset( bitmapRow, 0, 4u * numberOfPixels );
         }
         else
         {
-          // Pack the given color into a 32bit buffer. The alpha channel will be updated later for each pixel.
-          // The format is RGBA8888.
-          uint32_t packedColor = 0u;
-          uint8_t* packedColorBuffer = reinterpret_cast<uint8_t*>( &packedColor );
-
-          // Update the alpha channel.
-          const uint8_t alpha = *( data.glyphBitmap.buffer + glyphPixelSize * ( glyphBufferOffset + index ) + alphaIndex );
-
-          // Copy non-transparent pixels only
-          if ( alpha > 0u )
-          {
-            // Check alpha of overlapped pixels
-            uint32_t& currentColor = *( bitmapBuffer + verticalOffset + xOffsetIndex );
-            uint8_t* packedCurrentColorBuffer = reinterpret_cast<uint8_t*>( &currentColor );
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            uint8_t currentAlpha = *( packedCurrentColorBuffer + 3u );
-            currentAlpha = std::max( currentAlpha, alpha );
-
-            // Color is pre-muliplied with its alpha.
-            *( packedColorBuffer + 3u ) = static_cast<uint8_t>( color->a * currentAlpha );
-            *( packedColorBuffer + 2u ) = static_cast<uint8_t>( color->b * currentAlpha );
-            *( packedColorBuffer + 1u ) = static_cast<uint8_t>( color->g * currentAlpha );
-            *( packedColorBuffer      ) = static_cast<uint8_t>( color->r * currentAlpha );
-
-            // Set the color into the final pixel buffer.
-            currentColor = packedColor;
-          }
+          CompositeColorGlyphRow( bitmapRow,
+                                  data.glyphBitmap.buffer + 4u * glyphBufferOffset,
+                                  *color,
+                                  Typesetter::STYLE_SHADOW == style,
+                                  swapChannelsBR,
+                                  data.glyphBitmap.isColorBitmap,
+                                  numberOfPixels );
         }
       }
+      else
+      {
+        // Color is pre-muliplied with its alpha. Where glyphs overlap, the bigger alpha is kept
+        // (in order to avoid semi-transparent gaps between joint glyphs with overlapped pixels, which
+        // could happen, for example, in the RTL text when we copy glyphs from right to left).
+        TintGlyphRow( bitmapRow,
+                      data.glyphBitmap.buffer + glyphPixelSize * glyphBufferOffset + alphaIndex,
+                      glyphPixelSize,
+                      *color,
+                      numberOfPixels );
+      }
     }
   }
-  else
+  else if( !isColorGlyph )
   {
-    // Whether the given glyph is a color one.
-    const bool isColorGlyph = data.glyphBitmap.isColorEmoji || data.glyphBitmap.isColorBitmap;
-    const uint32_t glyphPixelSize = Pixel::GetBytesPerPixel( data.glyphBitmap.format );
-    const uint32_t alphaIndex = glyphPixelSize - 1u;
-
-    // Initial vertical offset.
-    const int yOffset = data.verticalOffset + position->y;
-
-    uint8_t* bitmapBuffer = reinterpret_cast< uint8_t* >( data.bitmapBuffer.GetBuffer() );
+    uint8_t* bitmapBuffer = data.bitmapBuffer.GetBuffer();
 
     // Traverse the pixels of the glyph line per line.
-    for( int lineIndex = 0, glyphHeight = static_cast<int>( data.glyphBitmap.height ); lineIndex < glyphHeight; ++lineIndex )
+    for( int lineIndex = firstLine; lineIndex < lastLine; ++lineIndex )
     {
-      const int yOffsetIndex = yOffset + lineIndex;
-      if( ( 0 > yOffsetIndex ) || ( yOffsetIndex > heightMinusOne ) )
-      {
-        // Do not write out of bounds.
-        continue;
-      }
-
-      const int verticalOffset = yOffsetIndex * data.width;
-      const int xOffset = data.horizontalOffset + position->x;
-      const int glyphBufferOffset = lineIndex * static_cast<int>( data.glyphBitmap.width );
-      for( int index = 0, glyphWidth = static_cast<int>( data.glyphBitmap.width ); index < glyphWidth; ++index )
-      {
-        const int xOffsetIndex = xOffset + index;
-        if( ( 0 > xOffsetIndex ) || ( xOffsetIndex > widthMinusOne ) )
-        {
-          // Don't write out of bounds.
-          continue;
-        }
+      uint8_t* bitmapRow = bitmapBuffer + static_cast<uint32_t>( yOffset + lineIndex ) * data.width + static_cast<uint32_t>( xOffset + firstColumn );
+      const uint32_t glyphBufferOffset = static_cast<uint32_t>( lineIndex ) * data.glyphBitmap.width + static_cast<uint32_t>( firstColumn );
 
-        if ( !isColorGlyph )
-        {
-          // Update the alpha channel.
-          const uint8_t alpha = *( data.glyphBitmap.buffer + glyphPixelSize * ( glyphBufferOffset + index ) + alphaIndex );
-
-          // Copy non-transparent pixels only
-          if ( alpha > 0u )
-          {
-            // Check alpha of overlapped pixels
-            uint8_t& currentAlpha = *( bitmapBuffer + verticalOffset + xOffsetIndex );
-
-            // For any pixel overlapped with the pixel in previous glyphs, make sure we don't
-            // overwrite a previous bigger alpha with a smaller alpha (in order to avoid
-            // semi-transparent gaps between joint glyphs with overlapped pixels, which could
-            // happen, for example, in the RTL text when we copy glyphs from right to left).
-            currentAlpha = std::max( currentAlpha, alpha );
-          }
-        }
-      }
+      MaxBlendGlyphRow( bitmapRow,
+                        data.glyphBitmap.buffer + glyphPixelSize * glyphBufferOffset + alphaIndex,
+                        glyphPixelSize,
+                        numberOfPixels );
     }
   }
 }
@@ -513,8 +413,8 @@ PixelData Typesetter::Render( const Vector2& size, Toolkit::DevelText::TextDirec
     }
   }
 
-  // Generate the image buffers of the text for each different style first,
-  // then combine all of them together as one final image buffer. We try to
+  // Generate the image buffers of the text for each different style, front to back,
+  // blending each one under the previous ones as one final image buffer. We try to
   // do all of these in CPU only, so that once the final texture is generated,
   // no calculation is needed in GPU during each frame.
 
@@ -533,72 +433,90 @@ PixelData Typesetter::Render( const Vector2& size, Toolkit::DevelText::TextDirec
     // Generate the image buffer as an alpha mask for color glyphs.
     imageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_MASK, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs - 1 );
   }
-  else if( RENDER_NO_TEXT == behaviour )
+  else if( ( RENDER_NO_STYLES == behaviour ) || ( Pixel::RGBA8888 != pixelFormat ) )
   {
-    // Generate an empty image buffer so that it can been combined with the image buffers for styles
-    imageBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
-    memset( imageBuffer.GetBuffer(), 0u, bufferSizeChar );
+    // Styles are only combined in RGBA images.
+    if( RENDER_NO_TEXT == behaviour )
+    {
+      imageBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
+      memset( imageBuffer.GetBuffer(), 0u, bufferSizeChar );
+    }
+    else
+    {
+      // Generate the image buffer for the text with no style.
+      imageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_NONE, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs -1 );
+    }
   }
   else
   {
-    // Generate the image buffer for the text with no style.
-    imageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_NONE, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs -1 );
-  }
-
-  if ( ( RENDER_NO_STYLES != behaviour ) && ( RENDER_MASK != behaviour ) )
-  {
+    // Collect the enabled layers, from the top one to the bottom one.
+    // @todo. Support shadow and underline for partial text later on.
+    Typesetter::Style layers[5u];
+    unsigned int numberOfLayers = 0u;
 
-    // Generate the outline if enabled
-    const uint16_t outlineWidth = mModel->GetOutlineWidth();
-    if ( outlineWidth != 0u )
+    if( RENDER_NO_TEXT != behaviour )
     {
-      // Create the image buffer for outline
-      Devel::PixelBuffer outlineImageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_OUTLINE, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs -1 );
-
-      // Combine the two buffers
-      imageBuffer = CombineImageBuffer( imageBuffer, outlineImageBuffer, bufferWidth, bufferHeight );
+      layers[numberOfLayers++] = Typesetter::STYLE_NONE;
     }
 
-    // @todo. Support shadow and underline for partial text later on.
+    if( 0u != mModel->GetOutlineWidth() )
+    {
+      layers[numberOfLayers++] = Typesetter::STYLE_OUTLINE;
+    }
 
-    // Generate the shadow if enabled
     const Vector2& shadowOffset = mModel->GetShadowOffset();
-    if ( fabsf( shadowOffset.x ) > Math::MACHINE_EPSILON_1 || fabsf( shadowOffset.y ) > Math::MACHINE_EPSILON_1 )
+    if( fabsf( shadowOffset.x ) > Math::MACHINE_EPSILON_1 || fabsf( shadowOffset.y ) > Math::MACHINE_EPSILON_1 )
     {
-      // Create the image buffer for shadow
-      Devel::PixelBuffer shadowImageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_SHADOW, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs - 1 );
-
-      // Check whether it will be a soft shadow
-      const float& blurRadius = mModel->GetShadowBlurRadius();
-
-      if ( blurRadius > Math::MACHINE_EPSILON_1 )
-      {
-        shadowImageBuffer.ApplyGaussianBlur( blurRadius );
-      }
-
-      // Combine the two buffers
-      imageBuffer = CombineImageBuffer( imageBuffer, shadowImageBuffer, bufferWidth, bufferHeight );
+      layers[numberOfLayers++] = Typesetter::STYLE_SHADOW;
     }
 
-    // Generate the underline if enabled
-    const bool underlineEnabled = mModel->IsUnderlineEnabled();
-    if ( underlineEnabled )
+    if( mModel->IsUnderlineEnabled() )
     {
-      // Create the image buffer for underline
-      Devel::PixelBuffer underlineImageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_UNDERLINE, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs - 1 );
+      layers[numberOfLayers++] = Typesetter::STYLE_UNDERLINE;
+    }
 
-      // Combine the two buffers
-      imageBuffer = CombineImageBuffer( imageBuffer, underlineImageBuffer, bufferWidth, bufferHeight );
+    if( mModel->IsBackgroundEnabled() )
+    {
+      layers[numberOfLayers++] = Typesetter::STYLE_BACKGROUND;
     }
 
-    // Generate the background if enabled
-    const bool backgroundEnabled = mModel->IsBackgroundEnabled();
-    if ( backgroundEnabled )
+    // The top layer is drawn straight into the image buffer. Each of the other layers is drawn
+    // into a single scratch buffer, which is then blended under the image buffer. This is the
+    // order the layers were combined in pairwise before, so the result is the same to the bit.
+    imageBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
+    memset( imageBuffer.GetBuffer(), 0u, bufferSizeChar );
+
+    Devel::PixelBuffer layerBuffer;
+    for( unsigned int layerIndex = 0u; layerIndex < numberOfLayers; ++layerIndex )
     {
-      Devel::PixelBuffer backgroundImageBuffer = CreateImageBuffer( bufferWidth, bufferHeight, Typesetter::STYLE_BACKGROUND, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs -1 );
+      const Typesetter::Style style = layers[layerIndex];
+
+      if( layerIndex > 0u )
+      {
+        if( !layerBuffer )
+        {
+          layerBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
+        }
+        memset( layerBuffer.GetBuffer(), 0u, bufferSizeChar );
+      }
 
-      // Combine the two buffers
-      imageBuffer = CombineImageBuffer( imageBuffer, backgroundImageBuffer, bufferWidth, bufferHeight );
+      Devel::PixelBuffer& targetBuffer = ( layerIndex > 0u ) ? layerBuffer : imageBuffer;
+      DrawImageBuffer( targetBuffer, style, ignoreHorizontalAlignment, pixelFormat, penX, penY, 0u, numberOfGlyphs - 1 );
+
+      // Check whether it will be a soft shadow
+      if( Typesetter::STYLE_SHADOW == style )
+      {
+        const float& blurRadius = mModel->GetShadowBlurRadius();
+        if( blurRadius > Math::MACHINE_EPSILON_1 )
+        {
+          targetBuffer.ApplyGaussianBlur( blurRadius );
+        }
+      }
+
+      if( layerIndex > 0u )
+      {
+        BlendUnder( imageBuffer.GetBuffer(), layerBuffer.GetBuffer(), bufferSizeInt );
+      }
     }
   }
 
@@ -610,6 +528,30 @@ PixelData Typesetter::Render( const Vector2& size, Toolkit::DevelText::TextDirec
 
 Devel::PixelBuffer Typesetter::CreateImageBuffer( const unsigned int bufferWidth, const unsigned int bufferHeight, Typesetter::Style style, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat, int horizontalOffset, int verticalOffset, GlyphIndex fromGlyphIndex, GlyphIndex toGlyphIndex )
 {
+  // Create and initialize the pixel buffer.
+  Devel::PixelBuffer imageBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, pixelFormat );
+
+  if ( Pixel::RGBA8888 == pixelFormat )
+  {
+    const unsigned int bufferSizeInt = bufferWidth * bufferHeight;
+    const unsigned int bufferSizeChar = 4u * bufferSizeInt;
+    memset( imageBuffer.GetBuffer(), 0u, bufferSizeChar );
+  }
+  else
+  {
+    memset( imageBuffer.GetBuffer(), 0, bufferWidth * bufferHeight );
+  }
+
+  DrawImageBuffer( imageBuffer, style, ignoreHorizontalAlignment, pixelFormat, horizontalOffset, verticalOffset, fromGlyphIndex, toGlyphIndex );
+
+  return imageBuffer;
+}
+
+void Typesetter::DrawImageBuffer( Devel::PixelBuffer& imageBuffer, Typesetter::Style style, bool ignoreHorizontalAlignment, Pixel::Format pixelFormat, int horizontalOffset, int verticalOffset, GlyphIndex fromGlyphIndex, GlyphIndex toGlyphIndex )
+{
+  const unsigned int bufferWidth = imageBuffer.GetWidth();
+  const unsigned int bufferHeight = imageBuffer.GetHeight();
+
   // Retrieve lines, glyphs, positions and colors from the view model.
   const Length modelNumberOfLines = mModel->GetNumberOfLines();
   const LineRun* const modelLinesBuffer = mModel->GetLines();
@@ -623,25 +565,13 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer( const unsigned int bufferWidth
   const bool useDefaultColor = ( NULL == colorsBuffer );
   const Vector4& defaultColor = mModel->GetDefaultColor();
 
-  // Create and initialize the pixel buffer.
   GlyphData glyphData;
   glyphData.verticalOffset = verticalOffset;
   glyphData.width = bufferWidth;
   glyphData.height = bufferHeight;
-  glyphData.bitmapBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, pixelFormat );
+  glyphData.bitmapBuffer = imageBuffer;
   glyphData.horizontalOffset = 0;
 
-  if ( Pixel::RGBA8888 == pixelFormat )
-  {
-    const unsigned int bufferSizeInt = bufferWidth * bufferHeight;
-    const unsigned int bufferSizeChar = 4u * bufferSizeInt;
-    memset( glyphData.bitmapBuffer.GetBuffer(), 0u, bufferSizeChar );
-  }
-  else
-  {
-    memset( glyphData.bitmapBuffer.GetBuffer(), 0, bufferWidth * bufferHeight );
-  }
-
   // Get a handle of the font client. Used to retrieve the bitmaps of the glyphs.
   TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
 
@@ -845,70 +775,6 @@ Devel::PixelBuffer Typesetter::CreateImageBuffer( const unsigned int bufferWidth
     // Increases the vertical offset with the line's descender.
     glyphData.verticalOffset += static_cast<int>( -line.descender );
   }
-
-  return glyphData.bitmapBuffer;
-}
-
-Devel::PixelBuffer Typesetter::CombineImageBuffer( Devel::PixelBuffer topPixelBuffer, Devel::PixelBuffer bottomPixelBuffer, const unsigned int bufferWidth, const unsigned int bufferHeight )
-{
-  unsigned char* topBuffer = topPixelBuffer.GetBuffer();
-  unsigned char* bottomBuffer = bottomPixelBuffer.GetBuffer();
-
-  Devel::PixelBuffer combinedPixelBuffer;
-
-  if ( topBuffer == NULL && bottomBuffer == NULL )
-  {
-    // Nothing to do if both buffers are empty.
-    return combinedPixelBuffer;
-  }
-
-  if ( topBuffer == NULL )
-  {
-    // Nothing to do if topBuffer is empty.
-    return bottomPixelBuffer;
-  }
-
-  if ( bottomBuffer == NULL )
-  {
-    // Nothing to do if bottomBuffer is empty.
-    return topPixelBuffer;
-  }
-
-  // Always combine two RGBA images
-  const unsigned int bufferSizeInt = bufferWidth * bufferHeight;
-  const unsigned int bufferSizeChar = 4u * bufferSizeInt;
-
-  combinedPixelBuffer = Devel::PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
-  uint8_t* combinedBuffer = reinterpret_cast< uint8_t* >( combinedPixelBuffer.GetBuffer() );
-  memset( combinedBuffer, 0u, bufferSizeChar );
-
-  for (unsigned int pixelIndex = 0; pixelIndex < bufferSizeInt; pixelIndex++)
-  {
-    // If the alpha of the pixel in either buffer is not fully opaque, blend the two pixels.
-    // Otherwise, copy pixel from topBuffer to combinedBuffer.
-
-    unsigned int alphaBuffer1 = topBuffer[pixelIndex*4+3];
-
-    if ( alphaBuffer1 != 255 )
-    {
-      // At least one pixel is not fully opaque
-      // "Over" blend the the pixel from topBuffer with the pixel in bottomBuffer
-      combinedBuffer[pixelIndex*4] = topBuffer[pixelIndex*4] + ( bottomBuffer[pixelIndex*4] * ( 255 - topBuffer[pixelIndex*4+3] ) / 255 );
-      combinedBuffer[pixelIndex*4+1] = topBuffer[pixelIndex*4+1] + ( bottomBuffer[pixelIndex*4+1] * ( 255 - topBuffer[pixelIndex*4+3] ) / 255 );
-      combinedBuffer[pixelIndex*4+2] = topBuffer[pixelIndex*4+2] + ( bottomBuffer[pixelIndex*4+2] * ( 255 - topBuffer[pixelIndex*4+3] ) / 255 );
-      combinedBuffer[pixelIndex*4+3] = topBuffer[pixelIndex*4+3] + ( bottomBuffer[pixelIndex*4+3] * ( 255 - topBuffer[pixelIndex*4+3] ) / 255 );
-    }
-    else
-    {
-      // Copy the pixel from topBuffer to combinedBuffer
-      combinedBuffer[pixelIndex*4] = topBuffer[pixelIndex*4];
-      combinedBuffer[pixelIndex*4+1] = topBuffer[pixelIndex*4+1];
-      combinedBuffer[pixelIndex*4+2] = topBuffer[pixelIndex*4+2];
-      combinedBuffer[pixelIndex*4+3] = topBuffer[pixelIndex*4+3];
-    }
-  }
-
-  return combinedPixelBuffer;
 }
 
 Typesetter::Typesetter( const ModelInterface* const model )
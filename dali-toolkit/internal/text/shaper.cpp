@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,9 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/shaping.h>
 
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/shaping-cache.h>
+
 namespace Dali
 {
 
@@ -73,6 +76,7 @@ void ShapeText( const Vector<Character>& text,
   // A chunk of consecutive characters must not contain a LINE_MUST_BREAK, if there is one a new chunk has to be created.
 
   TextAbstraction::Shaping shaping = TextAbstraction::Shaping::Get();
+  ShapingCache* const shapingCache = ShapingCache::Get();
 
   // To shape the text a font and an script is needed.
 
@@ -167,24 +171,61 @@ void ShapeText( const Vector<Character>& text,
       }
     }
 
-    // Shape the text for the current chunk.
-    const Length numberOfGlyphs = shaping.Shape( textBuffer + previousIndex,
-                                                 ( currentIndex - previousIndex ), // The number of characters to shape.
-                                                 currentFontId,
-                                                 currentScript );
+    const Length numberOfCharactersToShape = currentIndex - previousIndex;
 
     // Retrieve the glyphs and the glyph to character conversion map.
     Vector<GlyphInfo> tmpGlyphs;
     Vector<CharacterIndex> tmpGlyphToCharacterMap;
 
-    GlyphInfo glyphInfo;
-    glyphInfo.isItalicRequired = isItalicRequired;
-    glyphInfo.isBoldRequired = isBoldRequired;
+    // The same chunks of text are shaped many times, i.e. when a label or a list item is updated.
+    if( ( NULL != shapingCache ) &&
+        shapingCache->Find( textBuffer + previousIndex,
+                            numberOfCharactersToShape,
+                            currentFontId,
+                            currentScript,
+                            tmpGlyphs,
+                            tmpGlyphToCharacterMap ) )
+    {
+      // The software styling is set by the font run, not by the shaper.
+      for( Vector<GlyphInfo>::Iterator it = tmpGlyphs.Begin(),
+             endIt = tmpGlyphs.End();
+           it != endIt;
+           ++it )
+      {
+        GlyphInfo& glyph = *it;
+        glyph.isItalicRequired = isItalicRequired;
+        glyph.isBoldRequired = isBoldRequired;
+      }
+    }
+    else
+    {
+      // Shape the text for the current chunk.
+      const Length numberOfShapedGlyphs = shaping.Shape( textBuffer + previousIndex,
+                                                         numberOfCharactersToShape,
+                                                         currentFontId,
+                                                         currentScript );
+
+      GlyphInfo glyphInfo;
+      glyphInfo.isItalicRequired = isItalicRequired;
+      glyphInfo.isBoldRequired = isBoldRequired;
+
+      tmpGlyphs.Resize( numberOfShapedGlyphs, glyphInfo );
+      tmpGlyphToCharacterMap.Resize( numberOfShapedGlyphs );
+      shaping.GetGlyphs( tmpGlyphs.Begin(),
+                         tmpGlyphToCharacterMap.Begin() );
+
+      if( NULL != shapingCache )
+      {
+        shapingCache->Add( textBuffer + previousIndex,
+                           numberOfCharactersToShape,
+                           currentFontId,
+                           currentScript,
+                           tmpGlyphs,
+                           tmpGlyphToCharacterMap );
+      }
+    }
 
-    tmpGlyphs.Resize( numberOfGlyphs, glyphInfo );
-    tmpGlyphToCharacterMap.Resize( numberOfGlyphs );
-    shaping.GetGlyphs( tmpGlyphs.Begin(),
-                       tmpGlyphToCharacterMap.Begin() );
+    const Length numberOfGlyphs = tmpGlyphs.Count();
 
     // Update the new indices of the glyph to character map.
     if( 0u != totalNumberOfGlyphs )
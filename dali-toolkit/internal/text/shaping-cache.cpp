@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali-toolkit/internal/text/shaping-cache.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <dali/devel-api/common/singleton-service.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+namespace
+{
+
+const Length MAXIMUM_NUMBER_OF_GLYPHS = 16384u;           ///< The number of glyphs held before discarding the least recently used chunks.
+const Length MAXIMUM_NUMBER_OF_CHARACTERS_PER_CHUNK = 128u; ///< Longer chunks are rarely shaped again so they are not kept.
+
+std::size_t Hash( const Character* const text,
+                  Length numberOfCharacters,
+                  FontId fontId,
+                  Script script )
+{
+  // FNV-1a
+  std::size_t hash = 2166136261u;
+
+  hash = ( hash ^ fontId ) * 16777619u;
+  hash = ( hash ^ static_cast<std::size_t>( script ) ) * 16777619u;
+  for( const Character* it = text, * const endIt = text + numberOfCharacters; it != endIt; ++it )
+  {
+    hash = ( hash ^ *it ) * 16777619u;
+  }
+
+  return hash;
+}
+
+} // namespace
+
+ShapingCache* ShapingCache::Get()
+{
+  ShapingCache* cache = NULL;
+
+  SingletonService service( SingletonService::Get() );
+  if( service )
+  {
+    // Check whether the singleton is already created
+    Dali::BaseHandle handle = service.GetSingleton( typeid( ShapingCache ) );
+    if( handle )
+    {
+      cache = dynamic_cast<ShapingCache*>( handle.GetObjectPtr() );
+    }
+    else // create and register the object
+    {
+      cache = new ShapingCache;
+      service.Register( typeid( ShapingCache ), Dali::BaseHandle( cache ) );
+    }
+  }
+
+  return cache;
+}
+
+ShapingCache::ShapingCache()
+: mEntries(),
+  mLookup(),
+  mNumberOfGlyphs( 0u ),
+  mHitCount( 0u ),
+  mMissCount( 0u )
+{
+}
+
+ShapingCache::~ShapingCache()
+{
+}
+
+bool ShapingCache::Find( const Character* const text,
+                         Length numberOfCharacters,
+                         FontId fontId,
+                         Script script,
+                         Vector<GlyphInfo>& glyphs,
+                         Vector<CharacterIndex>& glyphToCharacterMap )
+{
+  if( numberOfCharacters > MAXIMUM_NUMBER_OF_CHARACTERS_PER_CHUNK )
+  {
+    // Not cached. Not counted as a miss either.
+    return false;
+  }
+
+  EntryList::iterator entryIt = FindEntry( text, numberOfCharacters, fontId, script, Hash( text, numberOfCharacters, fontId, script ) );
+  if( entryIt == mEntries.end() )
+  {
+    ++mMissCount;
+    return false;
+  }
+
+  ++mHitCount;
+
+  // Move the chunk to the front as it's the most recently used.
+  mEntries.splice( mEntries.begin(), mEntries, entryIt );
+
+  glyphs = entryIt->glyphs;
+  glyphToCharacterMap = entryIt->glyphToCharacter;
+
+  return true;
+}
+
+void ShapingCache::Add( const Character* const text,
+                        Length numberOfCharacters,
+                        FontId fontId,
+                        Script script,
+                        const Vector<GlyphInfo>& glyphs,
+                        const Vector<CharacterIndex>& glyphToCharacterMap )
+{
+  const Length numberOfGlyphs = glyphs.Count();
+  if( ( numberOfCharacters > MAXIMUM_NUMBER_OF_CHARACTERS_PER_CHUNK ) ||
+      ( numberOfGlyphs > MAXIMUM_NUMBER_OF_GLYPHS ) )
+  {
+    return;
+  }
+
+  const std::size_t hash = Hash( text, numberOfCharacters, fontId, script );
+  if( FindEntry( text, numberOfCharacters, fontId, script, hash ) != mEntries.end() )
+  {
+    // Already cached.
+    return;
+  }
+
+  // Discard the least recently used chunks to make room for the new glyphs.
+  while( mNumberOfGlyphs + numberOfGlyphs > MAXIMUM_NUMBER_OF_GLYPHS )
+  {
+    EntryList::iterator lastIt = --mEntries.end();
+
+    std::pair<EntryLookup::iterator, EntryLookup::iterator> range = mLookup.equal_range( lastIt->hash );
+    for( EntryLookup::iterator it = range.first; it != range.second; ++it )
+    {
+      if( it->second == lastIt )
+      {
+        mLookup.erase( it );
+        break;
+      }
+    }
+
+    mNumberOfGlyphs -= lastIt->glyphs.Count();
+    mEntries.erase( lastIt );
+  }
+
+  mEntries.push_front( Entry() );
+  Entry& entry = mEntries.front();
+  entry.text.Resize( numberOfCharacters );
+  memcpy( entry.text.Begin(), text, numberOfCharacters * sizeof( Character ) );
+  entry.glyphs = glyphs;
+  entry.glyphToCharacter = glyphToCharacterMap;
+  entry.hash = hash;
+  entry.fontId = fontId;
+  entry.script = script;
+
+  mLookup.insert( std::make_pair( hash, mEntries.begin() ) );
+  mNumberOfGlyphs += numberOfGlyphs;
+}
+
+void ShapingCache::Clear()
+{
+  mEntries.clear();
+  mLookup.clear();
+  mNumberOfGlyphs = 0u;
+  mHitCount = 0u;
+  mMissCount = 0u;
+}
+
+ShapingCache::EntryList::iterator ShapingCache::FindEntry( const Character* const text,
+                                                           Length numberOfCharacters,
+                                                           FontId fontId,
+                                                           Script script,
+                                                           std::size_t hash )
+{
+  std::pair<EntryLookup::iterator, EntryLookup::iterator> range = mLookup.equal_range( hash );
+  for( EntryLookup::iterator it = range.first; it != range.second; ++it )
+  {
+    const Entry& entry = *it->second;
+    if( ( entry.fontId == fontId ) &&
+        ( entry.script == script ) &&
+        ( entry.text.Count() == numberOfCharacters ) &&
+        ( 0 == memcmp( entry.text.Begin(), text, numberOfCharacters * sizeof( Character ) ) ) )
+    {
+      return it->second;
+    }
+  }
+
+  return mEntries.end();
+}
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
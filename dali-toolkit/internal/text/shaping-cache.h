@@ -0,0 +1,192 @@
+#ifndef DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
+#define DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <list>
+#include <unordered_map>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/object/base-object.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/text/text-definitions.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Text
+{
+
+/**
+ * @brief Keeps the glyphs of the most recently shaped chunks of text.
+ *
+ * A chunk is shaped with a single font and script, so its glyphs and its glyph to character map
+ * only depend on the font id, the script and the characters. The same strings are shaped again and
+ * again when list items are recycled or labels are updated, so the result is reused instead of calling
+ * the shaper. The least recently used chunks are discarded once the cache holds too many glyphs.
+ *
+ * There is one cache per process, shared by all the text controllers.
+ */
+class ShapingCache : public BaseObject
+{
+public:
+
+  /**
+   * @brief Retrieves the shaping cache.
+   *
+   * @return A pointer to the cache or NULL if there is no singleton service.
+   */
+  static ShapingCache* Get();
+
+  /**
+   * @brief Constructor.
+   */
+  ShapingCache();
+
+  /**
+   * @brief Retrieves the glyphs of a chunk of text shaped before.
+   *
+   * The glyph to character map is relative to the first character of the chunk.
+   *
+   * @param[in] text Pointer to the first character of the chunk.
+   * @param[in] numberOfCharacters The number of characters of the chunk.
+   * @param[in] fontId The font used to shape the chunk.
+   * @param[in] script The script of the chunk.
+   * @param[out] glyphs The glyphs of the chunk.
+   * @param[out] glyphToCharacterMap The glyph to character map of the chunk.
+   *
+   * @return @e true if the chunk is in the cache.
+   */
+  bool Find( const Character* const text,
+             Length numberOfCharacters,
+             FontId fontId,
+             Script script,
+             Vector<GlyphInfo>& glyphs,
+             Vector<CharacterIndex>& glyphToCharacterMap );
+
+  /**
+   * @brief Adds the glyphs of a shaped chunk of text.
+   *
+   * Chunks longer than the cache is meant for are not added.
+   *
+   * @param[in] text Pointer to the first character of the chunk.
+   * @param[in] numberOfCharacters The number of characters of the chunk.
+   * @param[in] fontId The font used to shape the chunk.
+   * @param[in] script The script of the chunk.
+   * @param[in] glyphs The glyphs of the chunk.
+   * @param[in] glyphToCharacterMap The glyph to character map of the chunk, relative to its first character.
+   */
+  void Add( const Character* const text,
+            Length numberOfCharacters,
+            FontId fontId,
+            Script script,
+            const Vector<GlyphInfo>& glyphs,
+            const Vector<CharacterIndex>& glyphToCharacterMap );
+
+  /**
+   * @brief Removes all the chunks and resets the counters.
+   */
+  void Clear();
+
+  /**
+   * @brief Retrieves the number of chunks found in the cache.
+   *
+   * @return The number of hits.
+   */
+  uint32_t GetHitCount() const
+  {
+    return mHitCount;
+  }
+
+  /**
+   * @brief Retrieves the number of chunks not found in the cache.
+   *
+   * @return The number of misses.
+   */
+  uint32_t GetMissCount() const
+  {
+    return mMissCount;
+  }
+
+  /**
+   * @brief Retrieves the number of glyphs held by the cache.
+   *
+   * @return The number of glyphs.
+   */
+  Length GetNumberOfGlyphs() const
+  {
+    return mNumberOfGlyphs;
+  }
+
+protected:
+
+  /**
+   * A reference counted object may only be deleted by calling Unreference()
+   */
+  virtual ~ShapingCache();
+
+private:
+
+  // Undefined copy constructor.
+  ShapingCache( const ShapingCache& );
+
+  // Undefined assignment constructor.
+  ShapingCache& operator=( const ShapingCache& );
+
+  struct Entry
+  {
+    Vector<Character> text;                   ///< The characters of the chunk.
+    Vector<GlyphInfo> glyphs;                 ///< The glyphs of the chunk.
+    Vector<CharacterIndex> glyphToCharacter;  ///< The glyph to character map, relative to the first character.
+    std::size_t hash;                         ///< The hash of the font id, script and characters.
+    FontId fontId;                            ///< The font used to shape the chunk.
+    Script script;                            ///< The script of the chunk.
+  };
+
+  typedef std::list<Entry> EntryList;
+  typedef std::unordered_multimap<std::size_t, EntryList::iterator> EntryLookup;
+
+  /**
+   * @brief Finds the entry of a chunk.
+   *
+   * @return The entry or the end of the list if the chunk is not in the cache.
+   */
+  EntryList::iterator FindEntry( const Character* const text,
+                                 Length numberOfCharacters,
+                                 FontId fontId,
+                                 Script script,
+                                 std::size_t hash );
+
+  EntryList mEntries;        ///< The chunks, most recently used first.
+  EntryLookup mLookup;       ///< The chunks by hash.
+  Length mNumberOfGlyphs;    ///< The number of glyphs of all the chunks.
+  uint32_t mHitCount;        ///< The number of chunks found.
+  uint32_t mMissCount;       ///< The number of chunks not found.
+};
+
+} // namespace Text
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_TEXT_SHAPING_CACHE_H
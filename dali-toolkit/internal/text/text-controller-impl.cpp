@@ -378,6 +378,7 @@ void Controller::Impl::ClearFullModelData( OperationsMask operations )
   if( NO_OPERATION != ( LAYOUT & operations ) )
   {
     mModel->mVisualModel->mLines.Clear();
+    mModel->mVisualModel->mLinesExtents.Clear();
   }
 
   if( NO_OPERATION != ( COLOR & operations ) )
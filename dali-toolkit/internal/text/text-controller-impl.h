@@ -351,6 +351,7 @@ struct Controller::Impl
     mTextFitMinSize( DEFAULT_TEXTFIT_MIN ),
     mTextFitMaxSize( DEFAULT_TEXTFIT_MAX ),
     mTextFitStepSize( DEFAULT_TEXTFIT_STEP ),
+    mTextFitShapingCount( 0u ),
     mTextFitEnabled( false ),
     mFontSizeScale( DEFAULT_FONT_SIZE_SCALE )
   {
@@ -829,6 +830,7 @@ public:
   float mTextFitMinSize;                   ///< Minimum Font Size for text fit. Default 10
   float mTextFitMaxSize;                   ///< Maximum Font Size for text fit. Default 100
   float mTextFitStepSize;                  ///< Step Size for font intervalse. Default 1
+  uint32_t mTextFitShapingCount;           ///< The number of times the last text fit shaped the text.
   bool  mTextFitEnabled : 1;               ///< Whether the text's fit is enabled.
   float mFontSizeScale;                    ///< Scale value for Font Size. Default 1.0
 
@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/text/text-controller-relayouter.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <limits>
 #include <dali/integration-api/debug.h>
 
@@ -41,6 +42,50 @@ float ConvertToEven( float value )
   return static_cast<float>( intValue + ( intValue & 1 ) );
 }
 
+/**
+ * @brief Whether the glyphs shaped at one point size can be scaled to lay out the text at another point size.
+ *
+ * Embedded items and runs with their own font size don't change with the point size set by the text fit.
+ *
+ * @param[in] logicalModel The logical model of the text.
+ * @return @e true if the glyphs can be scaled.
+ */
+bool CanScaleGlyphsForTextFit( const Dali::Toolkit::Text::LogicalModel& logicalModel )
+{
+  if( !logicalModel.mEmbeddedItems.Empty() )
+  {
+    return false;
+  }
+
+  for( Dali::Vector<Dali::Toolkit::Text::FontDescriptionRun>::ConstIterator it = logicalModel.mFontDescriptionRuns.Begin(),
+         endIt = logicalModel.mFontDescriptionRuns.End();
+       it != endIt;
+       ++it )
+  {
+    if( it->sizeDefined )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Fills the point sizes of the text fit, from the minimum one to the maximum one.
+ */
+void GetTextFitPointSizes( float minPointSize, float maxPointSize, float pointInterval, Dali::Vector<float>& pointSizeArray )
+{
+  pointSizeArray.Reserve( static_cast< unsigned int >( ceil( ( maxPointSize - minPointSize ) / pointInterval ) ) );
+
+  for( float i = minPointSize; i < maxPointSize; i += pointInterval )
+  {
+    pointSizeArray.PushBack( i );
+  }
+
+  pointSizeArray.PushBack( maxPointSize );
+}
+
 } // namespace
 
 namespace Dali
@@ -139,6 +184,8 @@ bool Controller::Relayouter::CheckForTextFit(Controller& controller, float point
   Size textSize;
   Controller::Impl& impl = *controller.mImpl;
   TextUpdateInfo& textUpdateInfo = impl.mTextUpdateInfo;
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Controller::CheckForTextFit shaping the text at point size %f\n", pointSize );
+  ++impl.mTextFitShapingCount;
   impl.mFontDefaults->mFitPointSize = pointSize;
   impl.mFontDefaults->sizeDefined = true;
   controller.ClearFontData();
@@ -174,6 +221,54 @@ bool Controller::Relayouter::CheckForTextFit(Controller& controller, float point
   return true;
 }
 
+bool Controller::Relayouter::CheckForScaledTextFit(Controller& controller, const Vector<GlyphInfo>& referenceGlyphs, float scale, const Size& layoutSize)
+{
+  Size textSize;
+  Controller::Impl& impl = *controller.mImpl;
+  TextUpdateInfo& textUpdateInfo = impl.mTextUpdateInfo;
+
+  // Scale the metrics of the glyphs shaped at the reference point size.
+  Vector<GlyphInfo>& glyphs = impl.mModel->mVisualModel->mGlyphs;
+  GlyphInfo* glyphsBuffer = glyphs.Begin();
+  const GlyphInfo* const referenceGlyphsBuffer = referenceGlyphs.Begin();
+  for( Length index = 0u, numberOfGlyphs = glyphs.Count(); index < numberOfGlyphs; ++index )
+  {
+    const GlyphInfo& referenceGlyph = *( referenceGlyphsBuffer + index );
+    GlyphInfo& glyph = *( glyphsBuffer + index );
+
+    glyph.width = referenceGlyph.width * scale;
+    glyph.height = referenceGlyph.height * scale;
+    glyph.xBearing = referenceGlyph.xBearing * scale;
+    glyph.yBearing = referenceGlyph.yBearing * scale;
+    glyph.advance = referenceGlyph.advance * scale;
+  }
+
+  // The line heights are calculated from the font metrics.
+  impl.mMetrics->SetFontMetricsScale( scale );
+
+  // Set the update info to layout the whole text.
+  textUpdateInfo.mParagraphCharacterIndex = 0u;
+  textUpdateInfo.mRequestedNumberOfCharacters = impl.mModel->mLogicalModel->mText.Count();
+
+  impl.mOperationsPending = static_cast<OperationsMask>( impl.mOperationsPending | LAYOUT );
+  DoRelayout( controller,
+              Size( layoutSize.width, MAX_FLOAT ),
+              LAYOUT,
+              textSize );
+
+  impl.mMetrics->SetFontMetricsScale( 1.f );
+
+  // Clear the update info. This info will be set the next time the text is updated.
+  textUpdateInfo.Clear();
+  textUpdateInfo.mClearAll = true;
+
+  if( textSize.width > layoutSize.width || textSize.height > layoutSize.height )
+  {
+    return false;
+  }
+  return true;
+}
+
 void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const Size& layoutSize)
 {
   Controller::Impl& impl = *controller.mImpl;
@@ -189,6 +284,7 @@ void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const
     float pointInterval = impl.mTextFitStepSize;
 
     model->mElideEnabled = false;
+    impl.mTextFitShapingCount = 0u;
     Vector<float> pointSizeArray;
 
     // check zero value
@@ -197,23 +293,46 @@ void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const
       impl.mTextFitStepSize = pointInterval = 1.0f;
     }
 
-    pointSizeArray.Reserve( static_cast< unsigned int >( ceil( ( maxPointSize - minPointSize ) / pointInterval ) ) );
-
-    for( float i = minPointSize; i < maxPointSize; i += pointInterval )
-    {
-      pointSizeArray.PushBack( i );
-    }
-
-    pointSizeArray.PushBack( maxPointSize );
+    GetTextFitPointSizes( minPointSize, maxPointSize, pointInterval, pointSizeArray );
 
     int bestSizeIndex = 0;
     int min = bestSizeIndex + 1;
     int max = pointSizeArray.Size() - 1;
+
+    // Shape the text only once, at the biggest point size, if the glyphs can be scaled to the other point sizes.
+    const bool scaleGlyphs = ( min <= max ) && CanScaleGlyphsForTextFit( *model->mLogicalModel );
+    const float referencePointSize = pointSizeArray[max];
+    Vector<GlyphInfo> referenceGlyphs;
+    if( scaleGlyphs )
+    {
+      if( CheckForTextFit( controller, referencePointSize, layoutSize ) )
+      {
+        // The text fits at the biggest point size. There is no need to search.
+        bestSizeIndex = max;
+        min = max + 1;
+      }
+      else
+      {
+        referenceGlyphs = model->mVisualModel->mGlyphs;
+        max = max - 1;
+      }
+    }
+
     while( min <= max )
     {
       int destI = ( min + max ) / 2;
 
-      if( CheckForTextFit( controller, pointSizeArray[destI], layoutSize ) )
+      bool textFits = false;
+      if( scaleGlyphs )
+      {
+        textFits = CheckForScaledTextFit( controller, referenceGlyphs, pointSizeArray[destI] / referencePointSize, layoutSize );
+      }
+      else
+      {
+        textFits = CheckForTextFit( controller, pointSizeArray[destI], layoutSize );
+      }
+
+      if( textFits )
       {
         bestSizeIndex = min;
         min = destI + 1;
@@ -225,6 +344,15 @@ void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const
       }
     }
 
+    if( scaleGlyphs && !referenceGlyphs.Empty() )
+    {
+      // Hinted fonts don't scale linearly. Check the result with the text shaped at the found point size,
+      // and search around it if needed. The biggest point size is already known not to fit.
+      bestSizeIndex = FindTextFitPointSizeIndex( controller, pointSizeArray, bestSizeIndex, pointSizeArray.Size() - 2, layoutSize );
+    }
+
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "Controller::FitPointSizeforLayout point size %f\n", pointSizeArray[bestSizeIndex] );
+
     model->mElideEnabled = actualellipsis;
     impl.mFontDefaults->mFitPointSize = pointSizeArray[bestSizeIndex];
     impl.mFontDefaults->sizeDefined = true;
@@ -232,6 +360,79 @@ void Controller::Relayouter::FitPointSizeforLayout(Controller& controller, const
   }
 }
 
+int Controller::Relayouter::FindTextFitPointSizeIndex(Controller& controller, const Vector<float>& pointSizeArray, int estimateIndex, int lastIndex, const Size& layoutSize)
+{
+  int bestSizeIndex = 0;
+  int min = 0;
+  int max = estimateIndex - 1;
+
+  if( CheckForTextFit( controller, pointSizeArray[estimateIndex], layoutSize ) )
+  {
+    // The estimate may be too small. Check the next point size, and search the bigger ones only if it fits too.
+    bestSizeIndex = estimateIndex;
+    min = estimateIndex + 1;
+    max = lastIndex;
+
+    if( min <= max )
+    {
+      if( CheckForTextFit( controller, pointSizeArray[min], layoutSize ) )
+      {
+        bestSizeIndex = min;
+        ++min;
+      }
+      else
+      {
+        max = min - 1;
+      }
+    }
+  }
+
+  // Binary search the remaining point sizes, shaping the text at each of them.
+  while( min <= max )
+  {
+    const int destI = ( min + max ) / 2;
+
+    if( CheckForTextFit( controller, pointSizeArray[destI], layoutSize ) )
+    {
+      bestSizeIndex = destI;
+      min = destI + 1;
+    }
+    else
+    {
+      max = destI - 1;
+    }
+  }
+
+  return bestSizeIndex;
+}
+
+float Controller::Relayouter::FindTextFitPointSize(Controller& controller, float estimatePointSize, const Size& layoutSize)
+{
+  Controller::Impl& impl = *controller.mImpl;
+  ModelPtr& model = impl.mModel;
+
+  Vector<float> pointSizeArray;
+  GetTextFitPointSizes( impl.mTextFitMinSize, impl.mTextFitMaxSize, std::max( impl.mTextFitStepSize, 1.f ), pointSizeArray );
+
+  // Start from the biggest point size not bigger than the estimate.
+  const int lastIndex = pointSizeArray.Size() - 1;
+  int estimateIndex = 0;
+  while( ( estimateIndex < lastIndex ) && ( pointSizeArray[estimateIndex + 1] <= estimatePointSize ) )
+  {
+    ++estimateIndex;
+  }
+
+  const bool actualellipsis = model->mElideEnabled;
+  model->mElideEnabled = false;
+  impl.mTextFitShapingCount = 0u;
+
+  const int bestSizeIndex = FindTextFitPointSizeIndex( controller, pointSizeArray, estimateIndex, lastIndex, layoutSize );
+
+  model->mElideEnabled = actualellipsis;
+
+  return pointSizeArray[bestSizeIndex];
+}
+
 float Controller::Relayouter::GetHeightForWidth(Controller& controller, float width)
 {
   DALI_LOG_INFO( gLogFilter, Debug::Verbose, "-->Controller::GetHeightForWidth %p width %f\n", &controller, width );
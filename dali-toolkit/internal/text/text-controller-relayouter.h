@@ -58,6 +58,19 @@ struct Controller::Relayouter
    */
   static bool CheckForTextFit(Controller& controller, float pointSize, const Size& layoutSize);
 
+  /**
+   * @brief Checks if the text fits, laying it out with the metrics of the glyphs shaped at another point size.
+   *
+   * The text is not shaped again. The glyph and font metrics are scaled linearly instead.
+   *
+   * @param[in] controller A reference to the controller class
+   * @param[in] referenceGlyphs The glyphs shaped at the reference point size
+   * @param[in] scale The ratio between the point size to check and the reference point size
+   * @param[in] layoutSize The layout size
+   * @return Whether the text fits in the layout size
+   */
+  static bool CheckForScaledTextFit(Controller& controller, const Vector<GlyphInfo>& referenceGlyphs, float scale, const Size& layoutSize);
+
   /**
    * @brief Calculates the point size for text for given layout()
    *
@@ -66,6 +79,31 @@ struct Controller::Relayouter
    */
   static void FitPointSizeforLayout(Controller& controller, const Size& layoutSize);
 
+  /**
+   * @brief Finds the biggest point size at which the text shaped at that size fits, starting from an estimate.
+   *
+   * The estimate is checked first. If it fits, the next point size is checked, and the bigger ones are only
+   * binary searched if that fits too. Otherwise the smaller point sizes are binary searched.
+   *
+   * @param[in] controller A reference to the controller class
+   * @param[in] pointSizeArray The point sizes of the text fit, in increasing order
+   * @param[in] estimateIndex The index of the estimated point size
+   * @param[in] lastIndex The index of the biggest point size which may fit
+   * @param[in] layoutSize The layout size
+   * @return The index of the point size found, or zero if none fits
+   */
+  static int FindTextFitPointSizeIndex(Controller& controller, const Vector<float>& pointSizeArray, int estimateIndex, int lastIndex, const Size& layoutSize);
+
+  /**
+   * @brief Called by the Controller to find the text fit point size from an estimate.
+   *
+   * @param[in] controller A reference to the controller class
+   * @param[in] estimatePointSize The estimated point size
+   * @param[in] layoutSize The layout size
+   * @return The biggest point size at which the text fits
+   */
+  static float FindTextFitPointSize(Controller& controller, float estimatePointSize, const Size& layoutSize);
+
   /**
    * @brief Called by the Controller to get the height for a particular width.
    *
@@ -527,6 +527,11 @@ Vector2 Controller::GetTextFitContentSize() const
   return mImpl->mTextFitContentSize;
 }
 
+float Controller::GetTextFitPointSize() const
+{
+  return mImpl->mFontDefaults ? mImpl->mFontDefaults->mFitPointSize : 0.0f;
+}
+
 void Controller::SetPlaceholderTextElideEnabled( bool enabled )
 {
   PlaceholderHandler::SetPlaceholderTextElideEnabled(*this, enabled);
@@ -1541,6 +1546,11 @@ bool Controller::CheckForTextFit( float pointSize, Size& layoutSize )
   return Relayouter::CheckForTextFit(*this, pointSize, layoutSize);
 }
 
+float Controller::FindTextFitPointSize( float estimatePointSize, Size layoutSize )
+{
+  return Relayouter::FindTextFitPointSize(*this, estimatePointSize, layoutSize);
+}
+
 void Controller::FitPointSizeforLayout( Size layoutSize )
 {
   Relayouter::FitPointSizeforLayout(*this, layoutSize);
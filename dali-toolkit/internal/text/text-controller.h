@@ -467,6 +467,13 @@ public: // Configure the text controller.
    */
   Vector2 GetTextFitContentSize() const;
 
+  /**
+   * @brief Retrieves the point size found by the last text fit.
+   *
+   * @return The point size the text is laid out at.
+   */
+  float GetTextFitPointSize() const;
+
   /**
    * @brief Enable or disable the placeholder text elide.
    * @param enabled Whether to enable the placeholder text elide.
@@ -1341,6 +1348,17 @@ public: // Queries & retrieves.
    */
   bool CheckForTextFit( float pointSize, Size& layoutSize );
 
+  /**
+   * @brief Finds the biggest text fit point size at which the text fits, starting from an estimate.
+   *
+   * The text is shaped at each point size checked.
+   *
+   * @param[in] estimatePointSize The point size to start the search from.
+   * @param[in] layoutSize The layout size.
+   * @return The point size found.
+   */
+  float FindTextFitPointSize( float estimatePointSize, Size layoutSize );
+
   /**
    * @brief Retrieves the text's number of lines for a given width.
    * @param[in] width The width of the text's area.
@@ -465,6 +465,7 @@ VisualModel::VisualModel()
   mGlyphsPerCharacter(),
   mGlyphPositions(),
   mLines(),
+  mLinesExtents(),
   mTextColor( Color::BLACK ),
   mShadowColor( Color::BLACK ),
   mUnderlineColor( Color::BLACK ),
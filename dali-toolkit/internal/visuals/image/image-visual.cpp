@@ -277,6 +277,12 @@ void ImageVisual::DoSetProperties( const Property::Map& propertyMap )
     auto attemptAtlasing = AttemptAtlasing();
     LoadTexture( attemptAtlasing, mAtlasRect, mTextures, mOrientationCorrection,
                  TextureManager::ReloadPolicy::CACHED  );
+
+    if( !IsOnScene() && ( mTextureId != TextureManager::INVALID_TEXTURE_ID ) )
+    {
+      // Images on the scene are loaded first.
+      mFactoryCache.GetTextureManager().SetLoadPriority( mTextureId, DevelAsyncImageLoader::LoadPriority::LOW );
+    }
   }
 }
 
@@ -647,6 +653,12 @@ void ImageVisual::DoSetOnScene( Actor& actor )
     InitializeRenderer();
   }
 
+  if( mTextureId != TextureManager::INVALID_TEXTURE_ID )
+  {
+    // Load the image before the ones which are not on the scene, if it is still waiting to be loaded.
+    mFactoryCache.GetTextureManager().SetLoadPriority( mTextureId, DevelAsyncImageLoader::LoadPriority::HIGH );
+  }
+
   if( !mImpl->mRenderer )
   {
     return;
@@ -687,6 +699,11 @@ void ImageVisual::DoSetOffScene( Actor& actor )
     RemoveTexture(); // If INVALID_TEXTURE_ID then removal will be attempted on atlas
     mImpl->mResourceStatus = Toolkit::Visual::ResourceStatus::PREPARING;
   }
+  else if( mLoading && ( mTextureId != TextureManager::INVALID_TEXTURE_ID ) )
+  {
+    // The image is kept, but the ones on the scene are loaded first.
+    mFactoryCache.GetTextureManager().SetLoadPriority( mTextureId, DevelAsyncImageLoader::LoadPriority::LOW );
+  }
 
   mLoading = false;
   mImpl->mRenderer.Reset();
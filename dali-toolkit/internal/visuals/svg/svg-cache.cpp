@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "svg-cache.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <tuple>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+bool SvgCache::RasterKey::operator<( const RasterKey& rhs ) const
+{
+  return std::tie( width, height, dpi, url ) < std::tie( rhs.width, rhs.height, rhs.dpi, rhs.url );
+}
+
+bool SvgCache::RasterKey::operator==( const RasterKey& rhs ) const
+{
+  return std::tie( width, height, dpi, url ) == std::tie( rhs.width, rhs.height, rhs.dpi, rhs.url );
+}
+
+SvgCache::SvgCache()
+: mDocuments(),
+  mRasterizations(),
+  mVisualKeys(),
+  mRasterizeThread( NULL )
+{
+}
+
+SvgCache::~SvgCache()
+{
+  SvgRasterizeThread::TerminateThread( mRasterizeThread );
+}
+
+SvgDocumentPtr SvgCache::RequestDocument( const VisualUrl& url, float dpi )
+{
+  DocumentInfo& info = mDocuments[ url.GetUrl() ];
+  if( !info.document )
+  {
+    info.document = new SvgDocument( url, dpi );
+    info.referenceCount = 0u;
+  }
+
+  ++info.referenceCount;
+  return info.document;
+}
+
+void SvgCache::RemoveDocument( const SvgDocumentPtr& document )
+{
+  if( document )
+  {
+    auto it = mDocuments.find( document->GetUrl().GetUrl() );
+    if( ( it != mDocuments.end() ) && ( it->second.document == document ) && ( --it->second.referenceCount == 0u ) )
+    {
+      // A rasterizing task still holds the document until it is processed.
+      mDocuments.erase( it );
+    }
+  }
+}
+
+void SvgCache::RequestLoad( SvgVisual* visual, SvgDocumentPtr document )
+{
+  auto it = mDocuments.find( document->GetUrl().GetUrl() );
+  if( ( it != mDocuments.end() ) && ( it->second.document == document ) )
+  {
+    it->second.loadObservers.push_back( visual );
+
+    // Queued straight away: the processors run before the relayout, so waiting for a size to be given
+    // would mean waiting for the next events. A rasterization requested before it starts cancels it.
+    QueueLoad( document );
+  }
+}
+
+void SvgCache::CancelLoad( SvgVisual* visual, const SvgDocumentPtr& document )
+{
+  if( document )
+  {
+    auto it = mDocuments.find( document->GetUrl().GetUrl() );
+    if( ( it != mDocuments.end() ) && ( it->second.document == document ) )
+    {
+      DocumentInfo& info = it->second;
+      auto observerIt = std::find( info.loadObservers.begin(), info.loadObservers.end(), visual );
+      if( observerIt != info.loadObservers.end() )
+      {
+        info.loadObservers.erase( observerIt );
+        if( info.loadObservers.empty() && info.loadTask )
+        {
+          mRasterizeThread->RemoveTask( info.loadTask.Get() );
+          info.loadTask.Reset();
+        }
+      }
+    }
+  }
+}
+
+void SvgCache::RequestRasterization( SvgVisual* visual, SvgDocumentPtr document, uint32_t width, uint32_t height, bool synchronous )
+{
+  RasterKey key{ document->GetUrl().GetUrl(), width, height, document->GetDpi() };
+
+  auto keyIt = mVisualKeys.find( visual );
+  if( ( keyIt != mVisualKeys.end() ) && ( keyIt->second == key ) )
+  {
+    // Already requested, the visual is applied the rasterization when completed.
+    return;
+  }
+
+  // Hold the new rasterization before releasing the previous one, in case both are the same task.
+  RasterInfo& info = mRasterizations[ key ];
+  if( !info.document )
+  {
+    info.document = document;
+    info.completed = false;
+  }
+  info.visuals.push_back( visual );
+
+  RemoveRasterization( visual );
+  mVisualKeys[ visual ] = key;
+
+  if( info.completed )
+  {
+    visual->ApplyRasterizedImage( info.pixelData, info.pixelData || info.texture );
+  }
+  else if( synchronous )
+  {
+    if( info.task )
+    {
+      // The result of the task is ignored if it is already being processed.
+      GetRasterizeThread()->RemoveTask( info.task.Get() );
+      info.task.Reset();
+    }
+
+    const bool loaded = document->Load();
+    CompleteRasterization( key, info, document->Rasterize( width, height ), loaded );
+    DocumentLoaded( document );
+  }
+  else if( !info.task )
+  {
+    info.task = new RasterizingTask( document, width, height );
+    GetRasterizeThread()->AddTask( info.task );
+
+    // The rasterization loads the document, and applies it to the visuals waiting for it.
+    auto documentIt = mDocuments.find( document->GetUrl().GetUrl() );
+    if( ( documentIt != mDocuments.end() ) && ( documentIt->second.document == document ) && documentIt->second.loadTask )
+    {
+      mRasterizeThread->RemoveTask( documentIt->second.loadTask.Get() );
+      documentIt->second.loadTask.Reset();
+    }
+  }
+}
+
+void SvgCache::RemoveRasterization( SvgVisual* visual )
+{
+  RasterMap::iterator it = FindRasterization( visual );
+  mVisualKeys.erase( visual );
+
+  if( it != mRasterizations.end() )
+  {
+    RasterInfo& info = it->second;
+    info.visuals.erase( std::find( info.visuals.begin(), info.visuals.end(), visual ) );
+
+    if( info.visuals.empty() )
+    {
+      SvgDocumentPtr document = info.document;
+      const bool cancelled = info.task && mRasterizeThread;
+      if( cancelled )
+      {
+        mRasterizeThread->RemoveTask( info.task.Get() );
+      }
+      mRasterizations.erase( it );
+
+      if( cancelled )
+      {
+        // The visuals waiting for the document may have relied on this task to load it.
+        QueueLoad( document );
+      }
+    }
+  }
+}
+
+Texture SvgCache::GetTexture( SvgVisual* visual )
+{
+  RasterMap::iterator it = FindRasterization( visual );
+  if( it == mRasterizations.end() )
+  {
+    return Texture();
+  }
+
+  RasterInfo& info = it->second;
+  if( !info.texture && info.pixelData )
+  {
+    info.texture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888, info.pixelData.GetWidth(), info.pixelData.GetHeight() );
+    info.texture.Upload( info.pixelData );
+
+    // The visuals which requested the rasterization since then use the texture, even if they attempt atlasing.
+    info.pixelData.Reset();
+  }
+
+  return info.texture;
+}
+
+void SvgCache::RasterizationCompleted( RasterizingTaskPtr task )
+{
+  SvgDocumentPtr document = task->GetDocument();
+  DocumentLoaded( document );
+  if( task->IsLoadOnly() )
+  {
+    return;
+  }
+
+  RasterKey key{ document->GetUrl().GetUrl(), task->GetWidth(), task->GetHeight(), document->GetDpi() };
+
+  RasterMap::iterator it = mRasterizations.find( key );
+  if( ( it != mRasterizations.end() ) && ( it->second.task == task ) )
+  {
+    it->second.task.Reset();
+    CompleteRasterization( key, it->second, task->GetPixelData(), task->IsLoaded() );
+  }
+}
+
+uint32_t SvgCache::GetDocumentCount() const
+{
+  return static_cast< uint32_t >( mDocuments.size() );
+}
+
+uint32_t SvgCache::GetRasterizationCount() const
+{
+  return static_cast< uint32_t >( mRasterizations.size() );
+}
+
+SvgRasterizeThread* SvgCache::GetRasterizeThread()
+{
+  if( !mRasterizeThread )
+  {
+    mRasterizeThread = new SvgRasterizeThread( *this );
+  }
+  return mRasterizeThread;
+}
+
+void SvgCache::CompleteRasterization( const RasterKey& key, RasterInfo& info, PixelData pixelData, bool loaded )
+{
+  const bool success = loaded && pixelData;
+  info.completed = true;
+  if( success )
+  {
+    info.pixelData = pixelData;
+  }
+
+  // Applying the rasterization may release it, or any of the visuals waiting for it.
+  std::vector< SvgVisualPtr > visuals( info.visuals.begin(), info.visuals.end() );
+
+  for( auto&& visual : visuals )
+  {
+    auto keyIt = mVisualKeys.find( visual.Get() );
+    if( ( keyIt != mVisualKeys.end() ) && ( keyIt->second == key ) )
+    {
+      visual->ApplyRasterizedImage( pixelData, success );
+    }
+  }
+}
+
+SvgCache::RasterMap::iterator SvgCache::FindRasterization( SvgVisual* visual )
+{
+  auto keyIt = mVisualKeys.find( visual );
+  if( keyIt == mVisualKeys.end() )
+  {
+    return mRasterizations.end();
+  }
+  return mRasterizations.find( keyIt->second );
+}
+
+void SvgCache::DocumentLoaded( const SvgDocumentPtr& document )
+{
+  auto it = mDocuments.find( document->GetUrl().GetUrl() );
+  if( ( it == mDocuments.end() ) || ( it->second.document != document ) )
+  {
+    return;
+  }
+
+  DocumentInfo& info = it->second;
+  if( info.loadTask )
+  {
+    // Not needed anymore if the document was loaded by a rasterization.
+    mRasterizeThread->RemoveTask( info.loadTask.Get() );
+    info.loadTask.Reset();
+  }
+
+  // Applying the document may release it, or any of the visuals waiting for it.
+  std::vector< SvgVisualPtr > visuals( info.loadObservers.begin(), info.loadObservers.end() );
+  info.loadObservers.clear();
+
+  const bool loaded = document->IsLoaded();
+  for( auto&& visual : visuals )
+  {
+    visual->ApplyLoadedDocument( loaded );
+  }
+}
+
+bool SvgCache::IsRasterizationPending( const SvgDocumentPtr& document ) const
+{
+  for( auto&& item : mRasterizations )
+  {
+    if( ( item.second.document == document ) && item.second.task )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SvgCache::QueueLoad( const SvgDocumentPtr& document )
+{
+  auto it = mDocuments.find( document->GetUrl().GetUrl() );
+  if( ( it == mDocuments.end() ) || ( it->second.document != document ) )
+  {
+    return;
+  }
+
+  DocumentInfo& info = it->second;
+  if( !info.loadObservers.empty() && !info.loadTask && !IsRasterizationPending( document ) )
+  {
+    info.loadTask = new RasterizingTask( document );
+    GetRasterizeThread()->AddTask( info.loadTask );
+  }
+}
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
@@ -0,0 +1,231 @@
+#ifndef DALI_TOOLKIT_SVG_CACHE_H
+#define DALI_TOOLKIT_SVG_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/texture.h>
+
+// INTERNAL INCLUDES
+#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/visual-url.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+class SvgVisual;
+
+/**
+ * The svg documents and rasterizations shared by the svg visuals.
+ *
+ * A document is parsed once per URL, for as long as a visual uses it. A rasterization is made once per
+ * URL, size and dpi, for as long as a visual shows it: the visuals requesting it meanwhile wait for the
+ * same rasterizing task and share its pixel data, and the texture uploaded from it. Owned by VisualFactoryCache.
+ *
+ * Documents are parsed in the worker threads. The visuals which need the natural size before they are given a
+ * size request the loading of the document, which is queued straight away unless a rasterization of the document
+ * is pending. A rasterization requested before the loading task starts cancels it, as it loads the document too.
+ */
+class SvgCache
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  SvgCache();
+
+  /**
+   * Destructor, terminates the rasterize thread.
+   */
+  ~SvgCache();
+
+  /**
+   * Request the document of the svg resource, without loading it.
+   *
+   * @param[in] url The URL to svg resource to use.
+   * @param[in] dpi The dpi to parse the svg resource with.
+   * @return The document, to be released with RemoveDocument().
+   */
+  SvgDocumentPtr RequestDocument( const VisualUrl& url, float dpi );
+
+  /**
+   * Release a document requested with RequestDocument().
+   * @param[in] document The document.
+   */
+  void RemoveDocument( const SvgDocumentPtr& document );
+
+  /**
+   * Request the loading of a document for a visual.
+   *
+   * SvgVisual::ApplyLoadedDocument() is called when the document is loaded, by its own task or by a rasterization.
+   * @param[in] visual The visual waiting for the document.
+   * @param[in] document The document to load.
+   */
+  void RequestLoad( SvgVisual* visual, SvgDocumentPtr document );
+
+  /**
+   * Stop waiting for the document requested with RequestLoad(), if not loaded yet.
+   *
+   * The loading task is cancelled if no other visual is waiting for it.
+   * @param[in] visual The visual.
+   * @param[in] document The document.
+   */
+  void CancelLoad( SvgVisual* visual, const SvgDocumentPtr& document );
+
+  /**
+   * Request the rasterization of a document for a visual, releasing the rasterization it previously requested.
+   *
+   * SvgVisual::ApplyRasterizedImage() is called when the rasterization is completed, immediately if it is
+   * cached or synchronous.
+   * @param[in] visual The visual to apply the rasterization to.
+   * @param[in] document The document to rasterize.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @param[in] synchronous Whether to rasterize in the main thread, if the rasterization is not cached.
+   */
+  void RequestRasterization( SvgVisual* visual, SvgDocumentPtr document, uint32_t width, uint32_t height, bool synchronous );
+
+  /**
+   * Release the rasterization requested by a visual, if any.
+   *
+   * The rasterizing task is cancelled if no other visual is waiting for it.
+   * @param[in] visual The visual.
+   */
+  void RemoveRasterization( SvgVisual* visual );
+
+  /**
+   * Get the texture with the completed rasterization requested by a visual, uploading it the first time.
+   * @param[in] visual The visual.
+   * @return The texture, empty if the rasterization is not completed or failed.
+   */
+  Texture GetTexture( SvgVisual* visual );
+
+  /**
+   * Apply a completed rasterizing task to the visuals waiting for it, called by the rasterize thread.
+   * @param[in] task The task.
+   */
+  void RasterizationCompleted( RasterizingTaskPtr task );
+
+  /**
+   * Get the number of cached documents.
+   * @return The number of documents.
+   */
+  uint32_t GetDocumentCount() const;
+
+  /**
+   * Get the number of cached rasterizations, either completed or pending.
+   * @return The number of rasterizations.
+   */
+  uint32_t GetRasterizationCount() const;
+
+private:
+
+  // Undefined
+  SvgCache( const SvgCache& cache );
+
+  // Undefined
+  SvgCache& operator=( const SvgCache& cache );
+
+  struct DocumentInfo
+  {
+    SvgDocumentPtr            document;       ///< The parsed svg.
+    RasterizingTaskPtr        loadTask;       ///< The task loading it, until completed.
+    std::vector< SvgVisual* > loadObservers;  ///< The visuals waiting for it to be loaded.
+    uint32_t                  referenceCount; ///< The number of visuals using it.
+  };
+
+  struct RasterKey
+  {
+    std::string url;
+    uint32_t    width;
+    uint32_t    height;
+    float       dpi;
+
+    bool operator<( const RasterKey& rhs ) const;
+    bool operator==( const RasterKey& rhs ) const;
+  };
+
+  struct RasterInfo
+  {
+    SvgDocumentPtr             document;  ///< The document rasterized.
+    RasterizingTaskPtr         task;      ///< The task rasterizing it, until completed.
+    PixelData                  pixelData; ///< The rasterized pixels, until uploaded to the texture.
+    Texture                    texture;   ///< The texture shared by the visuals not atlasing.
+    std::vector< SvgVisual* >  visuals;   ///< The visuals showing or waiting for the rasterization.
+    bool                       completed; ///< Whether the rasterization is completed, successfully or not.
+  };
+
+  typedef std::map< RasterKey, RasterInfo > RasterMap;
+
+  /**
+   * Get the rasterize thread, creating it the first time.
+   */
+  SvgRasterizeThread* GetRasterizeThread();
+
+  /**
+   * Store the result of a rasterization and apply it to the visuals waiting for it.
+   */
+  void CompleteRasterization( const RasterKey& key, RasterInfo& info, PixelData pixelData, bool loaded );
+
+  /**
+   * Find the rasterization requested by a visual.
+   */
+  RasterMap::iterator FindRasterization( SvgVisual* visual );
+
+  /**
+   * Apply a loaded document to the visuals waiting for it.
+   */
+  void DocumentLoaded( const SvgDocumentPtr& document );
+
+  /**
+   * Whether a rasterizing task of the document is pending.
+   */
+  bool IsRasterizationPending( const SvgDocumentPtr& document ) const;
+
+  /**
+   * Queue the loading of a document if visuals are waiting for it, and no task loads or rasterizes it.
+   */
+  void QueueLoad( const SvgDocumentPtr& document );
+
+private:
+
+  std::unordered_map< std::string, DocumentInfo > mDocuments;      ///< The documents by URL.
+  RasterMap                                       mRasterizations; ///< The rasterizations by URL, size and dpi.
+  std::unordered_map< SvgVisual*, RasterKey >     mVisualKeys;     ///< The rasterization requested by each visual.
+  SvgRasterizeThread*                             mRasterizeThread;
+};
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // DALI_TOOLKIT_SVG_CACHE_H
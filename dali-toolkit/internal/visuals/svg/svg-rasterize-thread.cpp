@@ -19,13 +19,12 @@
 #include "svg-rasterize-thread.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/thread-settings.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
-#include <dali-toolkit/internal/visuals/svg/svg-visual.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 
 namespace Dali
 {
@@ -36,84 +35,188 @@ namespace Toolkit
 namespace Internal
 {
 
-RasterizingTask::RasterizingTask( SvgVisual* svgRenderer, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi, unsigned int width, unsigned int height, bool loaded)
-: mSvgVisual( svgRenderer ),
-  mVectorRenderer( vectorRenderer ),
-  mUrl( url ),
+SvgDocument::SvgDocument( const VisualUrl& url, float dpi )
+: mUrl( url ),
+  mVectorRenderer( VectorImageRenderer::New() ),
+  mMutex(),
   mDpi( dpi ),
-  mWidth( width ),
-  mHeight( height ),
-  mLoaded( loaded )
+  mDefaultWidth( 0u ),
+  mDefaultHeight( 0u ),
+  mLoaded( false ),
+  mLoadFailed( false )
 {
-
 }
 
-RasterizingTask::~RasterizingTask()
+SvgDocument::~SvgDocument()
 {
 }
 
-void RasterizingTask::Load()
+bool SvgDocument::Load()
 {
-  if(!mLoaded && !mUrl.IsLocalResource())
+  Mutex::ScopedLock lock( mMutex );
+
+  if( mLoaded || mLoadFailed )
   {
-    Dali::Vector<uint8_t> remoteBuffer;
-    if(!Dali::FileLoader::DownloadFileSynchronously(mUrl.GetUrl(), remoteBuffer))
+    return mLoaded;
+  }
+
+  Dali::Vector<uint8_t> buffer;
+  if( mUrl.IsLocalResource() )
+  {
+    if( !Dali::FileLoader::ReadFile( mUrl.GetUrl(), buffer ) )
     {
-      DALI_LOG_ERROR("RasterizingTask::Load: Failed to download file! [%s]\n", mUrl.GetUrl().c_str());
-      return;
+      DALI_LOG_ERROR( "SvgDocument::Load: Failed to read file! [%s]\n", mUrl.GetUrl().c_str() );
+      mLoadFailed = true;
+      return false;
     }
+  }
+  else if( !Dali::FileLoader::DownloadFileSynchronously( mUrl.GetUrl(), buffer ) )
+  {
+    DALI_LOG_ERROR( "SvgDocument::Load: Failed to download file! [%s]\n", mUrl.GetUrl().c_str() );
+    mLoadFailed = true;
+    return false;
+  }
 
-    remoteBuffer.PushBack('\0');
+  buffer.PushBack( '\0' );
 
-    if(!mVectorRenderer.Load(remoteBuffer, mDpi))
-    {
-      DALI_LOG_ERROR("RasterizingTask::Load:Failed to load data! [%s]\n", mUrl.GetUrl().c_str());
-      return;
-    }
+  if( !mVectorRenderer.Load( buffer, mDpi ) )
+  {
+    DALI_LOG_ERROR( "SvgDocument::Load: Failed to load data! [%s]\n", mUrl.GetUrl().c_str() );
+    mLoadFailed = true;
+    return false;
+  }
+
+  mVectorRenderer.GetDefaultSize( mDefaultWidth, mDefaultHeight );
+  mLoaded = true;
+  return true;
+}
+
+bool SvgDocument::IsLoaded() const
+{
+  return mLoaded;
+}
+
+bool SvgDocument::HasLoadFailed() const
+{
+  return mLoadFailed;
+}
 
-    mLoaded = true;
+void SvgDocument::GetDefaultSize( uint32_t& width, uint32_t& height ) const
+{
+  if( mLoaded )
+  {
+    width = mDefaultWidth;
+    height = mDefaultHeight;
+  }
+  else
+  {
+    width = 0u;
+    height = 0u;
   }
 }
 
-void RasterizingTask::Rasterize()
+PixelData SvgDocument::Rasterize( uint32_t width, uint32_t height )
 {
-  if(mWidth <= 0u || mHeight <= 0u)
+  if( width == 0u || height == 0u )
   {
-    DALI_LOG_ERROR("RasterizingTask::Rasterize: Size is zero!\n");
-    return;
+    DALI_LOG_ERROR( "SvgDocument::Rasterize: Size is zero!\n" );
+    return PixelData();
   }
 
-  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New(mWidth, mHeight, Dali::Pixel::RGBA8888);
+  Mutex::ScopedLock lock( mMutex );
 
-  uint32_t defaultWidth, defaultHeight;
-  mVectorRenderer.GetDefaultSize(defaultWidth, defaultHeight);
+  if( !mLoaded )
+  {
+    return PixelData();
+  }
+
+  Devel::PixelBuffer pixelBuffer = Devel::PixelBuffer::New( width, height, Dali::Pixel::RGBA8888 );
 
-  float scaleX = static_cast<float>(mWidth) / static_cast<float>(defaultWidth);
-  float scaleY = static_cast<float>(mHeight) / static_cast<float>(defaultHeight);
+  float scaleX = static_cast<float>( width ) / static_cast<float>( mDefaultWidth );
+  float scaleY = static_cast<float>( height ) / static_cast<float>( mDefaultHeight );
   float scale  = scaleX < scaleY ? scaleX : scaleY;
 
-  if(!mVectorRenderer.Rasterize(pixelBuffer, scale))
+  if( !mVectorRenderer.Rasterize( pixelBuffer, scale ) )
   {
-    DALI_LOG_ERROR("RasterizingTask::Rasterize: Rasterize is failed! [%s]\n", mUrl.GetUrl().c_str());
-    return;
+    DALI_LOG_ERROR( "SvgDocument::Rasterize: Rasterize is failed! [%s]\n", mUrl.GetUrl().c_str() );
+    return PixelData();
   }
 
-  mPixelData = Devel::PixelBuffer::Convert(pixelBuffer);
+  return Devel::PixelBuffer::Convert( pixelBuffer );
 }
 
-VectorImageRenderer RasterizingTask::GetVectorRenderer() const
+const VisualUrl& SvgDocument::GetUrl() const
 {
-  return mVectorRenderer;
+  return mUrl;
 }
 
-bool RasterizingTask::IsLoaded() const
+float SvgDocument::GetDpi() const
+{
+  return mDpi;
+}
+
+RasterizingTask::RasterizingTask( SvgDocumentPtr document, uint32_t width, uint32_t height )
+: mDocument( document ),
+  mPixelData(),
+  mWidth( width ),
+  mHeight( height ),
+  mLoaded( false ),
+  mLoadOnly( false ),
+  mQueuedTime()
 {
-  return mLoaded;
 }
 
-SvgVisual* RasterizingTask::GetSvgVisual() const
+RasterizingTask::RasterizingTask( SvgDocumentPtr document )
+: mDocument( document ),
+  mPixelData(),
+  mWidth( 0u ),
+  mHeight( 0u ),
+  mLoaded( false ),
+  mLoadOnly( true ),
+  mQueuedTime()
+{
+}
+
+RasterizingTask::~RasterizingTask()
 {
-  return mSvgVisual.Get();
+}
+
+void RasterizingTask::Load()
+{
+  mLoaded = mDocument->Load();
+}
+
+void RasterizingTask::Rasterize()
+{
+  if( !mLoadOnly )
+  {
+    mPixelData = mDocument->Rasterize( mWidth, mHeight );
+  }
+}
+
+SvgDocumentPtr RasterizingTask::GetDocument() const
+{
+  return mDocument;
+}
+
+bool RasterizingTask::IsLoadOnly() const
+{
+  return mLoadOnly;
+}
+
+uint32_t RasterizingTask::GetWidth() const
+{
+  return mWidth;
+}
+
+uint32_t RasterizingTask::GetHeight() const
+{
+  return mHeight;
+}
+
+bool RasterizingTask::IsLoaded() const
+{
+  return mLoaded;
 }
 
 PixelData RasterizingTask::GetPixelData() const
@@ -121,12 +224,23 @@ PixelData RasterizingTask::GetPixelData() const
   return mPixelData;
 }
 
-SvgRasterizeThread::SvgRasterizeThread()
-: mTrigger( new EventThreadCallback( MakeCallback( this, &SvgRasterizeThread::ApplyRasterizedSVGToSampler ) ) ),
-  mLogFactory( Dali::Adaptor::Get().GetLogFactory() ),
-  mIsThreadWaiting( false ),
+void RasterizingTask::SetQueuedTime( std::chrono::steady_clock::time_point queuedTime )
+{
+  mQueuedTime = queuedTime;
+}
+
+std::chrono::steady_clock::time_point RasterizingTask::GetQueuedTime() const
+{
+  return mQueuedTime;
+}
+
+SvgRasterizeThread::SvgRasterizeThread( SvgCache& cache )
+: mCache( cache ),
+  mTrigger( new EventThreadCallback( MakeCallback( this, &SvgRasterizeThread::ApplyRasterizedSVGToSampler ) ) ),
+  mWorkerPool( WorkerPool::Get() ),
   mProcessorRegistered( false )
 {
+  mWorkerPool->Register( *this, Toolkit::WorkerPool::Subsystem::SVG_RASTERIZATION );
 }
 
 SvgRasterizeThread::~SvgRasterizeThread()
@@ -141,10 +255,8 @@ void SvgRasterizeThread::TerminateThread( SvgRasterizeThread*& thread )
 {
   if( thread )
   {
-    // add an empty task would stop the thread from conditional wait.
-    thread->AddTask( RasterizingTaskPtr() );
-    // stop the thread
-    thread->Join();
+    // wait for the task being rasterized, if any.
+    thread->mWorkerPool->Unregister( *thread );
     // delete the thread
     delete thread;
     thread = NULL;
@@ -153,25 +265,11 @@ void SvgRasterizeThread::TerminateThread( SvgRasterizeThread*& thread )
 
 void SvgRasterizeThread::AddTask( RasterizingTaskPtr task )
 {
-  bool wasEmpty = false;
+  task->SetQueuedTime( std::chrono::steady_clock::now() );
 
   {
     // Lock while adding task to the queue
-    ConditionalWait::ScopedLock lock( mConditionalWait );
-    wasEmpty = mRasterizeTasks.empty();
-    if( !wasEmpty && task != NULL)
-    {
-      // Remove the tasks with the same renderer.
-      // Older task which waiting to rasterize and apply the svg to the same renderer is expired.
-      for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
-      {
-        if( (*it) && (*it)->GetSvgVisual() == task->GetSvgVisual() )
-        {
-          mRasterizeTasks.erase( it );
-          break;
-        }
-      }
-    }
+    Mutex::ScopedLock lock( mRasterizeMutex );
     mRasterizeTasks.push_back( task );
 
     if( !mProcessorRegistered )
@@ -181,11 +279,8 @@ void SvgRasterizeThread::AddTask( RasterizingTaskPtr task )
     }
   }
 
-  if( wasEmpty)
-  {
-    // wake up the image loading thread
-    mConditionalWait.Notify();
-  }
+  // wake up a worker thread
+  mWorkerPool->Notify();
 }
 
 RasterizingTaskPtr SvgRasterizeThread::NextCompletedTask()
@@ -205,15 +300,15 @@ RasterizingTaskPtr SvgRasterizeThread::NextCompletedTask()
   return nextTask;
 }
 
-void SvgRasterizeThread::RemoveTask( SvgVisual* visual )
+void SvgRasterizeThread::RemoveTask( RasterizingTask* task )
 {
   // Lock while remove task from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
+  Mutex::ScopedLock lock( mRasterizeMutex );
   if( !mRasterizeTasks.empty() )
   {
     for( std::vector< RasterizingTaskPtr >::iterator it = mRasterizeTasks.begin(), endIt = mRasterizeTasks.end(); it != endIt; ++it )
     {
-      if( (*it) &&  (*it)->GetSvgVisual() == visual )
+      if( (*it) == task )
       {
         mRasterizeTasks.erase( it );
         break;
@@ -224,39 +319,15 @@ void SvgRasterizeThread::RemoveTask( SvgVisual* visual )
   UnregisterProcessor();
 }
 
-void SvgRasterizeThread::DeleteImage( VectorImageRenderer vectorRenderer )
-{
-  // Lock while adding image to the delete queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
-
-  if( mIsThreadWaiting ) // no rasterization is ongoing, save to delete
-  {
-    // TODO: what?
-  }
-  else // wait to delete until current rasterization completed.
-  {
-    mDeleteSvg.PushBack( &vectorRenderer );
-  }
-}
-
 RasterizingTaskPtr SvgRasterizeThread::NextTaskToProcess()
 {
   // Lock while popping task out from the queue
-  ConditionalWait::ScopedLock lock( mConditionalWait );
-
-  // Delete the image here to make sure that it is not used in the nsvgRasterize()
-  if( !mDeleteSvg.Empty() )
-  {
-    mDeleteSvg.Clear();
-  }
+  Mutex::ScopedLock lock( mRasterizeMutex );
 
-  // conditional wait
-  while( mRasterizeTasks.empty() )
+  if( mRasterizeTasks.empty() )
   {
-    mIsThreadWaiting = true;
-    mConditionalWait.Wait( lock );
+    return RasterizingTaskPtr();
   }
-  mIsThreadWaiting = false;
 
   // pop out the next task from the queue
   std::vector< RasterizingTaskPtr >::iterator next = mRasterizeTasks.begin();
@@ -276,24 +347,37 @@ void SvgRasterizeThread::AddCompletedTask( RasterizingTaskPtr task )
   mTrigger->Trigger();
 }
 
-void SvgRasterizeThread::Run()
+uint32_t SvgRasterizeThread::GetNumberOfTasks( WorkerPool::Priority& priority )
 {
-  SetThreadName( "SVGThread" );
-  mLogFactory.InstallLogFunction();
+  Mutex::ScopedLock lock( mRasterizeMutex );
 
-  while( RasterizingTaskPtr task = NextTaskToProcess() )
+  // The rasterized images are only requested for the visuals on the scene.
+  priority = WorkerPool::Priority::HIGH;
+  return mRasterizeTasks.size();
+}
+
+bool SvgRasterizeThread::ProcessNextTask( uint64_t& latency )
+{
+  RasterizingTaskPtr task = NextTaskToProcess();
+  if( !task )
   {
-    task->Load( );
-    task->Rasterize( );
-    AddCompletedTask( task );
+    return false;
   }
+
+  latency = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::steady_clock::now() - task->GetQueuedTime() ).count();
+
+  task->Load( );
+  task->Rasterize( );
+  AddCompletedTask( task );
+
+  return true;
 }
 
 void SvgRasterizeThread::ApplyRasterizedSVGToSampler()
 {
   while( RasterizingTaskPtr task = NextCompletedTask() )
   {
-    task->GetSvgVisual()->ApplyRasterizedImage(task->GetVectorRenderer(), task->GetPixelData(), task->IsLoaded());
+    mCache.RasterizationCompleted( task );
   }
 
   UnregisterProcessor();
@@ -18,21 +18,21 @@
  */
 
 // EXTERNAL INCLUDES
+#include <atomic>
+#include <chrono>
 #include <dali/devel-api/adaptor-framework/event-thread-callback.h>
-#include <dali/devel-api/threading/conditional-wait.h>
 #include <dali/devel-api/threading/mutex.h>
-#include <dali/devel-api/threading/thread.h>
 #include <dali/public-api/images/pixel-data.h>
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/devel-api/adaptor-framework/vector-image-renderer.h>
-#include <dali/integration-api/adaptor-framework/log-factory-interface.h>
 #include <dali/integration-api/processor-interface.h>
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali-toolkit/internal/helpers/worker-pool.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
 
 namespace Dali
@@ -44,32 +44,123 @@ namespace Toolkit
 namespace Internal
 {
 
-class SvgVisual;
-typedef IntrusivePtr< SvgVisual > SvgVisualPtr;
+class SvgCache;
+class SvgDocument;
+typedef IntrusivePtr< SvgDocument > SvgDocumentPtr;
 class RasterizingTask;
 typedef IntrusivePtr< RasterizingTask > RasterizingTaskPtr;
 
+/**
+ * A parsed svg image, shared by the svg visuals with the same URL.
+ *
+ * The svg is loaded by the first task processing the document, or by the main thread for the synchronous visuals.
+ * As the synchronous visuals also rasterize in the main thread, the loading and the rasterization are serialized
+ * by the document. The load state and the default size can be read from any thread without waiting for them.
+ */
+class SvgDocument : public RefObject
+{
+public:
+  /**
+   * Constructor
+   * @param[in] url The URL to svg resource to use.
+   * @param[in] dpi The dpi to parse the svg resource with.
+   */
+  SvgDocument( const VisualUrl& url, float dpi );
+
+  /**
+   * Load the svg file, unless a previous attempt was made.
+   * @return True if the svg file is loaded.
+   */
+  bool Load();
+
+  /**
+   * Whether the svg file is loaded.
+   * @return True if the svg file is loaded.
+   */
+  bool IsLoaded() const;
+
+  /**
+   * Whether the svg file failed to load.
+   * @return True if an attempt to load the svg file failed.
+   */
+  bool HasLoadFailed() const;
+
+  /**
+   * Get the default size of the svg image.
+   * @param[out] width The default width, zero if the svg file is not loaded.
+   * @param[out] height The default height, zero if the svg file is not loaded.
+   */
+  void GetDefaultSize( uint32_t& width, uint32_t& height ) const;
+
+  /**
+   * Rasterize the svg image to fit in the given size.
+   * @param[in] width The rasterization width.
+   * @param[in] height The rasterization height.
+   * @return The pixel data with the rasterized pixels, empty if the rasterization failed.
+   */
+  PixelData Rasterize( uint32_t width, uint32_t height );
+
+  /**
+   * Get the URL of the svg resource.
+   * @return The URL.
+   */
+  const VisualUrl& GetUrl() const;
+
+  /**
+   * Get the dpi the svg resource is parsed with.
+   * @return The dpi.
+   */
+  float GetDpi() const;
+
+protected:
+  /**
+   * Destructor.
+   */
+  ~SvgDocument() override;
+
+private:
+  // Undefined
+  SvgDocument( const SvgDocument& document );
+
+  // Undefined
+  SvgDocument& operator=( const SvgDocument& document );
+
+private:
+  VisualUrl           mUrl;
+  VectorImageRenderer mVectorRenderer;
+  Dali::Mutex         mMutex;          ///< Guards the renderer
+  float               mDpi;
+  uint32_t            mDefaultWidth;   ///< Set before mLoaded
+  uint32_t            mDefaultHeight;  ///< Set before mLoaded
+  std::atomic<bool>   mLoaded;
+  std::atomic<bool>   mLoadFailed;
+};
+
 /**
  * The svg rasterizing tasks to be processed in the worker thread.
  *
  * Life cycle of a rasterizing task is as follows:
- * 1. Created by SvgVisual in the main thread
- * 2. Queued in the worked thread waiting to be processed.
- * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized image to material then been deleted in main thread call back
- *    Or if this task is been removed ( new image/size set to the visual or actor off stage) before its turn to be processed, it then been deleted in the worker thread.
+ * 1. Created by SvgCache in the main thread, once for all the visuals waiting for the same rasterization
+ * 2. Queued in the SvgRasterizeThread waiting to be processed by a worker thread.
+ * 3. If this task gets its turn to do the rasterization, it triggers main thread to apply the rasterized image to the waiting visuals then been deleted in main thread call back
+ *    Or if this task is been removed ( no visual waiting for the rasterization anymore ) before its turn to be processed, it then been deleted in main thread.
  */
 class RasterizingTask : public RefObject
 {
 public:
   /**
    * Constructor
-   * @param[in] svgRenderer The renderer which the rasterized image to be applied.
-   * @param[in] url The URL to svg resource to use.
+   * @param[in] document The svg document to rasterize.
    * @param[in] width The rasterization width.
    * @param[in] height The rasterization height.
-   * @param[in] loaded The svg resource is loaded or not.
    */
-  RasterizingTask( SvgVisual* svgRenderer, VectorImageRenderer vectorRenderer, const VisualUrl& url, float dpi, unsigned int width, unsigned int height, bool loaded );
+  RasterizingTask( SvgDocumentPtr document, uint32_t width, uint32_t height );
+
+  /**
+   * Constructor of a task which only loads the document.
+   * @param[in] document The svg document to load.
+   */
+  RasterizingTask( SvgDocumentPtr document );
 
   /**
    * Destructor.
@@ -77,14 +168,33 @@ public:
   ~RasterizingTask() override;
 
   /**
-   * Do the rasterization with the mRasterizer.
+   * Do the rasterization with the document.
    */
   void Rasterize();
 
   /**
-   * Get the svg visual
+   * Get the svg document.
+   * @return The document.
    */
-  SvgVisual* GetSvgVisual() const;
+  SvgDocumentPtr GetDocument() const;
+
+  /**
+   * Whether the task only loads the document.
+   * @return True if the task does not rasterize.
+   */
+  bool IsLoadOnly() const;
+
+  /**
+   * Get the rasterization width.
+   * @return The width.
+   */
+  uint32_t GetWidth() const;
+
+  /**
+   * Get the rasterization height.
+   * @return The height.
+   */
+  uint32_t GetHeight() const;
 
   /**
    * Get the rasterization result.
@@ -92,11 +202,6 @@ public:
    */
   PixelData GetPixelData() const;
 
-  /**
-   * Get the VectorRenderer.
-   * @return VectorRenderer.
-   */
-  VectorImageRenderer GetVectorRenderer() const;
   /**
    * Whether the resource is loaded.
    * @return True if the resource is loaded.
@@ -108,6 +213,18 @@ public:
    */
   void Load();
 
+  /**
+   * Set when the task was added to the waiting queue.
+   * @param[in] queuedTime The time the task was queued.
+   */
+  void SetQueuedTime( std::chrono::steady_clock::time_point queuedTime );
+
+  /**
+   * Get when the task was added to the waiting queue.
+   * @return The time the task was queued.
+   */
+  std::chrono::steady_clock::time_point GetQueuedTime() const;
+
 private:
   // Undefined
   RasterizingTask( const RasterizingTask& task );
@@ -116,32 +233,31 @@ private:
   RasterizingTask& operator=( const RasterizingTask& task );
 
 private:
-  SvgVisualPtr    mSvgVisual;
-  VectorImageRenderer mVectorRenderer;
-  VisualUrl       mUrl;
+  SvgDocumentPtr  mDocument;
   PixelData       mPixelData;
-  float           mDpi;
-  unsigned int    mWidth;
-  unsigned int    mHeight;
+  uint32_t        mWidth;
+  uint32_t        mHeight;
   bool            mLoaded;
+  bool            mLoadOnly;
+  std::chrono::steady_clock::time_point mQueuedTime;
 };
 
 /**
- * The worker thread for SVG rasterization.
+ * The queue of SVG rasterization tasks, processed by the worker threads of the toolkit.
  */
-class SvgRasterizeThread : public Thread, Integration::Processor
+class SvgRasterizeThread : public WorkerPool::Queue, Integration::Processor
 {
 public:
 
   /**
    * Constructor.
    *
-   * @param[in] trigger The trigger to wake up the main thread.
+   * @param[in] cache The cache to notify of the completed rasterizations.
    */
-  SvgRasterizeThread();
+  SvgRasterizeThread( SvgCache& cache );
 
   /**
-   * Terminate the svg rasterize thread, join and delete.
+   * Terminate the svg rasterize thread, wait for the task being rasterized and delete.
    */
   static void TerminateThread( SvgRasterizeThread*& thread );
 
@@ -160,34 +276,36 @@ public:
   RasterizingTaskPtr NextCompletedTask();
 
   /**
-   * Remove the task with the given visual from the waiting queue, called by main thread.
+   * Remove the task from the waiting queue, called by main thread.
    *
-   * Typically called when the actor is put off stage, so the renderer is not needed anymore.
+   * Typically called when no visual is waiting for the rasterization anymore.
    *
-   * @param[in] visual The visual pointer.
+   * @param[in] task The task to remove.
    */
-  void RemoveTask( SvgVisual* visual );
+  void RemoveTask( RasterizingTask* task );
 
   /**
-   * Delete the parsed SVG image, called by main thread.
-   *
-   * The parsed svg should be deleted in worker thread, as the main thread does not know whether a rasterization of this svg is ongoing.
-   *
-   * @param[in] VectorImage The image to be deleted
-   */
-  void DeleteImage( VectorImageRenderer vectorImage );
-
-    /**
    * @copydoc Dali::Integration::Processor::Process()
    */
   void Process() override;
 
+  /**
+   * @copydoc WorkerPool::Queue::GetNumberOfTasks()
+   */
+  uint32_t GetNumberOfTasks( WorkerPool::Priority& priority ) override;
+
+  /**
+   * @copydoc WorkerPool::Queue::ProcessNextTask()
+   * It fetches the next task from the Queue, rasterizes the image and adds it to the completed queue.
+   */
+  bool ProcessNextTask( uint64_t& latency ) override;
+
 private:
 
   /**
    * Pop the next task out from the queue.
    *
-   * @return The next task to be processed.
+   * @return The next task to be processed or an empty pointer if the queue is empty.
    */
   RasterizingTaskPtr NextTaskToProcess();
 
@@ -199,7 +317,7 @@ private:
   void AddCompletedTask( RasterizingTaskPtr task );
 
   /**
-   * Applies the rasterized image to material
+   * Passes the completed rasterizations to the cache
    */
   void ApplyRasterizedSVGToSampler();
 
@@ -216,13 +334,6 @@ protected:
    */
   ~SvgRasterizeThread() override;
 
-
-  /**
-   * The entry function of the worker thread.
-   * It fetches task from the Queue, rasterizes the image and apply to the renderer.
-   */
-  void Run() override;
-
 private:
 
   // Undefined
@@ -235,13 +346,12 @@ private:
 
   std::vector<RasterizingTaskPtr>  mRasterizeTasks;     //The queue of the tasks waiting to rasterize the SVG image
   std::vector <RasterizingTaskPtr> mCompletedTasks;     //The queue of the tasks with the SVG rasterization completed
-  Vector <VectorImageRenderer*>    mDeleteSvg;          //The images that the event thread requested to delete
 
-  ConditionalWait            mConditionalWait;
+  SvgCache&                  mCache;              //The cache to notify of the completed rasterizations
+  Dali::Mutex                mRasterizeMutex;     //Guards the tasks waiting to rasterize
   Dali::Mutex                mMutex;
   std::unique_ptr< EventThreadCallback > mTrigger;
-  const Dali::LogFactoryInterface&       mLogFactory;
-  bool                       mIsThreadWaiting;
+  WorkerPoolPtr              mWorkerPool;         //The pool processing the tasks
   bool                       mProcessorRegistered;
 };
 
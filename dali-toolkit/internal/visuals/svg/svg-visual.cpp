@@ -19,7 +19,7 @@
 #include "svg-visual.h"
 
 // INTERNAL INCLUDES
-#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/visual-string-constants.h>
 #include <dali-toolkit/internal/visuals/visual-base-data-impl.h>
@@ -28,7 +28,6 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/stage.h>
-#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -50,8 +49,8 @@ const Dali::Vector4 FULL_TEXTURE_RECT(0.f, 0.f, 1.f, 1.f);
 SvgVisualPtr SvgVisual::New( VisualFactoryCache& factoryCache, ImageVisualShaderFactory& shaderFactory, const VisualUrl& imageUrl, const Property::Map& properties )
 {
   SvgVisualPtr svgVisual( new SvgVisual( factoryCache, shaderFactory, imageUrl ) );
-  svgVisual->Load();
   svgVisual->SetProperties(properties);
+  svgVisual->Load();
   return svgVisual;
 }
 
@@ -67,10 +66,7 @@ SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageVisualShaderFactory
   mImageVisualShaderFactory( shaderFactory ),
   mAtlasRect( FULL_TEXTURE_RECT ),
   mImageUrl( imageUrl ),
-  mVectorRenderer( VectorImageRenderer::New() ),
-  mDefaultWidth( 0 ),
-  mDefaultHeight( 0 ),
-  mLoaded( false ),
+  mDocument(),
   mPlacementActor(),
   mVisualSize(Vector2::ZERO),
   mAttemptAtlasing( false )
@@ -81,6 +77,14 @@ SvgVisual::SvgVisual( VisualFactoryCache& factoryCache, ImageVisualShaderFactory
 
 SvgVisual::~SvgVisual()
 {
+  if( Stage::IsInstalled() )
+  {
+    // The cache could have been deleted before the visual (e.g. due to stage shutdown).
+    SvgCache& svgCache = mFactoryCache.GetSvgCache();
+    svgCache.RemoveRasterization( this );
+    svgCache.CancelLoad( this, mDocument );
+    svgCache.RemoveDocument( mDocument );
+  }
 }
 
 void SvgVisual::DoSetProperties( const Property::Map& propertyMap )
@@ -165,13 +169,26 @@ void SvgVisual::DoSetOnScene( Actor& actor )
   // Hold the weak handle of the placement actor and delay the adding of renderer until the svg rasterization is finished.
   mPlacementActor = actor;
 
-  // SVG visual needs it's size set before it can be rasterized hence set ResourceReady once on stage
-  ResourceReady( Toolkit::Visual::ResourceStatus::READY );
+  // SVG visual needs it's size set before it can be rasterized hence set ResourceReady once the natural size is known
+  if( mDocument->IsLoaded() )
+  {
+    ResourceReady( Toolkit::Visual::ResourceStatus::READY );
+  }
+  else if( mDocument->HasLoadFailed() )
+  {
+    ResourceReady( Toolkit::Visual::ResourceStatus::FAILED );
+  }
+  else
+  {
+    mFactoryCache.GetSvgCache().RequestLoad( this, mDocument );
+  }
 }
 
 void SvgVisual::DoSetOffScene( Actor& actor )
 {
-  mFactoryCache.GetSVGRasterizationThread()->RemoveTask( this );
+  SvgCache& svgCache = mFactoryCache.GetSvgCache();
+  svgCache.RemoveRasterization( this );
+  svgCache.CancelLoad( this, mDocument );
 
   actor.RemoveRenderer( mImpl->mRenderer );
   mImpl->mRenderer.Reset();
@@ -183,15 +200,15 @@ void SvgVisual::DoSetOffScene( Actor& actor )
 
 void SvgVisual::GetNaturalSize( Vector2& naturalSize )
 {
-  if(mLoaded)
+  uint32_t defaultWidth = 0u;
+  uint32_t defaultHeight = 0u;
+  if( mDocument )
   {
-    naturalSize.x = mDefaultWidth;
-    naturalSize.y = mDefaultHeight;
-  }
-  else
-  {
-    naturalSize = Vector2::ZERO;
+    mDocument->GetDefaultSize( defaultWidth, defaultHeight );
   }
+
+  naturalSize.x = defaultWidth;
+  naturalSize.y = defaultHeight;
 }
 
 void SvgVisual::DoCreatePropertyMap( Property::Map& map ) const
@@ -213,28 +230,14 @@ void SvgVisual::DoCreateInstancePropertyMap( Property::Map& map ) const
 
 void SvgVisual::Load()
 {
-  // load remote resource on svg rasterize thread.
-  if(!mLoaded && mImageUrl.IsLocalResource())
-  {
-    Dali::Vector<uint8_t> buffer;
-    if(Dali::FileLoader::ReadFile(mImageUrl.GetUrl(), buffer))
-    {
-      buffer.PushBack('\0');
+  // Parse the svg once for all the visuals with the same URL, on svg rasterize thread unless required now.
+  Vector2 dpi = Stage::GetCurrent().GetDpi();
+  float meanDpi = ( dpi.height + dpi.width ) * 0.5f;
+  mDocument = mFactoryCache.GetSvgCache().RequestDocument( mImageUrl, meanDpi );
 
-      Vector2 dpi = Stage::GetCurrent().GetDpi();
-      float meanDpi = (dpi.height + dpi.width) * 0.5f;
-      if(!mVectorRenderer.Load(buffer, meanDpi))
-      {
-        DALI_LOG_ERROR("SvgVisual::Load: Failed to load file! [%s]\n", mImageUrl.GetUrl().c_str());
-        return;
-      }
-      mVectorRenderer.GetDefaultSize(mDefaultWidth, mDefaultHeight);
-      mLoaded = true;
-    }
-    else
-    {
-      DALI_LOG_ERROR("SvgVisual::Load: Failed to read file! [%s]\n", mImageUrl.GetUrl().c_str());
-    }
+  if( IsSynchronousLoadingRequired() )
+  {
+    mDocument->Load();
   }
 }
 
@@ -245,28 +248,14 @@ void SvgVisual::AddRasterizationTask( const Vector2& size )
     unsigned int width = static_cast<unsigned int>(size.width);
     unsigned int height = static_cast<unsigned int>( size.height );
 
-    Vector2 dpi = Stage::GetCurrent().GetDpi();
-    float meanDpi = ( dpi.height + dpi.width ) * 0.5f;
-
-    RasterizingTaskPtr newTask = new RasterizingTask(this, mVectorRenderer, mImageUrl, meanDpi, width, height, mLoaded);
-    if(IsSynchronousLoadingRequired())
-    {
-      newTask->Load();
-      newTask->Rasterize();
-      ApplyRasterizedImage(newTask->GetVectorRenderer(), newTask->GetPixelData(), newTask->IsLoaded());
-    }
-    else
-    {
-      mFactoryCache.GetSVGRasterizationThread()->AddTask( newTask );
-    }
+    // The rasterization is shared with the visuals of the same URL and size.
+    mFactoryCache.GetSvgCache().RequestRasterization( this, mDocument, width, height, IsSynchronousLoadingRequired() );
   }
 }
 
-void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelData rasterizedPixelData, bool isLoaded )
+void SvgVisual::ApplyRasterizedImage( PixelData rasterizedPixelData, bool success )
 {
-  mLoaded = isLoaded;
-
-  if(isLoaded && rasterizedPixelData && IsOnScene())
+  if( success && IsOnScene() )
   {
     TextureSet currentTextureSet = mImpl->mRenderer.GetTextures();
     if( mImpl->mFlags & Impl::IS_ATLASING_APPLIED )
@@ -276,7 +265,7 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
 
     TextureSet textureSet;
 
-    if( mAttemptAtlasing && !mImpl->mCustomShader )
+    if( mAttemptAtlasing && !mImpl->mCustomShader && rasterizedPixelData )
     {
       Vector4 atlasRect;
       textureSet = mFactoryCache.GetAtlasManager()->Add(atlasRect, rasterizedPixelData );
@@ -294,9 +283,7 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
 
     if( !textureSet ) // no atlasing - mAttemptAtlasing is false or adding to atlas is failed
     {
-      Texture texture = Texture::New( Dali::TextureType::TEXTURE_2D, Pixel::RGBA8888,
-                                      rasterizedPixelData.GetWidth(), rasterizedPixelData.GetHeight() );
-      texture.Upload( rasterizedPixelData );
+      Texture texture = mFactoryCache.GetSvgCache().GetTexture( this );
       mImpl->mFlags &= ~Impl::IS_ATLASING_APPLIED;
 
       if( mAtlasRect == FULL_TEXTURE_RECT )
@@ -330,12 +317,21 @@ void SvgVisual::ApplyRasterizedImage( VectorImageRenderer vectorRenderer, PixelD
     // Svg loaded and ready to display
     ResourceReady( Toolkit::Visual::ResourceStatus::READY );
   }
-  else if(!isLoaded || !rasterizedPixelData)
+  else if( !success )
   {
     ResourceReady( Toolkit::Visual::ResourceStatus::FAILED );
   }
 }
 
+void SvgVisual::ApplyLoadedDocument( bool loaded )
+{
+  if( IsOnScene() )
+  {
+    // The control relayouts with the natural size of the svg, if it depends on it.
+    ResourceReady( loaded ? Toolkit::Visual::ResourceStatus::READY : Toolkit::Visual::ResourceStatus::FAILED );
+  }
+}
+
 void SvgVisual::OnSetTransform()
 {
   Vector2 visualSize = mImpl->mTransform.GetVisualSize( mImpl->mControlSize );
@@ -36,6 +36,8 @@ namespace Internal
 {
 
 class ImageVisualShaderFactory;
+class SvgDocument;
+typedef IntrusivePtr< SvgDocument > SvgDocumentPtr;
 class SvgVisual;
 typedef IntrusivePtr< SvgVisual > SvgVisualPtr;
 
@@ -141,17 +143,23 @@ protected:
 public:
 
   /**
-   * @bried Apply the rasterized image to the visual.
+   * @bried Apply the rasterized image to the visual, called by SvgCache.
    *
-   * @param[in] vectorImage The data of vector image.
-   * @param[in] rasterizedPixelData The pixel buffer with the rasterized pixels
-   * @param[in] bool Whether the resource is loaded
+   * @param[in] rasterizedPixelData The pixel buffer with the rasterized pixels, empty if already uploaded to the shared texture
+   * @param[in] success Whether the resource is loaded and rasterized
    */
-  void ApplyRasterizedImage( VectorImageRenderer vectorImage, PixelData rasterizedPixelData, bool isLoaded );
+  void ApplyRasterizedImage( PixelData rasterizedPixelData, bool success );
+
+  /**
+   * @brief Report the loaded document, which gives the natural size, called by SvgCache.
+   *
+   * @param[in] loaded Whether the document is loaded
+   */
+  void ApplyLoadedDocument( bool loaded );
 
 private:
   /**
-   * @brief Load the SVG Image from the set URL.
+   * @brief Request the SVG Image from the set URL, loading it only if synchronous loading is required.
    */
   void Load();
 
@@ -179,10 +187,7 @@ private:
   ImageVisualShaderFactory& mImageVisualShaderFactory;
   Vector4                   mAtlasRect;
   VisualUrl                 mImageUrl;
-  VectorImageRenderer       mVectorRenderer;
-  uint32_t                  mDefaultWidth;
-  uint32_t                  mDefaultHeight;
-  bool                      mLoaded;
+  SvgDocumentPtr            mDocument;         ///< The parsed svg, shared by the visuals with the same URL
   WeakHandle<Actor>         mPlacementActor;
   Vector2                   mVisualSize;
   bool                      mAttemptAtlasing;  ///< If true will attempt atlasing, otherwise create unique texture
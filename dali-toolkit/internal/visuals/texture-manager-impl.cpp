@@ -19,6 +19,7 @@
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
 // EXTERNAL HEADERS
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <dali/public-api/math/vector4.h>
@@ -44,6 +45,7 @@ constexpr auto DEFAULT_NUMBER_OF_REMOTE_LOADER_THREADS = size_t{8u};
 
 constexpr auto NUMBER_OF_LOCAL_LOADER_THREADS_ENV = "DALI_TEXTURE_LOCAL_THREADS";
 constexpr auto NUMBER_OF_REMOTE_LOADER_THREADS_ENV = "DALI_TEXTURE_REMOTE_THREADS";
+constexpr auto CACHE_BUDGET_ENV = "DALI_TEXTURE_CACHE_BUDGET";
 
 size_t GetNumberOfThreads(const char* environmentVariable, size_t defaultValue)
 {
@@ -65,6 +67,13 @@ size_t GetNumberOfRemoteLoaderThreads()
   return GetNumberOfThreads(NUMBER_OF_REMOTE_LOADER_THREADS_ENV, DEFAULT_NUMBER_OF_REMOTE_LOADER_THREADS);
 }
 
+size_t GetCacheBudgetFromEnvironment()
+{
+  using Dali::EnvironmentVariable::GetEnvironmentVariable;
+  auto budgetString = GetEnvironmentVariable(CACHE_BUDGET_ENV);
+  return budgetString ? std::strtoull(budgetString, nullptr, 10) : 0u;
+}
+
 } // namespace
 
 namespace Dali
@@ -101,6 +110,11 @@ const int           INVALID_INDEX( -1 );                             ///< Invali
 const int           INVALID_CACHE_INDEX( -1 ); ///< Invalid Cache index
 
 
+size_t GetPixelBufferSize( Devel::PixelBuffer pixelBuffer )
+{
+  return pixelBuffer ? static_cast<size_t>( pixelBuffer.GetWidth() ) * pixelBuffer.GetHeight() * Pixel::GetBytesPerPixel( pixelBuffer.GetPixelFormat() ) : 0u;
+}
+
 void PreMultiply( Devel::PixelBuffer pixelBuffer, TextureManager::MultiplyOnLoad& preMultiplyOnLoad )
 {
   if( Pixel::HasAlpha( pixelBuffer.GetPixelFormat() ) )
@@ -127,7 +141,14 @@ TextureManager::MaskingData::MaskingData()
 }
 
 TextureManager::TextureManager()
-: mAsyncLocalLoaders( GetNumberOfLocalLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
+: mTextureInfoContainer(),
+  mTextureIdLookup(),
+  mTextureHashLookup(),
+  mFreeCacheIndices(),
+  mRetainedTextures(),
+  mCacheStatistics(),
+  mCacheBudget( GetCacheBudgetFromEnvironment() ),
+  mAsyncLocalLoaders( GetNumberOfLocalLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
   mAsyncRemoteLoaders( GetNumberOfRemoteLoaderThreads(), [&]() { return AsyncLoadingHelper(*this); } ),
   mExternalTextures(),
   mLifecycleObservers(),
@@ -470,7 +491,17 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
   // Check if the requested Texture exists in the cache.
   if( cacheIndex != INVALID_CACHE_INDEX )
   {
-    if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
+    ++mCacheStatistics.hitCount;
+
+    TextureInfo& cachedTextureInfo( mTextureInfoContainer[ cacheIndex ] );
+    if( cachedTextureInfo.retained )
+    {
+      // The texture was kept after its last client released it; it is in use again.
+      mRetainedTextures.erase( cachedTextureInfo.retainedPosition );
+      cachedTextureInfo.retained = false;
+      ++cachedTextureInfo.referenceCount;
+    }
+    else if ( TextureManager::ReloadPolicy::CACHED == reloadPolicy )
     {
       // Mark this texture being used by another client resource. Forced reload would replace the current texture
       // without the need for incrementing the reference count.
@@ -485,16 +516,20 @@ TextureManager::TextureId TextureManager::RequestLoadInternal(
                    url.GetUrl().c_str(), observer, cacheIndex, textureId );
   }
 
+  else if( textureHash != INITIAL_CACHE_NUMBER )
+  {
+    ++mCacheStatistics.missCount;
+  }
+
   if( textureId == INVALID_TEXTURE_ID ) // There was no caching, or caching not required
   {
     // We need a new Texture.
     textureId = GenerateUniqueTextureId();
     bool preMultiply = ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD );
-    mTextureInfoContainer.push_back( TextureInfo( textureId, maskTextureId, url.GetUrl(),
-                                                  desiredSize, contentScale, fittingMode, samplingMode,
-                                                  false, cropToMask, useAtlas, textureHash, orientationCorrection,
-                                                  preMultiply, animatedImageLoading, frameIndex ) );
-    cacheIndex = mTextureInfoContainer.size() - 1u;
+    cacheIndex = AddTextureInfo( TextureInfo( textureId, maskTextureId, url.GetUrl(),
+                                              desiredSize, contentScale, fittingMode, samplingMode,
+                                              false, cropToMask, useAtlas, textureHash, orientationCorrection,
+                                              preMultiply, animatedImageLoading, frameIndex ) );
 
     DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::RequestLoad( url=%s observer=%p ) New texture, cacheIndex:%d, textureId=%d\n",
                    url.GetUrl().c_str(), observer, cacheIndex, textureId );
@@ -593,8 +628,15 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
       textureInfo.referenceCount = 0;
       bool removeTextureInfo = false;
 
+      // If loaded, keep the texture until evicted if the cache has a budget.
+      if( CanRetainTexture( textureInfo ) )
+      {
+        mRetainedTextures.push_front( textureInfoIndex );
+        textureInfo.retainedPosition = mRetainedTextures.begin();
+        textureInfo.retained = true;
+      }
       // If loaded, we can remove the TextureInfo and the Atlas (if atlased).
-      if( textureInfo.loadState == LoadState::UPLOADED )
+      else if( textureInfo.loadState == LoadState::UPLOADED )
       {
         if( textureInfo.atlas )
         {
@@ -604,9 +646,17 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
       }
       else if( textureInfo.loadState == LoadState::LOADING )
       {
-        // We mark the textureInfo for removal.
-        // Once the load has completed, this method will be called again.
-        textureInfo.loadState = LoadState::CANCELLED;
+        if( CancelLoad( textureId ) )
+        {
+          // The load had not started, so there is nothing to wait for.
+          removeTextureInfo = true;
+        }
+        else
+        {
+          // We mark the textureInfo for removal.
+          // Once the load has completed, this method will be called again.
+          textureInfo.loadState = LoadState::CANCELLED;
+        }
       }
       else
       {
@@ -618,7 +668,11 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
       if( removeTextureInfo )
       {
         // Permanently remove the textureInfo struct.
-        mTextureInfoContainer.erase( mTextureInfoContainer.begin() + textureInfoIndex );
+        RemoveTextureInfo( textureInfoIndex );
+      }
+      else if( textureInfo.retained )
+      {
+        EvictRetainedTextures();
       }
     }
 
@@ -637,6 +691,43 @@ void TextureManager::Remove( const TextureManager::TextureId textureId, TextureU
   }
 }
 
+void TextureManager::SetLoadPriority( const TextureManager::TextureId textureId, DevelAsyncImageLoader::LoadPriority priority )
+{
+  int cacheIndex = GetCacheIndexFromId( textureId );
+  if( cacheIndex != INVALID_CACHE_INDEX )
+  {
+    TextureInfo& textureInfo( mTextureInfoContainer[cacheIndex] );
+
+    const bool lowPriority = ( priority == DevelAsyncImageLoader::LoadPriority::LOW );
+    if( ( textureInfo.loadState != LoadState::LOADING ) ||
+        ( textureInfo.lowPriority == lowPriority ) ||
+        ( lowPriority && ( textureInfo.referenceCount > 1 ) ) )
+    {
+      // Nothing to change, or another client may still need the texture first.
+      return;
+    }
+
+    DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::SetLoadPriority(%d) url:%s priority:%s\n",
+                   textureId, textureInfo.url.GetUrl().c_str(), lowPriority ? "LOW" : "HIGH" );
+
+    textureInfo.lowPriority = lowPriority;
+    if( !lowPriority )
+    {
+      // The time to upload is measured from when the image is needed.
+      textureInfo.loadStartTime = std::chrono::steady_clock::now();
+    }
+
+    auto& loadersContainer = textureInfo.url.IsLocalResource() ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
+    for( auto iter = loadersContainer.Begin(); iter != loadersContainer.End(); ++iter )
+    {
+      if( iter->SetLoadPriority( textureId, priority ) )
+      {
+        break;
+      }
+    }
+  }
+}
+
 VisualUrl TextureManager::GetVisualUrl( TextureId textureId )
 {
   VisualUrl visualUrl("");
@@ -836,6 +927,9 @@ void TextureManager::LoadTexture( TextureInfo& textureInfo, TextureUploadObserve
   textureInfo.loadState = LoadState::LOADING;
   if( !textureInfo.loadSynchronously )
   {
+    textureInfo.lowPriority = false;
+    textureInfo.loadStartTime = std::chrono::steady_clock::now();
+
     auto& loadersContainer = textureInfo.url.IsLocalResource() ? mAsyncLocalLoaders : mAsyncRemoteLoaders;
     auto loadingHelperIt = loadersContainer.GetNext();
     auto premultiplyOnLoad = ( textureInfo.preMultiplyOnLoad && textureInfo.maskTextureId == INVALID_TEXTURE_ID ) ?
@@ -906,12 +1000,16 @@ void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingCo
 {
   DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::AsyncLoadComplete( id:%d )\n", id );
 
-  if( loadingContainer.size() >= 1u )
+  // The loads may complete in a different order than they were requested, as the loads of high priority are done first.
+  for( auto iter = loadingContainer.begin(); iter != loadingContainer.end(); ++iter )
   {
-    AsyncLoadingInfo loadingInfo = loadingContainer.front();
-
-    if( loadingInfo.loadId == id )
+    if( iter->loadId == id )
     {
+      AsyncLoadingInfo loadingInfo = *iter;
+
+      // Removed before PostLoad(), which may request new loads.
+      loadingContainer.erase( iter );
+
       int cacheIndex = GetCacheIndexFromId( loadingInfo.textureId );
       if( cacheIndex != INVALID_CACHE_INDEX )
       {
@@ -931,10 +1029,43 @@ void TextureManager::AsyncLoadComplete( AsyncLoadingInfoContainerType& loadingCo
           Remove( textureInfo.textureId, nullptr );
         }
       }
+      break;
+    }
+  }
+}
+
+bool TextureManager::CancelLoad( TextureId textureId )
+{
+  for( auto loadersContainer : { &mAsyncLocalLoaders, &mAsyncRemoteLoaders } )
+  {
+    for( auto iter = loadersContainer->Begin(); iter != loadersContainer->End(); ++iter )
+    {
+      if( iter->Cancel( textureId ) )
+      {
+        return true;
+      }
     }
+  }
+  return false;
+}
+
+void TextureManager::RecordLoadTime( TextureInfo& textureInfo )
+{
+  if( !textureInfo.loadSynchronously && !textureInfo.lowPriority &&
+      ( textureInfo.loadStartTime != std::chrono::steady_clock::time_point() ) )
+  {
+    const uint64_t loadTime = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - textureInfo.loadStartTime ).count();
+
+    ++mCacheStatistics.visibleLoadCount;
+    mCacheStatistics.visibleLoadTime += loadTime;
+    mCacheStatistics.maxVisibleLoadTime = std::max( mCacheStatistics.maxVisibleLoadTime, loadTime );
 
-    loadingContainer.pop_front();
+    DALI_LOG_INFO( gTextureManagerLogFilter, Debug::General, "TextureManager::RecordLoadTime(%d) url:%s %llu us\n",
+                   textureInfo.textureId, textureInfo.url.GetUrl().c_str(), static_cast<unsigned long long>( loadTime ) );
   }
+
+  // Only the first upload of the load is measured.
+  textureInfo.loadStartTime = std::chrono::steady_clock::time_point();
 }
 
 void TextureManager::PostLoad( TextureInfo& textureInfo, Devel::PixelBuffer& pixelBuffer )
@@ -963,6 +1094,7 @@ void TextureManager::PostLoad( TextureInfo& textureInfo, Devel::PixelBuffer& pix
         {
           LoadState maskLoadState = GetTextureStateInternal( textureInfo.maskTextureId );
           textureInfo.pixelBuffer = pixelBuffer; // Store the pixel buffer temporarily
+          SetMemoryFootprint( textureInfo, textureInfo.gpuMemorySize, GetPixelBufferSize( pixelBuffer ) );
           if( maskLoadState == LoadState::LOADING )
           {
             textureInfo.loadState = LoadState::WAITING_FOR_MASK;
@@ -984,6 +1116,7 @@ void TextureManager::PostLoad( TextureInfo& textureInfo, Devel::PixelBuffer& pix
     {
       textureInfo.pixelBuffer = pixelBuffer; // Store the pixel data
       textureInfo.loadState = LoadState::LOAD_FINISHED;
+      SetMemoryFootprint( textureInfo, textureInfo.gpuMemorySize, GetPixelBufferSize( pixelBuffer ) );
 
       if( textureInfo.storageType == StorageType::RETURN_PIXEL_BUFFER )
       {
@@ -1026,6 +1159,7 @@ void TextureManager::CheckForWaitingTexture( TextureInfo& maskTextureInfo )
       else
       {
         textureInfo.pixelBuffer.Reset();
+        SetMemoryFootprint( textureInfo, textureInfo.gpuMemorySize, 0u );
         textureInfo.loadState = LoadState::LOAD_FAILED;
         NotifyObservers( textureInfo, false );
       }
@@ -1041,6 +1175,7 @@ void TextureManager::ApplyMask( TextureInfo& textureInfo, TextureId maskTextureI
     Devel::PixelBuffer maskPixelBuffer = mTextureInfoContainer[maskCacheIndex].pixelBuffer;
     Devel::PixelBuffer pixelBuffer = textureInfo.pixelBuffer;
     textureInfo.pixelBuffer.Reset();
+    SetMemoryFootprint( textureInfo, textureInfo.gpuMemorySize, 0u );
 
     DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::ApplyMask(): url:%s sync:%s\n",
                    textureInfo.url.GetUrl().c_str(), textureInfo.loadSynchronously?"T":"F" );
@@ -1071,6 +1206,7 @@ void TextureManager::UploadTexture( Devel::PixelBuffer& pixelBuffer, TextureInfo
 
     Texture texture = Texture::New( Dali::TextureType::TEXTURE_2D, pixelBuffer.GetPixelFormat(),
                                     pixelBuffer.GetWidth(), pixelBuffer.GetHeight() );
+    SetMemoryFootprint( textureInfo, GetPixelBufferSize( pixelBuffer ), textureInfo.cpuMemorySize );
 
     PixelData pixelData = Devel::PixelBuffer::Convert( pixelBuffer );
     texture.Upload( pixelData );
@@ -1081,6 +1217,8 @@ void TextureManager::UploadTexture( Devel::PixelBuffer& pixelBuffer, TextureInfo
     textureInfo.textureSet.SetTexture( 0u, texture );
   }
 
+  RecordLoadTime( textureInfo );
+
   // Update the load state.
   // Note: This is regardless of success as we care about whether a
   // load attempt is in progress or not.  If unsuccessful, a broken
@@ -1141,9 +1279,15 @@ void TextureManager::NotifyObservers( TextureInfo& textureInfo, bool success )
   mQueueLoadFlag = false;
   ProcessQueuedTextures();
 
-  if( info->storageType == StorageType::RETURN_PIXEL_BUFFER && info->observerList.Count() == 0 )
+  // The texture may have been removed (and its slot reused) by an observer, so look it up again.
+  int textureInfoIndex = GetCacheIndexFromId( textureId );
+  if( textureInfoIndex != INVALID_CACHE_INDEX )
   {
-    Remove( info->textureId, nullptr );
+    info = &mTextureInfoContainer[ textureInfoIndex ];
+    if( info->storageType == StorageType::RETURN_PIXEL_BUFFER && info->observerList.Count() == 0 )
+    {
+      Remove( info->textureId, nullptr );
+    }
   }
 }
 
@@ -1154,17 +1298,123 @@ TextureManager::TextureId TextureManager::GenerateUniqueTextureId()
 
 int TextureManager::GetCacheIndexFromId( const TextureId textureId )
 {
-  const unsigned int size = mTextureInfoContainer.size();
+  auto iter = mTextureIdLookup.find( textureId );
+  return ( iter != mTextureIdLookup.end() ) ? iter->second : INVALID_CACHE_INDEX;
+}
+
+int TextureManager::AddTextureInfo( const TextureInfo& textureInfo )
+{
+  int cacheIndex;
+  if( mFreeCacheIndices.Count() > 0u )
+  {
+    cacheIndex = mFreeCacheIndices[ mFreeCacheIndices.Count() - 1u ];
+    mFreeCacheIndices.Erase( mFreeCacheIndices.End() - 1u );
+    mTextureInfoContainer[ cacheIndex ] = textureInfo;
+  }
+  else
+  {
+    cacheIndex = static_cast<int>( mTextureInfoContainer.size() );
+    mTextureInfoContainer.push_back( textureInfo );
+  }
+
+  mTextureIdLookup[ textureInfo.textureId ] = cacheIndex;
+
+  // Uncached loads (e.g. pixel buffers and animated images) use the initial cache number and are never looked up by hash.
+  if( textureInfo.hash != INITIAL_CACHE_NUMBER )
+  {
+    mTextureHashLookup.emplace( textureInfo.hash, cacheIndex );
+  }
+
+  return cacheIndex;
+}
+
+void TextureManager::RemoveTextureInfo( int cacheIndex )
+{
+  TextureInfo& textureInfo( mTextureInfoContainer[ cacheIndex ] );
 
-  for( unsigned int i = 0; i < size; ++i )
+  mTextureIdLookup.erase( textureInfo.textureId );
+
+  auto range = mTextureHashLookup.equal_range( textureInfo.hash );
+  for( auto iter = range.first; iter != range.second; ++iter )
   {
-    if( mTextureInfoContainer[i].textureId == textureId )
+    if( iter->second == cacheIndex )
     {
-      return i;
+      mTextureHashLookup.erase( iter );
+      break;
     }
   }
 
-  return INVALID_CACHE_INDEX;
+  if( textureInfo.retained )
+  {
+    mRetainedTextures.erase( textureInfo.retainedPosition );
+  }
+  SetMemoryFootprint( textureInfo, 0u, 0u );
+
+  // Release the resources held by the slot, then make it available for reuse.
+  textureInfo = TextureInfo( INVALID_TEXTURE_ID, INVALID_TEXTURE_ID, VisualUrl(), ImageDimensions(), 1.0f,
+                             FittingMode::DEFAULT, SamplingMode::DEFAULT, false, false, NO_ATLAS,
+                             INITIAL_CACHE_NUMBER, true, false, Dali::AnimatedImageLoading(), 0u );
+  mFreeCacheIndices.PushBack( cacheIndex );
+}
+
+void TextureManager::SetMemoryFootprint( TextureInfo& textureInfo, size_t gpuMemorySize, size_t cpuMemorySize )
+{
+  const bool grown = gpuMemorySize + cpuMemorySize > textureInfo.gpuMemorySize + textureInfo.cpuMemorySize;
+
+  mCacheStatistics.memoryUsage -= textureInfo.gpuMemorySize + textureInfo.cpuMemorySize;
+  mCacheStatistics.memoryUsage += gpuMemorySize + cpuMemorySize;
+  mCacheStatistics.peakMemoryUsage = std::max( mCacheStatistics.peakMemoryUsage, mCacheStatistics.memoryUsage );
+
+  textureInfo.gpuMemorySize = gpuMemorySize;
+  textureInfo.cpuMemorySize = cpuMemorySize;
+
+  // Make room for the new loads and uploads. The slots of evicted Textures are reused but never
+  // reallocated, so the caller's textureInfo stays valid; it is not retained, as it is in use.
+  if( grown && !textureInfo.retained )
+  {
+    EvictRetainedTextures();
+  }
+}
+
+bool TextureManager::CanRetainTexture( const TextureInfo& textureInfo ) const
+{
+  // Only textures which can be found in the cache again are worth keeping.
+  return mCacheBudget > 0u &&
+         !textureInfo.retained &&
+         textureInfo.loadState == LoadState::UPLOADED &&
+         textureInfo.storageType == StorageType::UPLOAD_TO_TEXTURE &&
+         textureInfo.hash != INITIAL_CACHE_NUMBER &&
+         textureInfo.maskTextureId == INVALID_TEXTURE_ID &&
+         !textureInfo.atlas;
+}
+
+void TextureManager::EvictRetainedTextures()
+{
+  while( mCacheStatistics.memoryUsage > mCacheBudget && !mRetainedTextures.empty() )
+  {
+    int cacheIndex = mRetainedTextures.back();
+
+    DALI_LOG_INFO( gTextureManagerLogFilter, Debug::Concise, "TextureManager::EvictRetainedTextures() url:%s textureId:%d\n",
+                   mTextureInfoContainer[ cacheIndex ].url.GetUrl().c_str(), mTextureInfoContainer[ cacheIndex ].textureId );
+
+    RemoveTextureInfo( cacheIndex );
+  }
+}
+
+void TextureManager::SetCacheBudget( size_t budget )
+{
+  mCacheBudget = budget;
+  EvictRetainedTextures();
+}
+
+size_t TextureManager::GetCacheBudget() const
+{
+  return mCacheBudget;
+}
+
+const Dali::Toolkit::TextureManager::CacheStatistics& TextureManager::GetCacheStatistics() const
+{
+  return mCacheStatistics;
 }
 
 TextureManager::TextureHash TextureManager::GenerateHash(
@@ -1249,32 +1499,29 @@ int TextureManager::FindCachedTexture(
   // Default to an invalid ID, in case we do not find a match.
   int cacheIndex = INVALID_CACHE_INDEX;
 
-  // Iterate through our hashes to find a match.
-  const unsigned int count = mTextureInfoContainer.size();
-  for( unsigned int i = 0u; i < count; ++i )
+  // Only the TextureInfos sharing this hash need to be checked.
+  auto range = mTextureHashLookup.equal_range( hash );
+  for( auto iter = range.first; iter != range.second; ++iter )
   {
-    if( mTextureInfoContainer[i].hash == hash )
+    // We have a match, now we check all the original parameters in case of a hash collision.
+    TextureInfo& textureInfo( mTextureInfoContainer[ iter->second ] );
+
+    if( ( url == textureInfo.url.GetUrl() ) &&
+        ( useAtlas == textureInfo.useAtlas ) &&
+        ( maskTextureId == textureInfo.maskTextureId ) &&
+        ( size == textureInfo.desiredSize ) &&
+        ( ( size.GetWidth() == 0 && size.GetHeight() == 0 ) ||
+          ( fittingMode == textureInfo.fittingMode &&
+            samplingMode == textureInfo.samplingMode ) ) )
     {
-      // We have a match, now we check all the original parameters in case of a hash collision.
-      TextureInfo& textureInfo( mTextureInfoContainer[i] );
-
-      if( ( url == textureInfo.url.GetUrl() ) &&
-          ( useAtlas == textureInfo.useAtlas ) &&
-          ( maskTextureId == textureInfo.maskTextureId ) &&
-          ( size == textureInfo.desiredSize ) &&
-          ( ( size.GetWidth() == 0 && size.GetHeight() == 0 ) ||
-            ( fittingMode == textureInfo.fittingMode &&
-              samplingMode == textureInfo.samplingMode ) ) )
+      // 1. If preMultiplyOnLoad is MULTIPLY_ON_LOAD, then textureInfo.preMultiplyOnLoad should be true. The premultiplication result can be different.
+      // 2. If preMultiplyOnLoad is LOAD_WITHOUT_MULTIPLY, then textureInfo.preMultiplied should be false.
+      if( ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad )
+          || ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied ) )
       {
-        // 1. If preMultiplyOnLoad is MULTIPLY_ON_LOAD, then textureInfo.preMultiplyOnLoad should be true. The premultiplication result can be different.
-        // 2. If preMultiplyOnLoad is LOAD_WITHOUT_MULTIPLY, then textureInfo.preMultiplied should be false.
-        if( ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::MULTIPLY_ON_LOAD && textureInfo.preMultiplyOnLoad )
-            || ( preMultiplyOnLoad == TextureManager::MultiplyOnLoad::LOAD_WITHOUT_MULTIPLY && !textureInfo.preMultiplied ) )
-        {
-          // The found Texture is a match.
-          cacheIndex = i;
-          break;
-        }
+        // The found Texture is a match.
+        cacheIndex = iter->second;
+        break;
       }
     }
   }
@@ -1353,6 +1600,36 @@ void TextureManager::AsyncLoadingHelper::ApplyMask( TextureId
   mLoadingInfoContainer.back().loadId = id;
 }
 
+bool TextureManager::AsyncLoadingHelper::SetLoadPriority( TextureId                           textureId,
+                                                          DevelAsyncImageLoader::LoadPriority priority )
+{
+  for( auto&& loadingInfo : mLoadingInfoContainer )
+  {
+    if( loadingInfo.textureId == textureId )
+    {
+      return DevelAsyncImageLoader::SetLoadPriority( mLoader, loadingInfo.loadId, priority );
+    }
+  }
+  return false;
+}
+
+bool TextureManager::AsyncLoadingHelper::Cancel( TextureId textureId )
+{
+  for( auto iter = mLoadingInfoContainer.begin(); iter != mLoadingInfoContainer.end(); ++iter )
+  {
+    if( iter->textureId == textureId )
+    {
+      if( mLoader.Cancel( iter->loadId ) )
+      {
+        mLoadingInfoContainer.erase( iter );
+        return true;
+      }
+      return false;
+    }
+  }
+  return false;
+}
+
 TextureManager::AsyncLoadingHelper::AsyncLoadingHelper(AsyncLoadingHelper&& rhs)
 : AsyncLoadingHelper(rhs.mLoader, rhs.mTextureManager, std::move(rhs.mLoadingInfoContainer))
 {
@@ -18,10 +18,13 @@
  */
 
 // EXTERNAL INCLUDES
+#include <chrono>
 #include <deque>
 #include <functional>
+#include <list>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/texture-set.h>
@@ -32,6 +35,7 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/devel-api/image-loader/async-image-loader-devel.h>
 #include <dali-toolkit/devel-api/image-loader/image-atlas.h>
+#include <dali-toolkit/devel-api/image-loader/texture-manager.h>
 #include <dali-toolkit/public-api/image-loader/async-image-loader.h>
 #include <dali-toolkit/internal/visuals/texture-upload-observer.h>
 #include <dali-toolkit/internal/visuals/visual-url.h>
@@ -372,6 +376,18 @@ public:
    */
   void Remove( const TextureManager::TextureId textureId, TextureUploadObserver* textureObserver );
 
+  /**
+   * @brief Change the priority of an asynchronous load which has not started yet.
+   *
+   * Loads are requested with a high priority. Images which are not on the scene can be given
+   * a low priority, so the images on the scene are loaded first.
+   * A texture used by several clients is not given a low priority.
+   *
+   * @param[in] textureId The ID of the Texture being loaded.
+   * @param[in] priority The new priority of the load.
+   */
+  void SetLoadPriority( const TextureManager::TextureId textureId, DevelAsyncImageLoader::LoadPriority priority );
+
   /**
    * @brief Get the visualUrl associated with the texture id.
    * @param[in] textureId The texture Id to get
@@ -436,6 +452,21 @@ public:
    */
   Geometry GetRenderGeometry(TextureId textureId, uint32_t& frontElements, uint32_t& backElements );
 
+  /**
+   * @copydoc Dali::Toolkit::TextureManager::SetCacheBudget()
+   */
+  void SetCacheBudget( size_t budget );
+
+  /**
+   * @copydoc Dali::Toolkit::TextureManager::GetCacheBudget()
+   */
+  size_t GetCacheBudget() const;
+
+  /**
+   * @copydoc Dali::Toolkit::TextureManager::GetCacheStatistics()
+   */
+  const Dali::Toolkit::TextureManager::CacheStatistics& GetCacheStatistics() const;
+
 private:
 
   /**
@@ -498,6 +529,7 @@ private:
   LoadState GetTextureStateInternal( TextureId textureId );
 
   typedef size_t TextureHash; ///< The type used to store the hash used for Texture caching.
+  typedef std::list<int> RetainedTextureListType; ///< The type used to order unreferenced Textures from most to least recently used.
 
   // Structs:
 
@@ -536,12 +568,18 @@ private:
       storageType( StorageType::UPLOAD_TO_TEXTURE ),
       animatedImageLoading( animatedImageLoading ),
       frameIndex( frameIndex ),
+      gpuMemorySize( 0u ),
+      cpuMemorySize( 0u ),
+      retainedPosition(),
+      loadStartTime(),
       loadSynchronously( loadSynchronously ),
       useAtlas( useAtlas ),
       cropToMask( cropToMask ),
       orientationCorrection( true ),
       preMultiplyOnLoad( preMultiplyOnLoad ),
-      preMultiplied( false )
+      preMultiplied( false ),
+      retained( false ),
+      lowPriority( false )
     {
     }
 
@@ -569,6 +607,10 @@ private:
     StorageType storageType;       ///< CPU storage / GPU upload;
     Dali::AnimatedImageLoading animatedImageLoading; ///< AnimatedImageLoading that contains animated image information.
     uint32_t frameIndex;           ///< frame index that be loaded, in case of animated image
+    size_t gpuMemorySize;          ///< The number of bytes used by the uploaded Texture
+    size_t cpuMemorySize;          ///< The number of bytes used by the stored PixelBuffer
+    RetainedTextureListType::iterator retainedPosition; ///< The position in the retained list, if retained
+    std::chrono::steady_clock::time_point loadStartTime; ///< When the asynchronous load was requested, or given a high priority
     bool loadSynchronously:1;      ///< True if synchronous loading was requested
     UseAtlas useAtlas:2;           ///< USE_ATLAS if an atlas was requested.
                                    ///< This is updated to false if atlas is not used
@@ -576,6 +618,8 @@ private:
     bool orientationCorrection:1;  ///< true if the image should be rotated to match exif orientation data
     bool preMultiplyOnLoad:1;      ///< true if the image's color should be multiplied by it's alpha
     bool preMultiplied:1;          ///< true if the image's color was multiplied by it's alpha
+    bool retained:1;               ///< true if the Texture is unreferenced but kept until evicted
+    bool lowPriority:1;            ///< true if the asynchronous load was given a low priority
   };
 
   /**
@@ -613,6 +657,45 @@ private:
 
   typedef std::deque<AsyncLoadingInfo>  AsyncLoadingInfoContainerType;  ///< The container type used to manage Asynchronous loads in progress
   typedef std::vector<TextureInfo>      TextureInfoContainerType;       ///< The container type used to manage the life-cycle and caching of Textures
+  typedef std::unordered_map<TextureId, int>        TextureIdLookupType;   ///< Maps a TextureId to its index in the TextureInfoContainer
+  typedef std::unordered_multimap<TextureHash, int> TextureHashLookupType; ///< Maps a TextureHash to the indices of all TextureInfos sharing it
+
+  /**
+   * @brief Stores the given TextureInfo in the cache, reusing a free slot if there is one.
+   * Slots never move, so a cache index remains valid until its TextureInfo is removed.
+   * @param[in] textureInfo The TextureInfo to store
+   * @return The cache index of the stored TextureInfo
+   */
+  int AddTextureInfo( const TextureInfo& textureInfo );
+
+  /**
+   * @brief Removes the TextureInfo at the given cache index, releasing its resources and
+   * marking its slot as free for reuse.
+   * @param[in] cacheIndex The cache index of the TextureInfo to remove
+   */
+  void RemoveTextureInfo( int cacheIndex );
+
+  /**
+   * @brief Updates the memory footprint of a Texture and the total memory usage.
+   *
+   * If the footprint grows, unreferenced Textures are evicted to keep the memory usage within budget.
+   * @param[in] textureInfo The TextureInfo struct associated with the Texture
+   * @param[in] gpuMemorySize The number of bytes used by its uploaded Texture
+   * @param[in] cpuMemorySize The number of bytes used by its stored PixelBuffer
+   */
+  void SetMemoryFootprint( TextureInfo& textureInfo, size_t gpuMemorySize, size_t cpuMemorySize );
+
+  /**
+   * @brief Checks whether an unreferenced Texture can be kept in the cache until evicted.
+   * @param[in] textureInfo The TextureInfo struct associated with the Texture
+   * @return true if the Texture can be retained
+   */
+  bool CanRetainTexture( const TextureInfo& textureInfo ) const;
+
+  /**
+   * @brief Evicts the least recently used unreferenced Textures until the memory usage is within budget.
+   */
+  void EvictRetainedTextures();
 
   /**
    * @brief Initiate a load or queue load if NotifyObservers is invoking callbacks
@@ -669,6 +752,19 @@ private:
    */
   void AsyncLoadComplete( AsyncLoadingInfoContainerType& container, uint32_t id, Devel::PixelBuffer pixelBuffer );
 
+  /**
+   * Cancel the asynchronous load of a texture if it has not started yet.
+   * @param[in] textureId The ID of the Texture being loaded
+   * @return true if the load has been cancelled
+   */
+  bool CancelLoad( TextureId textureId );
+
+  /**
+   * Record the time taken to upload a texture which was requested with a high priority.
+   * @param[in] textureInfo The TextureInfo of the uploaded texture
+   */
+  void RecordLoadTime( TextureInfo& textureInfo );
+
   /**
    * @brief Performs Post-Load steps including atlasing.
    * @param[in] textureInfo The struct associated with this Texture
@@ -836,6 +932,21 @@ private:
                     bool cropToMask,
                     DevelAsyncImageLoader::PreMultiplyOnLoad preMultiplyOnLoad );
 
+    /**
+     * @brief Change the priority of a load which has not started yet
+     * @param[in] textureId The TextureId of the load
+     * @param[in] priority  The new priority of the load
+     * @return true if the load was found and has not started yet
+     */
+    bool SetLoadPriority( TextureId textureId, DevelAsyncImageLoader::LoadPriority priority );
+
+    /**
+     * @brief Cancel a load which has not started yet
+     * @param[in] textureId The TextureId of the load
+     * @return true if the load was found and has been cancelled
+     */
+    bool Cancel( TextureId textureId );
+
   public:
     AsyncLoadingHelper(const AsyncLoadingHelper&) = delete;
     AsyncLoadingHelper& operator=(const AsyncLoadingHelper&) = delete;
@@ -892,6 +1003,12 @@ private:
 private:  // Member Variables:
 
   TextureInfoContainerType                      mTextureInfoContainer; ///< Used to manage the life-cycle and caching of Textures
+  TextureIdLookupType                           mTextureIdLookup;      ///< Used to find the cache index of a TextureId
+  TextureHashLookupType                         mTextureHashLookup;    ///< Used to find the cache indices of a TextureHash
+  Dali::Vector<int>                             mFreeCacheIndices;     ///< Slots of mTextureInfoContainer available for reuse
+  RetainedTextureListType                       mRetainedTextures;     ///< Cache indices of unreferenced Textures, most recently used first
+  Dali::Toolkit::TextureManager::CacheStatistics mCacheStatistics;     ///< Memory usage and cache hit statistics
+  size_t                                        mCacheBudget;          ///< The memory usage above which unreferenced Textures are evicted
   RoundRobinContainerView< AsyncLoadingHelper > mAsyncLocalLoaders;    ///< The Asynchronous image loaders used to provide all local async loads
   RoundRobinContainerView< AsyncLoadingHelper > mAsyncRemoteLoaders;   ///< The Asynchronous image loaders used to provide all remote async loads
   std::vector< ExternalTextureInfo >            mExternalTextures;     ///< Externally provided textures
@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/color/color-visual.h>
+#include <dali-toolkit/internal/visuals/svg/svg-cache.h>
 #include <dali-toolkit/internal/visuals/svg/svg-visual.h>
 #include <dali-toolkit/internal/visuals/image-atlas-manager.h>
 #include <dali-toolkit/internal/visuals/animated-vector-image/vector-animation-manager.h>
@@ -37,7 +38,7 @@ namespace Internal
 {
 
 VisualFactoryCache::VisualFactoryCache( bool preMultiplyOnLoad )
-: mSvgRasterizeThread( NULL ),
+: mSvgCache(),
   mVectorAnimationManager(),
   mBrokenImageUrl(""),
   mPreMultiplyOnLoad( preMultiplyOnLoad )
@@ -46,7 +47,6 @@ VisualFactoryCache::VisualFactoryCache( bool preMultiplyOnLoad )
 
 VisualFactoryCache::~VisualFactoryCache()
 {
-  SvgRasterizeThread::TerminateThread( mSvgRasterizeThread );
 }
 
 Geometry VisualFactoryCache::GetGeometry( GeometryType type )
@@ -121,14 +121,13 @@ NPatchLoader& VisualFactoryCache::GetNPatchLoader()
   return mNPatchLoader;
 }
 
-SvgRasterizeThread* VisualFactoryCache::GetSVGRasterizationThread()
+SvgCache& VisualFactoryCache::GetSvgCache()
 {
-  if( !mSvgRasterizeThread )
+  if( !mSvgCache )
   {
-    mSvgRasterizeThread = new SvgRasterizeThread();
-    mSvgRasterizeThread->Start();
+    mSvgCache = std::unique_ptr< SvgCache >( new SvgCache() );
   }
-  return mSvgRasterizeThread;
+  return *mSvgCache;
 }
 
 VectorAnimationManager& VisualFactoryCache::GetVectorAnimationManager()
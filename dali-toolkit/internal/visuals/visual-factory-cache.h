@@ -18,6 +18,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <memory>
 #include <dali/public-api/math/uint-16-pair.h>
 #include <dali/public-api/object/ref-object.h>
 #include <dali/public-api/rendering/geometry.h>
@@ -26,7 +27,6 @@
 
 // INTERNAL INCLUDES
 #include <dali-toolkit/internal/visuals/npatch-loader.h>
-#include <dali-toolkit/internal/visuals/svg/svg-rasterize-thread.h>
 #include <dali-toolkit/internal/visuals/texture-manager-impl.h>
 
 namespace Dali
@@ -40,6 +40,7 @@ namespace Internal
 {
 class ImageAtlasManager;
 class NPatchLoader;
+class SvgCache;
 class TextureManager;
 class VectorAnimationManager;
 
@@ -209,10 +210,10 @@ public:
   NPatchLoader& GetNPatchLoader();
 
   /**
-   * Get the SVG rasterization thread.
-   * @return A raw pointer pointing to the SVG rasterization thread.
+   * Get the SVG cache, which also owns the SVG rasterization thread.
+   * @return A reference to the SVG cache.
    */
-  SvgRasterizeThread* GetSVGRasterizationThread();
+  SvgCache& GetSvgCache();
 
   /**
    * Get the vector animation manager.
@@ -240,7 +241,7 @@ private:
   TextureManager                            mTextureManager;
   NPatchLoader                              mNPatchLoader;
   Texture                                   mBrokenImageTexture;
-  SvgRasterizeThread*                       mSvgRasterizeThread;
+  std::unique_ptr< SvgCache >               mSvgCache;
   std::unique_ptr< VectorAnimationManager > mVectorAnimationManager;
   std::string                               mBrokenImageUrl;
   bool                                      mPreMultiplyOnLoad;